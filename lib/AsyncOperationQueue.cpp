@@ -0,0 +1,165 @@
+#include "AsyncOperationQueue.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+using namespace sairedis;
+
+AsyncOperationQueue::AsyncOperationQueue():
+    m_nextId(1)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+AsyncOperationQueue::~AsyncOperationQueue()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_operations.size())
+    {
+        SWSS_LOG_WARN("%zu asynchronous operations were not completed", m_operations.size());
+    }
+}
+
+async_ticket_t AsyncOperationQueue::push(
+        _In_ sai_common_api_t api,
+        _In_ Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    operation_t op;
+
+    op.id = m_nextId++;
+    op.api = api;
+    op.callback = callback;
+
+    async_ticket_t ticket;
+
+    ticket.id = op.id;
+    ticket.status = op.promise.get_future().share();
+
+    m_operations.push_back(std::move(op));
+
+    return ticket;
+}
+
+void AsyncOperationQueue::completeFront(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_operations.empty())
+    {
+        SWSS_LOG_THROW("no asynchronous operation to complete, got unexpected response");
+    }
+
+    auto op = std::move(m_operations.front());
+
+    m_operations.pop_front();
+
+    executeCallback(op.id, op.callback, status);
+
+    op.promise.set_value(status);
+}
+
+async_ticket_t AsyncOperationQueue::complete(
+        _In_ sai_status_t status,
+        _In_ Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    std::promise<sai_status_t> promise;
+
+    async_ticket_t ticket;
+
+    ticket.id = m_nextId++;
+    ticket.status = promise.get_future().share();
+
+    executeCallback(ticket.id, callback, status);
+
+    promise.set_value(status);
+
+    return ticket;
+}
+
+void AsyncOperationQueue::completeAll(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    while (m_operations.size())
+    {
+        completeFront(status);
+    }
+}
+
+bool AsyncOperationQueue::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_operations.empty();
+}
+
+size_t AsyncOperationQueue::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_operations.size();
+}
+
+sai_common_api_t AsyncOperationQueue::frontApi() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_operations.empty())
+    {
+        SWSS_LOG_THROW("asynchronous operation queue is empty");
+    }
+
+    return m_operations.front().api;
+}
+
+bool AsyncOperationQueue::isCompleted(
+        _In_ const async_ticket_t& ticket)
+{
+    SWSS_LOG_ENTER();
+
+    if (!ticket.status.valid())
+    {
+        SWSS_LOG_THROW("invalid asynchronous ticket %" PRIu64, ticket.id);
+    }
+
+    return ticket.status.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void AsyncOperationQueue::executeCallback(
+        _In_ uint64_t id,
+        _In_ const Callback& callback,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (!callback)
+    {
+        return;
+    }
+
+    // exception from user callback must not leave operation uncompleted
+
+    try
+    {
+        callback(status);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("asynchronous operation %" PRIu64 " callback (status %s) failed: %s",
+                id,
+                sai_serialize_status(status).c_str(),
+                e.what());
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "swss/sal.h"
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <deque>
+#include <functional>
+#include <future>
+
+namespace sairedis
+{
+    /**
+     * @brief Asynchronous operation ticket.
+     *
+     * Returned when asynchronous operation is submitted. Status becomes
+     * ready when operation is completed.
+     */
+    typedef struct _async_ticket_t
+    {
+        uint64_t id;
+
+        std::shared_future<sai_status_t> status;
+
+    } async_ticket_t;
+
+    /**
+     * @brief Asynchronous operation queue.
+     *
+     * Holds operations which were sent but not yet completed, in order of
+     * submission. Since responses are received in order of requests, each
+     * received response completes operation at the front of the queue.
+     *
+     * Completion callback is executed on thread which completes operation,
+     * before ticket status becomes ready.
+     *
+     * Queue is not thread safe.
+     */
+    class AsyncOperationQueue
+    {
+        public:
+
+            typedef std::function<void(sai_status_t status)> Callback;
+
+        public:
+
+            AsyncOperationQueue();
+
+            virtual ~AsyncOperationQueue();
+
+        public:
+
+            /**
+             * @brief Add operation at the end of the queue.
+             */
+            async_ticket_t push(
+                    _In_ sai_common_api_t api,
+                    _In_ Callback callback);
+
+            /**
+             * @brief Complete operation at the front of the queue.
+             *
+             * Throws if queue is empty.
+             */
+            void completeFront(
+                    _In_ sai_status_t status);
+
+            /**
+             * @brief Complete operation which was never queued.
+             *
+             * Used when operation fails before it is sent.
+             */
+            async_ticket_t complete(
+                    _In_ sai_status_t status,
+                    _In_ Callback callback);
+
+            /**
+             * @brief Complete all queued operations with given status.
+             */
+            void completeAll(
+                    _In_ sai_status_t status);
+
+            bool empty() const;
+
+            size_t size() const;
+
+            /**
+             * @brief Api of operation at the front of the queue.
+             */
+            sai_common_api_t frontApi() const;
+
+        public:
+
+            static bool isCompleted(
+                    _In_ const async_ticket_t& ticket);
+
+        private:
+
+            AsyncOperationQueue(const AsyncOperationQueue&);
+            AsyncOperationQueue& operator=(const AsyncOperationQueue&);
+
+            void executeCallback(
+                    _In_ uint64_t id,
+                    _In_ const Callback& callback,
+                    _In_ sai_status_t status);
+
+            typedef struct _operation_t
+            {
+                uint64_t id;
+
+                sai_common_api_t api;
+
+                Callback callback;
+
+                std::promise<sai_status_t> promise;
+
+            } operation_t;
+
+            std::deque<operation_t> m_operations;
+
+            uint64_t m_nextId;
+    };
+}
@@ -2,14 +2,19 @@
 
 #include "sairedis.h"
 
+#include "meta/Globals.h"
+
 #include "swss/logger.h"
 
+#include <inttypes.h>
+
 using namespace sairedis;
 
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(SAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_lastResponseSequence(0)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +42,63 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+bool Channel::isPipelineSupported() const
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
+
+bool Channel::isResponseAvailable()
+{
+    SWSS_LOG_ENTER();
+
+    return !m_pendingResponses.empty();
+}
+
+void Channel::addBatchResponse(
+        _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint64_t> sequences;
+    std::vector<swss::KeyOpFieldsValuesTuple> responses;
+
+    saimeta::Globals::parseBatchResponse(kfvFieldsValues(kco), sequences, responses);
+
+    for (size_t idx = 0; idx < responses.size(); idx++)
+    {
+        if (m_lastResponseSequence && sequences[idx] != m_lastResponseSequence + 1)
+        {
+            // can happen when previous response timed out
+
+            SWSS_LOG_WARN("expected response sequence %" PRIu64 ", got %" PRIu64,
+                    m_lastResponseSequence + 1,
+                    sequences[idx]);
+        }
+
+        m_lastResponseSequence = sequences[idx];
+
+        m_pendingResponses.push_back(std::move(responses[idx]));
+    }
+
+    SWSS_LOG_INFO("queued %zu batch responses", responses.size());
+}
+
+bool Channel::popPendingResponse(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingResponses.empty())
+    {
+        return false;
+    }
+
+    kco = std::move(m_pendingResponses.front());
+
+    m_pendingResponses.pop_front();
+
+    return true;
+}
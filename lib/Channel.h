@@ -12,6 +12,7 @@ extern "C" {
 
 #include <memory>
 #include <functional>
+#include <deque>
 
 namespace sairedis
 {
@@ -55,10 +56,53 @@ namespace sairedis
                     _In_ const std::string& command,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) = 0;
 
+        public: // pipelined requests
+
+            /**
+             * @brief Indicates whether channel allows sending next request
+             * before response to previous request was received.
+             *
+             * Responses are always received in order of requests.
+             */
+            virtual bool isPipelineSupported() const;
+
+            /**
+             * @brief Check without blocking whether response can be received.
+             *
+             * When true is returned, wait will not block on select.
+             */
+            virtual bool isResponseAvailable();
+
         protected:
 
             virtual void notificationThreadFunction() = 0;
 
+        protected: // batch response
+
+            /**
+             * @brief Queue responses received in single batch response.
+             *
+             * Responses are queued in order of sequence numbers, so they
+             * can be consumed by following wait calls without blocking.
+             */
+            void addBatchResponse(
+                    _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Pop next queued response.
+             *
+             * @return True if response was queued, false otherwise.
+             */
+            bool popPendingResponse(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            std::deque<swss::KeyOpFieldsValuesTuple> m_pendingResponses;
+
+            /**
+             * @brief Sequence number of last queued response, 0 if none.
+             */
+            uint64_t m_lastResponseSequence;
+
         protected:
 
             Callback m_callback;
@@ -19,7 +19,9 @@ ContextConfig::ContextConfig(
     m_dbState(dbState),
     m_zmqEnable(false),
     m_zmqEndpoint("ipc:///tmp/zmq_ep"),
-    m_zmqNtfEndpoint("ipc:///tmp/zmq_ntf_ep")
+    m_zmqNtfEndpoint("ipc:///tmp/zmq_ntf_ep"),
+    m_shmEnable(false),
+    m_shmEndpoint("/tmp/shm_ep")
 {
     SWSS_LOG_ENTER();
 
@@ -90,5 +92,14 @@ bool ContextConfig::hasConflict(
         return true;
     }
 
+    // all contexts have the same default shm endpoint, so it's only
+    // a conflict when both contexts actually use it
+
+    if (m_shmEnable && ctx->m_shmEnable && m_shmEndpoint == ctx->m_shmEndpoint)
+    {
+        SWSS_LOG_ERROR("shmEndpoint %s conflict", m_shmEndpoint.c_str());
+        return true;
+    }
+
     return false;
 }
@@ -46,6 +46,10 @@ namespace sairedis
 
             std::string m_zmqNtfEndpoint;
 
+            bool m_shmEnable;
+
+            std::string m_shmEndpoint;
+
             std::shared_ptr<SwitchConfigContainer> m_scc;
     };
 }
@@ -132,6 +132,15 @@ std::shared_ptr<ContextConfigContainer> ContextConfigContainer::loadFromFile(
                     cc->m_zmqEndpoint.c_str(),
                     cc->m_zmqNtfEndpoint.c_str());
 
+            // shm fields are optional, to not break existing config files
+
+            cc->m_shmEnable = item.value("shm_enable", cc->m_shmEnable);
+            cc->m_shmEndpoint = item.value("shm_endpoint", cc->m_shmEndpoint);
+
+            SWSS_LOG_NOTICE("contextConfig shm enable %s, endpoint: %s",
+                    (cc->m_shmEnable) ? "true" : "false",
+                    cc->m_shmEndpoint.c_str());
+
             for (size_t k = 0; k < item["switches"].size(); k++)
             {
                 json& sw = item["switches"][k];
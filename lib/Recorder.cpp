@@ -44,6 +44,13 @@ Recorder::~Recorder()
     stopRecording();
 }
 
+bool Recorder::isRecordingEnabled() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_enabled;
+}
+
 bool Recorder::setRecordingOutputDirectory(
         _In_ const sai_attribute_t &attr)
 {
@@ -444,6 +451,11 @@ void Recorder::recordBulkGenericCreate(
 {
     SWSS_LOG_ENTER();
 
+    if (!m_enabled)
+    {
+        return;
+    }
+
     std::string joined;
 
     for (const auto &e: entriesWithStatus)
@@ -579,6 +591,11 @@ void Recorder::recordBulkGenericSet(
 {
     SWSS_LOG_ENTER();
 
+    if (!m_enabled)
+    {
+        return;
+    }
+
     std::string joined;
 
     for (const auto &e: arguments)
@@ -647,6 +664,11 @@ void Recorder::recordBulkGenericGet(
 {
     SWSS_LOG_ENTER();
 
+    if (!m_enabled)
+    {
+        return;
+    }
+
     std::string joined;
 
     for (const auto &e: arguments)
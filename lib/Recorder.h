@@ -373,6 +373,8 @@ namespace sairedis
             void enableRecording(
                     _In_ bool enabled);
 
+            bool isRecordingEnabled() const;
+
             bool setRecordingOutputDirectory(
                     _In_ const sai_attribute_t &attr);
 
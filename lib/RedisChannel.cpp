@@ -145,42 +145,104 @@ sai_status_t RedisChannel::wait(
 
     while (true)
     {
-        SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+        // responses left from previously received batch don't need select
 
-        swss::Selectable *sel;
-
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
-
-        if (result == swss::Select::OBJECT)
+        if (!popPendingResponse(kco))
         {
-            m_getConsumer->pop(kco);
+            SWSS_LOG_DEBUG("wait for %s response", command.c_str());
 
-            const std::string &op = kfvOp(kco);
-            const std::string &opkey = kfvKey(kco);
+            swss::Selectable *sel;
 
-            SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
+            int result = s.select(&sel, (int)m_responseTimeoutMs);
 
-            if (op != command)
+            if (result != swss::Select::OBJECT)
             {
-                SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+                SWSS_LOG_ERROR("SELECT operation result: %s on %s", swss::Select::resultToString(result).c_str(), command.c_str());
+                break;
+            }
 
-                // ignore non response messages
+            m_getConsumer->pop(kco);
+
+            if (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE)
+            {
+                addBatchResponse(kco);
                 continue;
             }
+        }
+
+        const std::string &op = kfvOp(kco);
+        const std::string &opkey = kfvKey(kco);
 
-            sai_status_t status;
-            sai_deserialize_status(opkey, status);
+        SWSS_LOG_DEBUG("response: op = %s, key = %s", opkey.c_str(), op.c_str());
 
-            SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+        if (op != command)
+        {
+            SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
 
-            return status;
+            // ignore non response messages
+            continue;
         }
 
-        SWSS_LOG_ERROR("SELECT operation result: %s on %s", swss::Select::resultToString(result).c_str(), command.c_str());
-        break;
+        sai_status_t status;
+        sai_deserialize_status(opkey, status);
+
+        SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+
+        return status;
     }
 
     SWSS_LOG_ERROR("failed to get response for %s", command.c_str());
 
     return SAI_STATUS_FAILURE;
 }
+
+bool RedisChannel::isPipelineSupported() const
+{
+    SWSS_LOG_ENTER();
+
+    // requests are queued in redis and syncd responds to them in order
+
+    return true;
+}
+
+bool RedisChannel::isResponseAvailable()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_pendingResponses.empty())
+    {
+        return true;
+    }
+
+    swss::Select s;
+
+    s.addSelectable(m_getConsumer.get());
+
+    swss::Selectable *sel;
+
+    if (s.select(&sel, 0) != swss::Select::OBJECT)
+    {
+        return false;
+    }
+
+    /*
+     * Select consumed consumer ready state, so response must be popped now,
+     * otherwise next wait would block on select until timeout while response
+     * is already in consumer buffer.
+     */
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    m_getConsumer->pop(kco);
+
+    if (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE)
+    {
+        addBatchResponse(kco);
+    }
+    else if (!kfvOp(kco).empty())
+    {
+        m_pendingResponses.push_back(std::move(kco));
+    }
+
+    return !m_pendingResponses.empty();
+}
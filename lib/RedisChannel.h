@@ -52,6 +52,10 @@ namespace sairedis
                     _In_ const std::string& command,
                     _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
 
+            virtual bool isPipelineSupported() const override;
+
+            virtual bool isResponseAvailable() override;
+
         protected:
 
             virtual void notificationThreadFunction() override;
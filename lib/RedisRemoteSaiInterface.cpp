@@ -5,6 +5,7 @@
 #include "SkipRecordAttrContainer.h"
 #include "SwitchContainer.h"
 #include "ZeroMQChannel.h"
+#include "ShmChannel.h"
 
 #include "sairediscommon.h"
 
@@ -45,6 +46,16 @@ RedisRemoteSaiInterface::RedisRemoteSaiInterface(
 
     m_initialized = false;
 
+    m_asyncOperations = std::make_shared<AsyncOperationQueue>();
+
+    m_lateResponses = 0;
+
+    m_failingAsyncOperations = false;
+
+    m_readOnlyTicket = 0;
+
+    m_readOnlyServedTicket = 0;
+
     apiInitialize(0, nullptr);
 }
 
@@ -78,7 +89,17 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
     m_syncMode = false;
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 
-    if (m_contextConfig->m_zmqEnable)
+    if (m_contextConfig->m_shmEnable)
+    {
+        m_communicationChannel = std::make_shared<ShmChannel>(
+                m_contextConfig->m_shmEndpoint,
+                std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3));
+
+        SWSS_LOG_NOTICE("shm enabled, forcing sync mode");
+
+        m_syncMode = true;
+    }
+    else if (m_contextConfig->m_zmqEnable)
     {
         m_communicationChannel = std::make_shared<ZeroMQChannel>(
                 m_contextConfig->m_zmqEndpoint,
@@ -98,6 +119,8 @@ sai_status_t RedisRemoteSaiInterface::apiInitialize(
 
     m_responseTimeoutMs = m_communicationChannel->getResponseTimeout();
 
+    m_lateResponses = 0;
+
     m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
 
     m_redisVidIndexGenerator = std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER);
@@ -124,6 +147,10 @@ sai_status_t RedisRemoteSaiInterface::apiUninitialize(void)
         return SAI_STATUS_FAILURE;
     }
 
+    // responses would be lost after channel is destroyed
+
+    waitForAsyncOperations();
+
     m_communicationChannel = nullptr; // will stop thread
 
     // clear local state after stopping threads
@@ -210,7 +237,7 @@ sai_status_t RedisRemoteSaiInterface::create(
     }
     else
     {
-        *objectId = m_virtualObjectIdManager->allocateNewObjectId(objectType, switchId);
+        return waitAsync(createAsync(objectType, objectId, switchId, attr_count, attr_list));
     }
 
     if (*objectId == SAI_NULL_OBJECT_ID)
@@ -259,11 +286,16 @@ sai_status_t RedisRemoteSaiInterface::remove(
 {
     SWSS_LOG_ENTER();
 
+    if (objectType != SAI_OBJECT_TYPE_SWITCH)
+    {
+        return waitAsync(removeAsync(objectType, objectId));
+    }
+
     auto status = remove(
             objectType,
             sai_serialize_object_id(objectId));
 
-    if (objectType == SAI_OBJECT_TYPE_SWITCH && status == SAI_STATUS_SUCCESS)
+    if (status == SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_NOTICE("removing switch id %s", sai_serialize_object_id(objectId).c_str());
 
@@ -345,11 +377,13 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
             SWSS_LOG_WARN("sync mode is depreacated, use communication mode");
 
+            waitForAsyncOperations();
+
             m_syncMode = attr->value.booldata;
 
-            if (m_contextConfig->m_zmqEnable)
+            if (m_contextConfig->m_zmqEnable || m_contextConfig->m_shmEnable)
             {
-                SWSS_LOG_NOTICE("zmq enabled, forcing sync mode");
+                SWSS_LOG_NOTICE("zmq or shm enabled, forcing sync mode");
 
                 m_syncMode = true;
             }
@@ -365,6 +399,10 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
         case SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE:
 
+            // responses would be lost after channel is replaced
+
+            waitForAsyncOperations();
+
             m_redisCommunicationMode = (sai_redis_communication_mode_t)attr->value.s32;
 
             if (m_contextConfig->m_zmqEnable)
@@ -374,8 +412,17 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
                 m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
             }
 
+            if (m_contextConfig->m_shmEnable)
+            {
+                SWSS_LOG_NOTICE("shm enabled via context config");
+
+                m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC;
+            }
+
             m_communicationChannel = nullptr;
 
+            m_lateResponses = 0; // responses to previous channel are lost
+
             switch (m_redisCommunicationMode)
             {
                 case SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC:
@@ -434,6 +481,29 @@ sai_status_t RedisRemoteSaiInterface::setRedisExtensionAttribute(
 
                     return SAI_STATUS_SUCCESS;
 
+                case SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC:
+
+                    m_contextConfig->m_shmEnable = true;
+
+                    // main communication channel was created at initialize method
+                    // so this command will replace it with shm channel
+
+                    m_communicationChannel = std::make_shared<ShmChannel>(
+                            m_contextConfig->m_shmEndpoint,
+                            std::bind(&RedisRemoteSaiInterface::handleNotification, this, _1, _2, _3));
+
+                    m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
+
+                    SWSS_LOG_NOTICE("shm enabled, forcing sync mode");
+
+                    m_syncMode = true;
+
+                    SWSS_LOG_NOTICE("disabling buffered pipeline in sync mode");
+
+                    m_communicationChannel->setBuffered(false);
+
+                    return SAI_STATUS_SUCCESS;
+
                 default:
 
                     SWSS_LOG_ERROR("invalid communication mode value: %d", m_redisCommunicationMode);
@@ -582,7 +652,7 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterGroupOperations(
                                 entries,
                                 (entries.size() != 0) ? REDIS_FLEX_COUNTER_COMMAND_SET_GROUP : REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP);
 
-    return waitForResponse(SAI_COMMON_API_SET);
+    return waitAsync(submitAsync(SAI_COMMON_API_SET, nullptr));
 }
 
 sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
@@ -614,7 +684,7 @@ sai_status_t RedisRemoteSaiInterface::notifyCounterOperations(
     m_recorder->recordGenericCounterPolling(key, entries);
     m_communicationChannel->set(key, entries, command);
 
-    return waitForResponse(SAI_COMMON_API_SET);
+    return waitAsync(submitAsync(SAI_COMMON_API_SET, nullptr));
 }
 
 sai_status_t RedisRemoteSaiInterface::set(
@@ -629,30 +699,7 @@ sai_status_t RedisRemoteSaiInterface::set(
         return setRedisExtensionAttribute(objectType, objectId, attr);
     }
 
-    auto status = set(
-            objectType,
-            sai_serialize_object_id(objectId),
-            attr);
-
-    if (objectType == SAI_OBJECT_TYPE_SWITCH && status == SAI_STATUS_SUCCESS)
-    {
-        auto sw = m_switchContainer->getSwitch(objectId);
-
-        if (!sw)
-        {
-            SWSS_LOG_THROW("failed to find switch %s in container",
-                    sai_serialize_object_id(objectId).c_str());
-        }
-
-        /*
-         * When doing SET operation user may want to update notification
-         * pointers.
-         */
-
-        sw->updateNotifications(1, attr);
-    }
-
-    return status;
+    return waitAsync(setAsync(objectType, objectId, attr));
 }
 
 sai_status_t RedisRemoteSaiInterface::get(
@@ -809,8 +856,170 @@ sai_status_t RedisRemoteSaiInterface::create(
 {
     SWSS_LOG_ENTER();
 
+    return waitAsync(createAsync(object_type, serializedObjectId, attr_count, attr_list));
+}
+
+sai_status_t RedisRemoteSaiInterface::remove(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId)
+{
+    SWSS_LOG_ENTER();
+
+    return waitAsync(removeAsync(objectType, serializedObjectId));
+}
+
+sai_status_t RedisRemoteSaiInterface::set(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string &serializedObjectId,
+        _In_ const sai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
+    return waitAsync(setAsync(objectType, serializedObjectId, attr));
+}
+
+async_ticket_t RedisRemoteSaiInterface::createAsync(
+        _In_ sai_object_type_t objectType,
+        _Out_ sai_object_id_t* objectId,
+        _In_ sai_object_id_t switchId,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ AsyncOperationQueue::Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    *objectId = SAI_NULL_OBJECT_ID;
+
+    if (objectType == SAI_OBJECT_TYPE_SWITCH)
+    {
+        SWSS_LOG_ERROR("switch can't be created asynchronously");
+
+        return m_asyncOperations->complete(SAI_STATUS_NOT_SUPPORTED, callback);
+    }
+
+    *objectId = m_virtualObjectIdManager->allocateNewObjectId(objectType, switchId);
+
+    if (*objectId == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("failed to create %s, with switch id: %s",
+                sai_serialize_object_type(objectType).c_str(),
+                sai_serialize_object_id(switchId).c_str());
+
+        return m_asyncOperations->complete(SAI_STATUS_INSUFFICIENT_RESOURCES, callback);
+    }
+
+    sai_object_id_t vid = *objectId;
+
+    return createAsync(
+            objectType,
+            sai_serialize_object_id(vid),
+            attr_count,
+            attr_list,
+            [this, vid, callback](sai_status_t status) {
+
+                if (m_failingAsyncOperations)
+                {
+                    // object may be created by syncd, so id can't be reused
+
+                    SWSS_LOG_ERROR("create of %s timed out, object id is not released",
+                            sai_serialize_object_id(vid).c_str());
+                }
+                else if (status != SAI_STATUS_SUCCESS)
+                {
+                    // if create failed, then release allocated object
+                    m_virtualObjectIdManager->releaseObjectId(vid);
+                }
+
+                if (callback)
+                {
+                    callback(status);
+                }
+            });
+}
+
+async_ticket_t RedisRemoteSaiInterface::removeAsync(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ AsyncOperationQueue::Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType == SAI_OBJECT_TYPE_SWITCH)
+    {
+        SWSS_LOG_ERROR("switch can't be removed asynchronously");
+
+        return m_asyncOperations->complete(SAI_STATUS_NOT_SUPPORTED, callback);
+    }
+
+    return removeAsync(objectType, sai_serialize_object_id(objectId), callback);
+}
+
+async_ticket_t RedisRemoteSaiInterface::setAsync(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ const sai_attribute_t *attr,
+        _In_ AsyncOperationQueue::Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    if (RedisRemoteSaiInterface::isRedisAttribute(objectType, attr))
+    {
+        // extension attributes are processed locally
+
+        return m_asyncOperations->complete(setRedisExtensionAttribute(objectType, objectId, attr), callback);
+    }
+
+    if (objectType != SAI_OBJECT_TYPE_SWITCH)
+    {
+        return setAsync(objectType, sai_serialize_object_id(objectId), attr, callback);
+    }
+
+    // notification pointers are values, so shallow copy is enough
+
+    sai_attribute_t notificationAttr = *attr;
+
+    return setAsync(
+            objectType,
+            sai_serialize_object_id(objectId),
+            attr,
+            [this, objectId, notificationAttr, callback](sai_status_t status) {
+
+                if (status == SAI_STATUS_SUCCESS)
+                {
+                    auto sw = m_switchContainer->getSwitch(objectId);
+
+                    if (!sw)
+                    {
+                        SWSS_LOG_THROW("failed to find switch %s in container",
+                                sai_serialize_object_id(objectId).c_str());
+                    }
+
+                    /*
+                     * When doing SET operation user may want to update notification
+                     * pointers.
+                     */
+
+                    sw->updateNotifications(1, &notificationAttr);
+                }
+
+                if (callback)
+                {
+                    callback(status);
+                }
+            });
+}
+
+async_ticket_t RedisRemoteSaiInterface::createAsync(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::string& serializedObjectId,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ AsyncOperationQueue::Callback callback)
+{
+    SWSS_LOG_ENTER();
+
     auto entry = SaiAttributeList::serialize_attr_list(
-            object_type,
+            objectType,
             attr_count,
             attr_list,
             false);
@@ -824,7 +1033,7 @@ sai_status_t RedisRemoteSaiInterface::create(
         entry.push_back(null);
     }
 
-    auto serializedObjectType = sai_serialize_object_type(object_type);
+    auto serializedObjectType = sai_serialize_object_type(objectType);
 
     const std::string key = serializedObjectType + ":" + serializedObjectId;
 
@@ -834,16 +1043,21 @@ sai_status_t RedisRemoteSaiInterface::create(
 
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
 
-    auto status = waitForResponse(SAI_COMMON_API_CREATE);
+    return submitAsync(SAI_COMMON_API_CREATE, [this, callback](sai_status_t status) {
 
-    m_recorder->recordGenericCreateResponse(status);
+            m_recorder->recordGenericCreateResponse(status);
 
-    return status;
+            if (callback)
+            {
+                callback(status);
+            }
+        });
 }
 
-sai_status_t RedisRemoteSaiInterface::remove(
+async_ticket_t RedisRemoteSaiInterface::removeAsync(
         _In_ sai_object_type_t objectType,
-        _In_ const std::string& serializedObjectId)
+        _In_ const std::string& serializedObjectId,
+        _In_ AsyncOperationQueue::Callback callback)
 {
     SWSS_LOG_ENTER();
 
@@ -857,17 +1071,22 @@ sai_status_t RedisRemoteSaiInterface::remove(
 
     m_communicationChannel->del(key, REDIS_ASIC_STATE_COMMAND_REMOVE);
 
-    auto status = waitForResponse(SAI_COMMON_API_REMOVE);
+    return submitAsync(SAI_COMMON_API_REMOVE, [this, callback](sai_status_t status) {
 
-    m_recorder->recordGenericRemoveResponse(status);
+            m_recorder->recordGenericRemoveResponse(status);
 
-    return status;
+            if (callback)
+            {
+                callback(status);
+            }
+        });
 }
 
-sai_status_t RedisRemoteSaiInterface::set(
+async_ticket_t RedisRemoteSaiInterface::setAsync(
         _In_ sai_object_type_t objectType,
-        _In_ const std::string &serializedObjectId,
-        _In_ const sai_attribute_t *attr)
+        _In_ const std::string& serializedObjectId,
+        _In_ const sai_attribute_t *attr,
+        _In_ AsyncOperationQueue::Callback callback)
 {
     SWSS_LOG_ENTER();
 
@@ -887,35 +1106,253 @@ sai_status_t RedisRemoteSaiInterface::set(
 
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
 
-    auto status = waitForResponse(SAI_COMMON_API_SET);
+    return submitAsync(SAI_COMMON_API_SET, [this, callback](sai_status_t status) {
 
-    m_recorder->recordGenericSetResponse(status);
+            m_recorder->recordGenericSetResponse(status);
 
-    return status;
+            if (callback)
+            {
+                callback(status);
+            }
+        });
 }
 
-sai_status_t RedisRemoteSaiInterface::waitForResponse(
-        _In_ sai_common_api_t api)
+async_ticket_t RedisRemoteSaiInterface::submitAsync(
+        _In_ sai_common_api_t api,
+        _In_ AsyncOperationQueue::Callback callback)
 {
     SWSS_LOG_ENTER();
 
-    if (m_syncMode)
+    auto ticket = m_asyncOperations->push(api, callback);
+
+    if (!m_syncMode)
+    {
+        /*
+         * By default sync mode is disabled and all create/set/remove are
+         * considered success operations.
+         */
+
+        m_asyncOperations->completeFront(SAI_STATUS_SUCCESS);
+    }
+    else if (!m_communicationChannel->isPipelineSupported())
+    {
+        // next request can't be sent until response is received
+
+        processAsyncResponse();
+    }
+
+    return ticket;
+}
+
+void RedisRemoteSaiInterface::processAsyncResponse()
+{
+    SWSS_LOG_ENTER();
+
+    if (!discardLateResponses())
+    {
+        // responses to operations in flight are behind late responses
+
+        failAsyncOperations();
+
+        return;
+    }
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+
+    m_recorder->recordGenericResponse(status);
+
+    if (kfvOp(kco) != REDIS_ASIC_STATE_COMMAND_GETRESPONSE)
+    {
+        // channel returns without response only on timeout
+
+        failAsyncOperations();
+
+        return;
+    }
+
+    m_asyncOperations->completeFront(status);
+}
+
+void RedisRemoteSaiInterface::failAsyncOperations()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_ERROR("response timeout, failing %zu asynchronous operations, %zu late responses will be discarded",
+            m_asyncOperations->size(),
+            m_lateResponses + m_asyncOperations->size());
+
+    m_lateResponses += m_asyncOperations->size();
+
+    m_failingAsyncOperations = true;
+
+    m_asyncOperations->completeAll(SAI_STATUS_FAILURE);
+
+    m_failingAsyncOperations = false;
+}
+
+bool RedisRemoteSaiInterface::discardLateResponses()
+{
+    SWSS_LOG_ENTER();
+
+    while (m_lateResponses)
     {
         swss::KeyOpFieldsValuesTuple kco;
 
-        auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+        m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
-        m_recorder->recordGenericResponse(status);
+        if (kfvOp(kco) != REDIS_ASIC_STATE_COMMAND_GETRESPONSE)
+        {
+            SWSS_LOG_ERROR("still waiting for %zu late responses", m_lateResponses);
 
-        return status;
+            return false;
+        }
+
+        SWSS_LOG_WARN("discarding late response: %s", kfvKey(kco).c_str());
+
+        m_lateResponses--;
     }
 
-    /*
-     * By default sync mode is disabled and all create/set/remove are
-     * considered success operations.
-     */
+    return true;
+}
 
-    return SAI_STATUS_SUCCESS;
+sai_status_t RedisRemoteSaiInterface::waitAsync(
+        _In_ const async_ticket_t& ticket)
+{
+    SWSS_LOG_ENTER();
+
+    while (!AsyncOperationQueue::isCompleted(ticket))
+    {
+        if (m_asyncOperations->empty())
+        {
+            SWSS_LOG_THROW("asynchronous operation %" PRIu64 " is not in flight", ticket.id);
+        }
+
+        processAsyncResponse();
+    }
+
+    return ticket.status.get();
+}
+
+size_t RedisRemoteSaiInterface::pollAsync()
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
+
+    while (!m_asyncOperations->empty() && m_communicationChannel->isResponseAvailable())
+    {
+        processAsyncResponse();
+
+        count++;
+    }
+
+    return count;
+}
+
+void RedisRemoteSaiInterface::waitForAsyncOperations()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_asyncOperations->size())
+    {
+        SWSS_LOG_INFO("waiting for %zu asynchronous operations", m_asyncOperations->size());
+    }
+
+    while (!m_asyncOperations->empty())
+    {
+        processAsyncResponse();
+    }
+}
+
+size_t RedisRemoteSaiInterface::getAsyncOperationCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_asyncOperations->size();
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForChannelResponse(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    waitForAsyncOperations();
+
+    if (command == REDIS_ASIC_STATE_COMMAND_GETRESPONSE && !discardLateResponses())
+    {
+        // response to this request is behind late responses
+
+        m_lateResponses++;
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    auto status = m_communicationChannel->wait(command, kco);
+
+    if (command == REDIS_ASIC_STATE_COMMAND_GETRESPONSE && kfvOp(kco) != command)
+    {
+        // late response would be taken as response to next request
+
+        m_lateResponses++;
+    }
+
+    return status;
+}
+
+sai_status_t RedisRemoteSaiInterface::executeReadOnlyRequest(
+        _In_ const std::function<void()>& send,
+        _In_ const std::function<sai_status_t()>& wait)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_communicationChannel->isPipelineSupported())
+    {
+        std::lock_guard<std::mutex> lock(m_readOnlySendMutex);
+
+        send();
+
+        return wait();
+    }
+
+    uint64_t ticket;
+
+    {
+        std::lock_guard<std::mutex> lock(m_readOnlySendMutex);
+
+        send();
+
+        ticket = m_readOnlyTicket++;
+    }
+
+    // responses arrive in order of requests
+
+    std::unique_lock<std::mutex> lock(m_readOnlyWaitMutex);
+
+    m_readOnlyWaitCond.wait(lock, [&]() { return m_readOnlyServedTicket == ticket; });
+
+    sai_status_t status = SAI_STATUS_FAILURE;
+
+    try
+    {
+        status = wait();
+    }
+    catch (const std::exception&)
+    {
+        m_readOnlyServedTicket++;
+
+        m_readOnlyWaitCond.notify_all();
+
+        throw;
+    }
+
+    m_readOnlyServedTicket++;
+
+    m_readOnlyWaitCond.notify_all();
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
@@ -927,7 +1364,7 @@ sai_status_t RedisRemoteSaiInterface::waitForGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     auto &values = kfvFieldsValues(kco);
 
@@ -1025,7 +1462,7 @@ sai_status_t RedisRemoteSaiInterface::waitForFlushFdbEntriesResponse()
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE, kco);
 
     return status;
 }
@@ -1084,18 +1521,22 @@ sai_status_t RedisRemoteSaiInterface::objectTypeGetAvailability(
 
     // Syncd will pop this argument off before trying to deserialize the attribute list
 
-    m_recorder->recordObjectTypeGetAvailability(switchId, objectType, attrCount, attrList);
-    // recordObjectTypeGetAvailability(strSwitchId, entry);
+    return executeReadOnlyRequest(
+            [&]() {
+                m_recorder->recordObjectTypeGetAvailability(switchId, objectType, attrCount, attrList);
+                // recordObjectTypeGetAvailability(strSwitchId, entry);
 
-    // This query will not put any data into the ASIC view, just into the
-    // message queue
-    m_communicationChannel->set(strSwitchId, entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY);
-
-    auto status = waitForObjectTypeGetAvailabilityResponse(count);
+                // This query will not put any data into the ASIC view, just into the
+                // message queue
+                m_communicationChannel->set(strSwitchId, entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY);
+            },
+            [&]() {
+                auto status = waitForObjectTypeGetAvailabilityResponse(count);
 
-    m_recorder->recordObjectTypeGetAvailabilityResponse(status, count);
+                m_recorder->recordObjectTypeGetAvailabilityResponse(status, count);
 
-    return status;
+                return status;
+            });
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForObjectTypeGetAvailabilityResponse(
@@ -1105,7 +1546,7 @@ sai_status_t RedisRemoteSaiInterface::waitForObjectTypeGetAvailabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1163,15 +1604,19 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeCapability(
     // This query will not put any data into the ASIC view, just into the
     // message queue
 
-    m_recorder->recordQueryAttributeCapability(switchId, objectType, attrId, capability);
+    return executeReadOnlyRequest(
+            [&]() {
+                m_recorder->recordQueryAttributeCapability(switchId, objectType, attrId, capability);
 
-    m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
+                m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
+            },
+            [&]() {
+                auto status = waitForQueryAttributeCapabilityResponse(capability);
 
-    auto status = waitForQueryAttributeCapabilityResponse(capability);
+                m_recorder->recordQueryAttributeCapabilityResponse(status, objectType, attrId, capability);
 
-    m_recorder->recordQueryAttributeCapabilityResponse(status, objectType, attrId, capability);
-
-    return status;
+                return status;
+            });
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeCapabilityResponse(
@@ -1181,7 +1626,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeCapabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1252,15 +1697,19 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeEnumValuesCapability(
     // This query will not put any data into the ASIC view, just into the
     // message queue
 
-    m_recorder->recordQueryAttributeEnumValuesCapability(switchId, objectType, attrId, enumValuesCapability);
-
-    m_communicationChannel->set(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY);
+    return executeReadOnlyRequest(
+            [&]() {
+                m_recorder->recordQueryAttributeEnumValuesCapability(switchId, objectType, attrId, enumValuesCapability);
 
-    auto status = waitForQueryAttributeEnumValuesCapabilityResponse(enumValuesCapability);
+                m_communicationChannel->set(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY);
+            },
+            [&]() {
+                auto status = waitForQueryAttributeEnumValuesCapabilityResponse(enumValuesCapability);
 
-    m_recorder->recordQueryAttributeEnumValuesCapabilityResponse(status, objectType, attrId, enumValuesCapability);
+                m_recorder->recordQueryAttributeEnumValuesCapabilityResponse(status, objectType, attrId, enumValuesCapability);
 
-    return status;
+                return status;
+            });
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityResponse(
@@ -1270,7 +1719,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryAttributeEnumValuesCapabilityR
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1355,9 +1804,9 @@ sai_status_t RedisRemoteSaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
-    m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
-
-    return waitForGetStatsResponse(number_of_counters, counters);
+    return executeReadOnlyRequest(
+            [&]() { m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS); },
+            [&]() { return waitForGetStatsResponse(number_of_counters, counters); });
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForGetStatsResponse(
@@ -1368,7 +1817,7 @@ sai_status_t RedisRemoteSaiInterface::waitForGetStatsResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1432,15 +1881,19 @@ sai_status_t RedisRemoteSaiInterface::queryStatsCapability(
     // This query will not put any data into the ASIC view, just into the
     // message queue
 
-    m_recorder->recordQueryStatsCapability(switchId, objectType, stats_capability);
+    return executeReadOnlyRequest(
+            [&]() {
+                m_recorder->recordQueryStatsCapability(switchId, objectType, stats_capability);
 
-    m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY);
+                m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY);
+            },
+            [&]() {
+                auto status = waitForQueryStatsCapabilityResponse(stats_capability);
 
-    auto status = waitForQueryStatsCapabilityResponse(stats_capability);
+                m_recorder->recordQueryStatsCapabilityResponse(status, objectType, stats_capability);
 
-    m_recorder->recordQueryStatsCapabilityResponse(status, objectType, stats_capability);
-
-    return status;
+                return status;
+            });
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForQueryStatsCapabilityResponse(
@@ -1450,7 +1903,7 @@ sai_status_t RedisRemoteSaiInterface::waitForQueryStatsCapabilityResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE, kco);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -1584,7 +2037,7 @@ sai_status_t RedisRemoteSaiInterface::waitForClearStatsResponse()
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     return status;
 }
@@ -1642,7 +2095,7 @@ sai_status_t RedisRemoteSaiInterface::waitForBulkResponse(
     {
         swss::KeyOpFieldsValuesTuple kco;
 
-        auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+        auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
         auto &values = kfvFieldsValues(kco);
 
@@ -1687,7 +2140,7 @@ sai_status_t RedisRemoteSaiInterface::waitForBulkGetResponse(
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    const auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+    const auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
 
     const auto &values = kfvFieldsValues(kco);
 
@@ -1797,29 +2250,23 @@ sai_status_t RedisRemoteSaiInterface::bulkSet(
 
     // TODO support mode
 
-    std::vector<swss::FieldValueTuple> entries;
+    std::vector<std::vector<swss::FieldValueTuple>> objectAttributes;
+
+    objectAttributes.reserve(serialized_object_ids.size());
 
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
     {
-        auto entry = SaiAttributeList::serialize_attr_list(object_type, 1, &attr_list[idx], false);
-
-        std::string str_attr = Globals::joinFieldValues(entry);
-
-        swss::FieldValueTuple value(serialized_object_ids[idx], str_attr);
-
-        entries.push_back(value);
+        objectAttributes.push_back(SaiAttributeList::serialize_attr_list(object_type, 1, &attr_list[idx], false));
     }
 
-    /*
-     * We are adding number of entries to actually add ':' to be compatible
-     * with previous
-     */
-
     auto serializedObjectType = sai_serialize_object_type(object_type);
 
-    std::string key = serializedObjectType + ":" + std::to_string(entries.size());
+    std::vector<swss::FieldValueTuple> entries;
+    std::vector<swss::FieldValueTuple> recordEntries;
+
+    std::string key = serializeBulk(serializedObjectType, serialized_object_ids, std::move(objectAttributes), entries, recordEntries);
 
-    m_recorder->recordBulkGenericSet(serializedObjectType, entries);
+    m_recorder->recordBulkGenericSet(serializedObjectType, recordEntries.empty() ? entries : recordEntries);
 
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_SET);
 
@@ -1860,8 +2307,9 @@ sai_status_t RedisRemoteSaiInterface::bulkGet(
 
     const auto serializedObjectType = sai_serialize_object_type(object_type);
 
-    std::vector<swss::FieldValueTuple> entries;
-    entries.reserve(serialized_object_ids.size());
+    std::vector<std::vector<swss::FieldValueTuple>> objectAttributes;
+
+    objectAttributes.reserve(serialized_object_ids.size());
 
     for (size_t idx = 0; idx < serialized_object_ids.size(); idx++)
     {
@@ -1873,25 +2321,17 @@ sai_status_t RedisRemoteSaiInterface::bulkGet(
 
         Utils::clearOidValues(object_type, attr_count[idx], attr_list[idx]);
 
-        const auto entry = SaiAttributeList::serialize_attr_list(object_type, attr_count[idx], attr_list[idx], false);
-
-        const auto strAttr = Globals::joinFieldValues(entry);
-
-        swss::FieldValueTuple fvt(serialized_object_ids[idx] , strAttr);
-
-        entries.push_back(fvt);
+        objectAttributes.push_back(SaiAttributeList::serialize_attr_list(object_type, attr_count[idx], attr_list[idx], false));
     }
 
-    /*
-     * We are adding number of entries to actually add ':' to be compatible
-     * with previous
-     */
+    std::vector<swss::FieldValueTuple> entries;
+    std::vector<swss::FieldValueTuple> recordEntries;
 
-    const auto key = serializedObjectType + ":" + std::to_string(entries.size());
+    const auto key = serializeBulk(serializedObjectType, serialized_object_ids, std::move(objectAttributes), entries, recordEntries);
 
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_GET);
 
-    m_recorder->recordBulkGenericGet(serializedObjectType, entries);
+    m_recorder->recordBulkGenericGet(serializedObjectType, recordEntries.empty() ? entries : recordEntries);
 
     const auto object_count = static_cast<uint32_t>(serialized_object_ids.size());
 
@@ -1960,7 +2400,9 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
 
     std::string str_object_type = sai_serialize_object_type(object_type);
 
-    std::vector<swss::FieldValueTuple> entries;
+    std::vector<std::vector<swss::FieldValueTuple>> objectAttributes;
+
+    objectAttributes.reserve(serialized_object_ids.size());
 
     for (size_t idx = 0; idx < serialized_object_ids.size(); ++idx)
     {
@@ -1975,30 +2417,65 @@ sai_status_t RedisRemoteSaiInterface::bulkCreate(
             entry.push_back(null);
         }
 
-        std::string str_attr = Globals::joinFieldValues(entry);
-
-        swss::FieldValueTuple fvtNoStatus(serialized_object_ids[idx] , str_attr);
-
-        entries.push_back(fvtNoStatus);
+        objectAttributes.push_back(std::move(entry));
     }
 
-    /*
-     * We are adding number of entries to actually add ':' to be compatible
-     * with previous
-     */
+    std::vector<swss::FieldValueTuple> entries;
+    std::vector<swss::FieldValueTuple> recordEntries;
 
-    // key:         object_type:count
-    // field:       object_id
-    // value:       object_attrs
-    std::string key = str_object_type + ":" + std::to_string(entries.size());
+    std::string key = serializeBulk(str_object_type, serialized_object_ids, std::move(objectAttributes), entries, recordEntries);
 
-    m_recorder->recordBulkGenericCreate(str_object_type, entries);
+    m_recorder->recordBulkGenericCreate(str_object_type, recordEntries.empty() ? entries : recordEntries);
 
     m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
 
     return waitForBulkResponse(SAI_COMMON_API_BULK_CREATE, (uint32_t)serialized_object_ids.size(), object_statuses);
 }
 
+std::string RedisRemoteSaiInterface::serializeBulk(
+        _In_ const std::string& serializedObjectType,
+        _In_ const std::vector<std::string>& serializedObjectIds,
+        _In_ std::vector<std::vector<swss::FieldValueTuple>>&& objectAttributes,
+        _Out_ std::vector<swss::FieldValueTuple>& entries,
+        _Out_ std::vector<swss::FieldValueTuple>& recordEntries)
+{
+    SWSS_LOG_ENTER();
+
+    entries.clear();
+    recordEntries.clear();
+
+    bool fieldsEncoding = m_syncMode;
+
+    if (!fieldsEncoding)
+    {
+        // field:       object_id
+        // value:       object_attrs
+
+        entries.reserve(serializedObjectIds.size());
+
+        for (size_t idx = 0; idx < serializedObjectIds.size(); ++idx)
+        {
+            entries.emplace_back(serializedObjectIds[idx], Globals::joinFieldValues(objectAttributes[idx]));
+        }
+
+        return Globals::getBulkKey(serializedObjectType, serializedObjectIds.size(), false);
+    }
+
+    bool record = m_recorder->isRecordingEnabled();
+
+    for (size_t idx = 0; idx < serializedObjectIds.size(); ++idx)
+    {
+        if (record)
+        {
+            recordEntries.emplace_back(serializedObjectIds[idx], Globals::joinFieldValues(objectAttributes[idx]));
+        }
+
+        Globals::appendBulkFields(entries, serializedObjectIds[idx], std::move(objectAttributes[idx]));
+    }
+
+    return Globals::getBulkKey(serializedObjectType, serializedObjectIds.size(), true);
+}
+
 sai_status_t RedisRemoteSaiInterface::notifySyncd(
         _In_ sai_object_id_t switchId,
         _In_ sai_redis_notify_syncd_t redisNotifySyncd)
@@ -2038,7 +2515,7 @@ sai_status_t RedisRemoteSaiInterface::waitForNotifySyncdResponse()
 
     swss::KeyOpFieldsValuesTuple kco;
 
-    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_NOTIFY, kco);
+    auto status = waitForChannelResponse(REDIS_ASIC_STATE_COMMAND_NOTIFY, kco);
 
     return status;
 }
@@ -9,6 +9,7 @@
 #include "RedisChannel.h"
 #include "SwitchConfigContainer.h"
 #include "ContextConfig.h"
+#include "AsyncOperationQueue.h"
 
 #include "meta/Notification.h"
 
@@ -20,6 +21,8 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <condition_variable>
 
 namespace sairedis
 {
@@ -230,6 +233,100 @@ namespace sairedis
             bool containsSwitch(
                     _In_ sai_object_id_t switchId) const;
 
+        public: // asynchronous QUAD API
+
+            /*
+             * Asynchronous create/remove/set only send request and return
+             * ticket. Many operations can be in flight at once when
+             * communication channel supports pipelined requests, otherwise
+             * each operation is completed before submit returns.
+             *
+             * Operation is completed when its response is processed by
+             * waitAsync, pollAsync or by any blocking API call (responses are
+             * received in order of requests). Completion callback is executed
+             * from inside of those calls and must not call this interface.
+             */
+
+            /**
+             * @brief Submit object create.
+             *
+             * Object id is allocated and returned immediately, and released
+             * when operation fails. Switch can't be created asynchronously.
+             */
+            async_ticket_t createAsync(
+                    _In_ sai_object_type_t objectType,
+                    _Out_ sai_object_id_t* objectId,
+                    _In_ sai_object_id_t switchId,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            /**
+             * @brief Submit object remove.
+             *
+             * Switch can't be removed asynchronously.
+             */
+            async_ticket_t removeAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            async_ticket_t setAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ const sai_attribute_t *attr,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            /**
+             * @brief Submit entry create, entry is serialized using
+             * sai_serialize_<entry> function.
+             */
+            async_ticket_t createAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t *attr_list,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            async_ticket_t removeAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            async_ticket_t setAsync(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::string& serializedObjectId,
+                    _In_ const sai_attribute_t *attr,
+                    _In_ AsyncOperationQueue::Callback callback = nullptr);
+
+            /**
+             * @brief Wait until operation is completed.
+             *
+             * Operations submitted before given one are completed as well.
+             *
+             * @return Operation status.
+             */
+            sai_status_t waitAsync(
+                    _In_ const async_ticket_t& ticket);
+
+            /**
+             * @brief Complete operations which responses were already
+             * received, without blocking.
+             *
+             * @return Number of completed operations.
+             */
+            size_t pollAsync();
+
+            /**
+             * @brief Wait until all submitted operations are completed.
+             */
+            void waitForAsyncOperations();
+
+            /**
+             * @brief Number of operations which are not completed.
+             */
+            size_t getAsyncOperationCount() const;
+
         private: // QUAD API helpers
 
             sai_status_t create(
@@ -284,17 +381,88 @@ namespace sairedis
                     _In_ sai_bulk_op_error_mode_t mode,
                     _Out_ sai_status_t *object_statuses);
 
-        private: // QUAD API response
+            /**
+             * @brief Serialize bulk objects attributes.
+             *
+             * In synchronous mode syncd is updating redis database by itself,
+             * so fields encoding is used, otherwise consumer table LUA script
+             * requires joined encoding. Recorder always gets joined entries,
+             * so recordings format is not changed, but they are only created
+             * when recording is enabled.
+             *
+             * @return Bulk key to send.
+             */
+            std::string serializeBulk(
+                    _In_ const std::string& serializedObjectType,
+                    _In_ const std::vector<std::string>& serializedObjectIds,
+                    _In_ std::vector<std::vector<swss::FieldValueTuple>>&& objectAttributes,
+                    _Out_ std::vector<swss::FieldValueTuple>& entries,
+                    _Out_ std::vector<swss::FieldValueTuple>& recordEntries);
+
+        private: // asynchronous QUAD API
+
+            /**
+             * @brief Queue operation which request was sent.
+             */
+            async_ticket_t submitAsync(
+                    _In_ sai_common_api_t api,
+                    _In_ AsyncOperationQueue::Callback callback);
 
             /**
              * @brief Wait for response.
              *
-             * Will wait for response from syncd. Method used only for single
-             * object create/remove/set since they have common output which is
+             * Will wait for response from syncd and complete oldest
+             * asynchronous operation. Method used only for single object
+             * create/remove/set since they have common output which is
              * sai_status_t.
+             *
+             * When response is not received in time, all asynchronous
+             * operations are failed, see failAsyncOperations.
+             */
+            void processAsyncResponse();
+
+            /**
+             * @brief Fail all asynchronous operations after response timeout.
+             *
+             * Responses are matched to operations by order, so after timeout
+             * late response would complete wrong operation. All operations in
+             * flight are completed with failure, and their responses are
+             * discarded when they arrive. Object ids of failed creates are
+             * not released, since syncd may have created those objects.
+             */
+            void failAsyncOperations();
+
+            /**
+             * @brief Discard late responses of operations which timed out.
+             *
+             * @return True if all late responses were received.
+             */
+            bool discardLateResponses();
+
+            /**
+             * @brief Wait for response of non asynchronous API.
+             *
+             * All asynchronous operations are completed first, since their
+             * responses are received before response to this request.
+             */
+            sai_status_t waitForChannelResponse(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            /**
+             * @brief Execute read only request (stats and capability query).
+             *
+             * Read only apis can be called by multiple threads at the same
+             * time. When channel supports pipeline, request is sent right
+             * away and response is awaited after responses of all requests
+             * sent before it, so requests of multiple threads are in flight
+             * at the same time instead of executed one by one.
              */
-            sai_status_t waitForResponse(
-                    _In_ sai_common_api_t api);
+            sai_status_t executeReadOnlyRequest(
+                    _In_ const std::function<void()>& send,
+                    _In_ const std::function<sai_status_t()>& wait);
+
+        private: // QUAD API response
 
             /**
              * @brief Wait for GET response.
@@ -450,8 +618,36 @@ namespace sairedis
 
             std::shared_ptr<Channel> m_communicationChannel;
 
+            std::shared_ptr<AsyncOperationQueue> m_asyncOperations;
+
+            /**
+             * @brief Number of responses which will arrive after timeout.
+             */
+            size_t m_lateResponses;
+
+            /**
+             * @brief Indicates that operations are failed after timeout.
+             */
+            bool m_failingAsyncOperations;
+
             uint64_t m_responseTimeoutMs;
 
+            std::mutex m_readOnlySendMutex;
+
+            std::mutex m_readOnlyWaitMutex;
+
+            std::condition_variable m_readOnlyWaitCond;
+
+            /**
+             * @brief Ticket of next read only request sent to channel.
+             */
+            uint64_t m_readOnlyTicket;
+
+            /**
+             * @brief Ticket of read only request which is awaiting response.
+             */
+            uint64_t m_readOnlyServedTicket;
+
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
             std::map<sai_object_id_t, swss::TableDump> m_tableDump;
@@ -11,6 +11,86 @@
 using namespace sairedis;
 using namespace std::placeholders;
 
+#undef MUTEX
+#undef MUTEX_UNLOCK
+
+#define MUTEX() ApiLock _lock(m_apimutex, false)
+#define READ_ONLY_MUTEX() ApiLock _lock(m_apimutex, true)
+#define MUTEX_UNLOCK() _lock.unlock()
+
+/*
+ * Number of api locks held by current thread, api can be entered again by the
+ * same thread (it was guarded by recursive mutex), so only outer call takes
+ * the lock.
+ */
+static thread_local int g_apiLockDepth = 0;
+
+namespace
+{
+    class ApiLock
+    {
+        public:
+
+            ApiLock(
+                    _In_ std::shared_timed_mutex& mutex,
+                    _In_ bool shared):
+                m_mutex(mutex),
+                m_shared(shared),
+                m_locked(false),
+                m_released(false)
+            {
+                SWSS_LOG_ENTER();
+
+                if (g_apiLockDepth++ == 0)
+                {
+                    if (m_shared)
+                        m_mutex.lock_shared();
+                    else
+                        m_mutex.lock();
+
+                    m_locked = true;
+                }
+            }
+
+            ~ApiLock()
+            {
+                SWSS_LOG_ENTER();
+
+                unlock();
+            }
+
+            void unlock()
+            {
+                SWSS_LOG_ENTER();
+
+                if (m_released)
+                    return;
+
+                m_released = true;
+
+                g_apiLockDepth--;
+
+                if (!m_locked)
+                    return;
+
+                if (m_shared)
+                    m_mutex.unlock_shared();
+                else
+                    m_mutex.unlock();
+            }
+
+        private:
+
+            std::shared_timed_mutex& m_mutex;
+
+            bool m_shared;
+
+            bool m_locked;
+
+            bool m_released;
+    };
+}
+
 #define REDIS_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
@@ -344,7 +424,7 @@ sai_status_t Sai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -362,7 +442,7 @@ sai_status_t Sai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
@@ -381,7 +461,7 @@ sai_status_t Sai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -665,7 +745,7 @@ sai_status_t Sai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switchId);
@@ -684,7 +764,7 @@ sai_status_t Sai::queryAttributeCapability(
         _In_ sai_attr_id_t attr_id,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -702,7 +782,7 @@ sai_status_t Sai::queryAttributeEnumValuesCapability(
         _In_ sai_attr_id_t attr_id,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
+    READ_ONLY_MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -12,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <map>
 
 namespace sairedis
@@ -201,7 +202,14 @@ namespace sairedis
 
             bool m_apiInitialized;
 
-            std::recursive_mutex m_apimutex;
+            /**
+             * @brief Api reader/writer lock.
+             *
+             * Stats and capability queries don't modify metadata database,
+             * so they take lock shared and can be executed by multiple
+             * threads at the same time, all other apis take it exclusively.
+             */
+            std::shared_timed_mutex m_apimutex;
 
             std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
 
@@ -57,9 +57,18 @@ std::shared_ptr<ServerConfig> ServerConfig::loadFromFile(
         cc->m_zmqEndpoint = j["zmq_endpoint"];
         cc->m_zmqNtfEndpoint = j["zmq_ntf_endpoint"];
 
-        SWSS_LOG_NOTICE("server config: %s, %s",
+        if (j.find("zmq_client_endpoints") != j.end())
+        {
+            for (auto& endpoint: j["zmq_client_endpoints"])
+            {
+                cc->m_zmqClientEndpoints.push_back(endpoint);
+            }
+        }
+
+        SWSS_LOG_NOTICE("server config: %s, %s, client endpoints: %zu",
                 cc->m_zmqEndpoint.c_str(),
-                cc->m_zmqNtfEndpoint.c_str());
+                cc->m_zmqNtfEndpoint.c_str(),
+                cc->m_zmqClientEndpoints.size());
 
         SWSS_LOG_NOTICE("loaded %s server config", path);
 
@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace sairedis
 {
@@ -25,5 +26,13 @@ namespace sairedis
             std::string m_zmqEndpoint;
 
             std::string m_zmqNtfEndpoint;
+
+            /**
+             * @brief Additional client endpoints.
+             *
+             * Each endpoint is served by separate server thread, so auxiliary
+             * clients can talk to server without waiting for primary client.
+             */
+            std::vector<std::string> m_zmqClientEndpoints;
     };
 }
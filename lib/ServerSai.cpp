@@ -6,11 +6,11 @@
 
 #include "meta/sai_serialize.h"
 #include "meta/SaiAttributeList.h"
+#include "meta/Globals.h"
 #include "meta/ZeroMQSelectableChannel.h"
 
 #include "swss/logger.h"
 #include "swss/select.h"
-#include "swss/tokenize.h"
 
 #include <iterator>
 #include <algorithm>
@@ -89,15 +89,29 @@ sai_status_t ServerSai::apiInitialize(
 
         auto cc = ServerConfig::loadFromFile(serverConfig);
 
-        m_selectableChannel = std::make_shared<ZeroMQSelectableChannel>(cc->m_zmqEndpoint);
+        // first channel is primary client channel
 
-        SWSS_LOG_NOTICE("starting server thread");
+        std::vector<std::string> endpoints = { cc->m_zmqEndpoint };
 
-        m_runServerThread = true;
+        endpoints.insert(endpoints.end(), cc->m_zmqClientEndpoints.begin(), cc->m_zmqClientEndpoints.end());
+
+        for (auto& endpoint: endpoints)
+        {
+            m_selectableChannels.push_back(std::make_shared<ZeroMQSelectableChannel>(endpoint));
 
-        m_serverThread = std::make_shared<std::thread>(&ServerSai::serverThreadFunction, this);
+            m_serverThreadShouldEndEvents.push_back(std::make_shared<swss::SelectableEvent>());
+        }
 
         m_apiInitialized = true;
+
+        m_runServerThread = true;
+
+        for (size_t idx = 0; idx < endpoints.size(); idx++)
+        {
+            SWSS_LOG_NOTICE("starting server thread for %s", endpoints[idx].c_str());
+
+            m_serverThreads.push_back(std::make_shared<std::thread>(&ServerSai::serverThreadFunction, this, idx));
+        }
     }
 
     return status;
@@ -112,17 +126,29 @@ sai_status_t ServerSai::apiUninitialize(void)
 
     m_apiInitialized = false;
 
-    if (m_serverThread)
+    if (m_serverThreads.size())
     {
-        SWSS_LOG_NOTICE("end server thread begin");
+        SWSS_LOG_NOTICE("end server threads begin");
 
         m_runServerThread = false;
 
-        m_serverThreadThreadShouldEndEvent.notify();
+        for (auto& event: m_serverThreadShouldEndEvents)
+        {
+            event->notify();
+        }
+
+        for (auto& thread: m_serverThreads)
+        {
+            thread->join();
+        }
+
+        m_serverThreads.clear();
+
+        m_serverThreadShouldEndEvents.clear();
 
-        m_serverThread->join();
+        m_selectableChannels.clear();
 
-        SWSS_LOG_NOTICE("end server thread end");
+        SWSS_LOG_NOTICE("end server threads end");
     }
 
     m_sai = nullptr;
@@ -671,16 +697,20 @@ sai_status_t ServerSai::queryApiVersion(
     return m_sai->queryApiVersion(version);
 }
 
-void ServerSai::serverThreadFunction()
+void ServerSai::serverThreadFunction(
+        _In_ size_t index)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_NOTICE("begin");
+    SWSS_LOG_NOTICE("begin %zu", index);
+
+    auto& channel = *m_selectableChannels.at(index);
+    auto& shouldEndEvent = *m_serverThreadShouldEndEvents.at(index);
 
     swss::Select s;
 
-    s.addSelectable(m_selectableChannel.get());
-    s.addSelectable(&m_serverThreadThreadShouldEndEvent);
+    s.addSelectable(&channel);
+    s.addSelectable(&shouldEndEvent);
 
     while (m_runServerThread)
     {
@@ -688,7 +718,7 @@ void ServerSai::serverThreadFunction()
 
         int result = s.select(&sel);
 
-        if (sel == &m_serverThreadThreadShouldEndEvent)
+        if (sel == &shouldEndEvent)
         {
             // user requested end server thread
             break;
@@ -696,7 +726,7 @@ void ServerSai::serverThreadFunction()
 
         if (result == swss::Select::OBJECT)
         {
-            processEvent(*m_selectableChannel.get());
+            processEvent(channel);
         }
         else
         {
@@ -704,13 +734,25 @@ void ServerSai::serverThreadFunction()
         }
     }
 
-    SWSS_LOG_NOTICE("end");
+    SWSS_LOG_NOTICE("end %zu", index);
+}
+
+bool ServerSai::isReadOnlyOperation(
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    return op == REDIS_ASIC_STATE_COMMAND_GET
+        || op == REDIS_ASIC_STATE_COMMAND_GET_STATS
+        || op == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY
+        || op == REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY
+        || op == REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY
+        || op == REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY;
 }
 
 void ServerSai::processEvent(
         _In_ SelectableChannel& consumer)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
 
     if (!m_apiInitialized)
@@ -720,18 +762,37 @@ void ServerSai::processEvent(
         return;
     }
 
+    /*
+     * Lock is taken per request, not for entire queue, so requests from
+     * different client threads interleave. Read only requests don't take
+     * server lock at all. Underlying SAI takes its api lock shared for stats
+     * and capability queries, so those are executed concurrently and
+     * pipelined to syncd, get still takes it exclusively, since it can
+     * update metadata database.
+     */
+
     do
     {
         swss::KeyOpFieldsValuesTuple kco;
 
         consumer.pop(kco, false);
 
-        processSingleEvent(kco);
+        if (isReadOnlyOperation(kfvOp(kco)))
+        {
+            processSingleEvent(consumer, kco);
+
+            continue;
+        }
+
+        MUTEX();
+
+        processSingleEvent(consumer, kco);
     }
     while (!consumer.empty());
 }
 
 sai_status_t ServerSai::processSingleEvent(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -749,51 +810,52 @@ sai_status_t ServerSai::processSingleEvent(
     }
 
     if (op == REDIS_ASIC_STATE_COMMAND_CREATE)
-        return processQuadEvent(SAI_COMMON_API_CREATE, kco);
+        return processQuadEvent(channel, SAI_COMMON_API_CREATE, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_REMOVE)
-        return processQuadEvent(SAI_COMMON_API_REMOVE, kco);
+        return processQuadEvent(channel, SAI_COMMON_API_REMOVE, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_SET)
-        return processQuadEvent(SAI_COMMON_API_SET, kco);
+        return processQuadEvent(channel, SAI_COMMON_API_SET, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_GET)
-        return processQuadEvent(SAI_COMMON_API_GET, kco);
+        return processQuadEvent(channel, SAI_COMMON_API_GET, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_BULK_CREATE)
-        return processBulkQuadEvent(SAI_COMMON_API_BULK_CREATE, kco);
+        return processBulkQuadEvent(channel, SAI_COMMON_API_BULK_CREATE, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_BULK_REMOVE)
-        return processBulkQuadEvent(SAI_COMMON_API_BULK_REMOVE, kco);
+        return processBulkQuadEvent(channel, SAI_COMMON_API_BULK_REMOVE, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_BULK_SET)
-        return processBulkQuadEvent(SAI_COMMON_API_BULK_SET, kco);
+        return processBulkQuadEvent(channel, SAI_COMMON_API_BULK_SET, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_GET_STATS)
-        return processGetStatsEvent(kco);
+        return processGetStatsEvent(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_CLEAR_STATS)
-        return processClearStatsEvent(kco);
+        return processClearStatsEvent(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_FLUSH)
-        return processFdbFlush(kco);
+        return processFdbFlush(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY)
-        return processAttrCapabilityQuery(kco);
+        return processAttrCapabilityQuery(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY)
-        return processAttrEnumValuesCapabilityQuery(kco);
+        return processAttrEnumValuesCapabilityQuery(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY)
-        return processObjectTypeGetAvailabilityQuery(kco);
+        return processObjectTypeGetAvailabilityQuery(channel, kco);
 
     if (op == REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY)
-        return processStatsCapabilityQuery(kco);
+        return processStatsCapabilityQuery(channel, kco);
 
     SWSS_LOG_THROW("event op '%s' is not implemented, FIXME", op.c_str());
 }
 
 sai_status_t ServerSai::processQuadEvent(
+        _In_ SelectableChannel& channel,
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -877,11 +939,11 @@ sai_status_t ServerSai::processQuadEvent(
 
     if (api == SAI_COMMON_API_GET)
     {
-        sendGetResponse(metaKey.objecttype, strObjectId, status, attr_count, attr_list);
+        sendGetResponse(channel, metaKey.objecttype, strObjectId, status, attr_count, attr_list);
     }
     else if (status != SAI_STATUS_SUCCESS)
     {
-        sendApiResponse(api, status, oid);
+        sendApiResponse(channel, api, status, oid);
 
         SWSS_LOG_ERROR("api failed: %s (%s): %s",
                 key.c_str(),
@@ -895,13 +957,14 @@ sai_status_t ServerSai::processQuadEvent(
     }
     else // non GET api, status is SUCCESS
     {
-        sendApiResponse(api, status, oid);
+        sendApiResponse(channel, api, status, oid);
     }
 
     return status;
 }
 
 void ServerSai::sendApiResponse(
+        _In_ SelectableChannel& channel,
         _In_ sai_common_api_t api,
         _In_ sai_status_t status,
         _In_ sai_object_id_t oid)
@@ -936,10 +999,11 @@ void ServerSai::sendApiResponse(
             sai_serialize_common_api(api).c_str(),
             strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    channel.set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 }
 
 void ServerSai::sendGetResponse(
+        _In_ SelectableChannel& channel,
         _In_ sai_object_type_t objectType,
         _In_ const std::string& strObjectId,
         _In_ sai_status_t status,
@@ -998,7 +1062,7 @@ void ServerSai::sendGetResponse(
      * response will not put any data to table, only queue is used.
      */
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    channel.set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for GET api was send");
 }
@@ -1073,6 +1137,7 @@ sai_status_t ServerSai::processOid(
 }
 
 sai_status_t ServerSai::processBulkQuadEvent(
+        _In_ SelectableChannel& channel,
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -1085,49 +1150,17 @@ sai_status_t ServerSai::processBulkQuadEvent(
     sai_object_type_t objectType;
     sai_deserialize_object_type(strObjectType, objectType);
 
-    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
-
     std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
 
-    // field = objectId
-    // value = attrid=attrvalue|...
-
     std::vector<std::string> objectIds;
 
+    Globals::parseBulk(key, kfvFieldsValues(kco), objectIds, strAttributes);
+
     std::vector<std::shared_ptr<SaiAttributeList>> attributes;
 
-    for (const auto &fvt: values)
+    for (const auto& entries: strAttributes)
     {
-        std::string strObjectId = fvField(fvt);
-        std::string joined = fvValue(fvt);
-
-        // decode values
-
-        auto v = swss::tokenize(joined, '|');
-
-        objectIds.push_back(strObjectId);
-
-        std::vector<swss::FieldValueTuple> entries; // attributes per object id
-
-        for (size_t i = 0; i < v.size(); ++i)
-        {
-            const std::string item = v.at(i);
-
-            auto start = item.find_first_of("=");
-
-            auto field = item.substr(0, start);
-            auto value = item.substr(start + 1);
-
-            entries.emplace_back(field, value);
-        }
-
-        strAttributes.push_back(entries);
-
-        // since now we converted this to proper list, we can extract attributes
-
-        auto list = std::make_shared<SaiAttributeList>(objectType, entries, false);
-
-        attributes.push_back(list);
+        attributes.push_back(std::make_shared<SaiAttributeList>(objectType, entries, false));
     }
 
     SWSS_LOG_INFO("bulk %s executing with %zu items",
@@ -1138,15 +1171,16 @@ sai_status_t ServerSai::processBulkQuadEvent(
 
     if (info->isobjectid)
     {
-        return processBulkOid(objectType, objectIds, api, attributes, strAttributes);
+        return processBulkOid(channel, objectType, objectIds, api, attributes, strAttributes);
     }
     else
     {
-        return processBulkEntry(objectType, objectIds, api, attributes, strAttributes);
+        return processBulkEntry(channel, objectType, objectIds, api, attributes, strAttributes);
     }
 }
 
 sai_status_t ServerSai::processBulkOid(
+        _In_ SelectableChannel& channel,
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& strObjectIds,
         _In_ sai_common_api_t api,
@@ -1224,12 +1258,13 @@ sai_status_t ServerSai::processBulkOid(
             break;
     }
 
-    sendBulkApiResponse(api, status, (uint32_t)objectIds.size(), objectIds.data(), statuses.data());
+    sendBulkApiResponse(channel, api, status, (uint32_t)objectIds.size(), objectIds.data(), statuses.data());
 
     return status;
 }
 
 sai_status_t ServerSai::processBulkEntry(
+        _In_ SelectableChannel& channel,
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& objectIds,
         _In_ sai_common_api_t api,
@@ -1270,7 +1305,7 @@ sai_status_t ServerSai::processBulkEntry(
 
     std::vector<sai_object_id_t> oids(objectIds.size());
 
-    sendBulkApiResponse(api, status, (uint32_t)objectIds.size(), oids.data(), statuses.data());
+    sendBulkApiResponse(channel, api, status, (uint32_t)objectIds.size(), oids.data(), statuses.data());
 
     return status;
 }
@@ -1876,6 +1911,7 @@ sai_status_t ServerSai::processBulkSetEntry(
 }
 
 void ServerSai::sendBulkApiResponse(
+        _In_ SelectableChannel& channel,
         _In_ sai_common_api_t api,
         _In_ sai_status_t status,
         _In_ uint32_t object_count,
@@ -1920,10 +1956,11 @@ void ServerSai::sendBulkApiResponse(
             sai_serialize_common_api(api).c_str(),
             strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    channel.set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 }
 
 sai_status_t ServerSai::processAttrCapabilityQuery(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -1939,7 +1976,7 @@ sai_status_t ServerSai::processAttrCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+        channel.set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -1969,12 +2006,13 @@ sai_status_t ServerSai::processAttrCapabilityQuery(
             capability.create_implemented, capability.set_implemented, capability.get_implemented);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+    channel.set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processAttrEnumValuesCapabilityQuery(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -1990,7 +2028,7 @@ sai_status_t ServerSai::processAttrEnumValuesCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 3 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+        channel.set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2034,12 +2072,13 @@ sai_status_t ServerSai::processAttrEnumValuesCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: capabilities = '%s', count = %d", strCap.c_str(), enumCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+    channel.set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processObjectTypeGetAvailabilityQuery(
+        _In_ SelectableChannel& channel,
     _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -2083,12 +2122,13 @@ sai_status_t ServerSai::processObjectTypeGetAvailabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %lu", count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
+    channel.set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processStatsCapabilityQuery(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -2104,7 +2144,7 @@ sai_status_t ServerSai::processStatsCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+        channel.set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -2164,12 +2204,13 @@ sai_status_t ServerSai::processStatsCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %u", statCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+    channel.set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processFdbFlush(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -2194,12 +2235,13 @@ sai_status_t ServerSai::processFdbFlush(
 
     sai_status_t status = m_sai->flushFdbEntries(switchOid, attr_count, attr_list);
 
-    m_selectableChannel->set(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
+    channel.set(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processClearStatsEvent(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -2232,12 +2274,13 @@ sai_status_t ServerSai::processClearStatsEvent(
             (uint32_t)counter_ids.size(),
             counter_ids.data());
 
-    m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    channel.set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
 
 sai_status_t ServerSai::processGetStatsEvent(
+        _In_ SelectableChannel& channel,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
@@ -2291,7 +2334,7 @@ sai_status_t ServerSai::processGetStatsEvent(
         }
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    channel.set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace sairedis
 {
@@ -186,17 +187,23 @@ namespace sairedis
 
         private:
 
-            void serverThreadFunction();
+            void serverThreadFunction(
+                    _In_ size_t index);
+
+            static bool isReadOnlyOperation(
+                    _In_ const std::string& op);
 
             void processEvent(
                     _In_ SelectableChannel& consumer);
 
             sai_status_t processSingleEvent(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             // QUAD API
 
             sai_status_t processQuadEvent(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
@@ -215,11 +222,13 @@ namespace sairedis
                     _In_ sai_attribute_t *attr_list);
 
             void sendApiResponse(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_common_api_t api,
                     _In_ sai_status_t status,
                     _In_ sai_object_id_t oid);
 
             void sendGetResponse(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_object_type_t objectType,
                     _In_ const std::string& strObjectId,
                     _In_ sai_status_t status,
@@ -229,10 +238,12 @@ namespace sairedis
             // BULK API
 
             sai_status_t processBulkQuadEvent(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             sai_status_t processBulkOid(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string>& strObjectIds,
                     _In_ sai_common_api_t api,
@@ -240,6 +251,7 @@ namespace sairedis
                     _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
 
             sai_status_t processBulkEntry(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string>& objectIds,
                     _In_ sai_common_api_t api,
@@ -264,6 +276,7 @@ namespace sairedis
                     _Out_ std::vector<sai_status_t>& statuses);
 
             void sendBulkApiResponse(
+                    _In_ SelectableChannel& channel,
                     _In_ sai_common_api_t api,
                     _In_ sai_status_t status,
                     _In_ uint32_t object_count,
@@ -273,25 +286,31 @@ namespace sairedis
             // STATS API
 
             sai_status_t processGetStatsEvent(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             sai_status_t processClearStatsEvent(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             // NON QUAD API
 
             sai_status_t processFdbFlush(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             // QUERY API
 
             sai_status_t processAttrCapabilityQuery(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             sai_status_t processAttrEnumValuesCapabilityQuery(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
             sai_status_t processObjectTypeGetAvailabilityQuery(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
         private:
@@ -304,18 +323,23 @@ namespace sairedis
 
             sai_service_method_table_t m_service_method_table;
 
+            /**
+             * @brief Server threads, one per client channel.
+             */
+            std::vector<std::shared_ptr<std::thread>> m_serverThreads;
 
-            std::shared_ptr<std::thread> m_serverThread;
-
-
-            swss::SelectableEvent m_serverThreadThreadShouldEndEvent;
+            std::vector<std::shared_ptr<swss::SelectableEvent>> m_serverThreadShouldEndEvents;
 
         protected:
 
             sai_status_t processStatsCapabilityQuery(
+                    _In_ SelectableChannel& channel,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
-            std::shared_ptr<SelectableChannel> m_selectableChannel;
+            /**
+             * @brief Client channels, first one is primary client channel.
+             */
+            std::vector<std::shared_ptr<SelectableChannel>> m_selectableChannels;
 
             std::shared_ptr<SaiInterface> m_sai;
     };
@@ -0,0 +1,410 @@
+#include "ShmChannel.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace sairedis;
+
+#define SHM_CONNECT_RETRY_INTERVAL_MS 100
+
+#define SHM_REQUEST_RETRY_INTERVAL_US 10
+
+ShmChannel::ShmChannel(
+        _In_ const std::string& endpoint,
+        _In_ Channel::Callback callback):
+    Channel(callback),
+    m_endpoint(endpoint),
+    m_socket(-1),
+    m_memory(MAP_FAILED),
+    m_memorySize(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& fd: m_fds)
+    {
+        fd = -1;
+    }
+
+    connect();
+
+    // start thread
+
+    m_runNotificationThread = true;
+
+    SWSS_LOG_NOTICE("creating notification thread");
+
+    m_notificationThread = std::make_shared<std::thread>(&ShmChannel::notificationThreadFunction, this);
+}
+
+ShmChannel::~ShmChannel()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_notificationThread)
+    {
+        m_runNotificationThread = false;
+
+        // notify thread that it should end
+        m_notificationThreadShouldEndEvent.notify();
+
+        SWSS_LOG_NOTICE("join ntf thread begin");
+
+        m_notificationThread->join();
+
+        SWSS_LOG_NOTICE("join ntf thread end");
+    }
+
+    if (m_memory != MAP_FAILED)
+    {
+        munmap(m_memory, m_memorySize);
+    }
+
+    for (int fd: m_fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    if (m_socket >= 0)
+    {
+        close(m_socket);
+    }
+}
+
+void ShmChannel::connect()
+{
+    SWSS_LOG_ENTER();
+
+    sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    addr.sun_family = AF_UNIX;
+
+    if (m_endpoint.size() >= sizeof(addr.sun_path))
+    {
+        SWSS_LOG_THROW("endpoint path %s is too long", m_endpoint.c_str());
+    }
+
+    strncpy(addr.sun_path, m_endpoint.c_str(), sizeof(addr.sun_path) - 1);
+
+    SWSS_LOG_NOTICE("connecting to shm endpoint: %s", m_endpoint.c_str());
+
+    m_socket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+
+    if (m_socket < 0)
+    {
+        SWSS_LOG_THROW("socket failed: %s", strerror(errno));
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    // syncd may not be listening yet
+
+    while (::connect(m_socket, (sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        if ((errno != ENOENT && errno != ECONNREFUSED && errno != EINTR) || std::chrono::steady_clock::now() > deadline)
+        {
+            SWSS_LOG_THROW("failed to connect to shm endpoint %s: %s", m_endpoint.c_str(), strerror(errno));
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHM_CONNECT_RETRY_INTERVAL_MS));
+    }
+
+    uint64_t capacity = 0;
+
+    iovec iov;
+
+    iov.iov_base = &capacity;
+    iov.iov_len = sizeof(capacity);
+
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(m_fds))];
+
+        cmsghdr align;
+
+    } control;
+
+    memset(&control, 0, sizeof(control));
+
+    msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    pollfd pfd;
+
+    pfd.fd = m_socket;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    if (poll(&pfd, 1, (int)m_responseTimeoutMs) != 1)
+    {
+        SWSS_LOG_THROW("timed out waiting for descriptors from shm endpoint %s", m_endpoint.c_str());
+    }
+
+    ssize_t rc = recvmsg(m_socket, &msg, MSG_CMSG_CLOEXEC);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+    if (rc != (ssize_t)sizeof(capacity) ||
+            cmsg == nullptr ||
+            cmsg->cmsg_level != SOL_SOCKET ||
+            cmsg->cmsg_type != SCM_RIGHTS ||
+            cmsg->cmsg_len != CMSG_LEN(sizeof(m_fds)))
+    {
+        SWSS_LOG_THROW("invalid handshake message from shm endpoint %s", m_endpoint.c_str());
+    }
+
+    memcpy(m_fds, CMSG_DATA(cmsg), sizeof(m_fds));
+
+    size_t ringSize = ShmRing::getRequiredSize(capacity);
+
+    m_memorySize = 3 * ringSize;
+
+    m_memory = mmap(nullptr, m_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fds[SHM_CHANNEL_FD_MEMORY], 0);
+
+    if (m_memory == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("mmap of %zu bytes failed: %s", m_memorySize, strerror(errno));
+    }
+
+    auto* memory = static_cast<uint8_t*>(m_memory);
+
+    m_request = std::make_shared<ShmRing>(memory, capacity, m_fds[SHM_CHANNEL_FD_REQUEST_EVENT]);
+    m_response = std::make_shared<ShmRing>(memory + ringSize, capacity, m_fds[SHM_CHANNEL_FD_RESPONSE_EVENT]);
+    m_notification = std::make_shared<ShmRing>(memory + 2 * ringSize, capacity, m_fds[SHM_CHANNEL_FD_NOTIFICATION_EVENT]);
+
+    if (!m_request->isValid() || !m_response->isValid() || !m_notification->isValid())
+    {
+        SWSS_LOG_THROW("shm rings on endpoint %s are not initialized", m_endpoint.c_str());
+    }
+
+    SWSS_LOG_NOTICE("connected to shm endpoint %s, ring capacity %zu", m_endpoint.c_str(), (size_t)capacity);
+}
+
+void ShmChannel::notificationThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("start listening for notifications");
+
+    pollfd fds[2];
+
+    fds[0].fd = m_notificationThreadShouldEndEvent.getFd();
+    fds[0].events = POLLIN;
+
+    fds[1].fd = m_notification->getEventFd();
+    fds[1].events = POLLIN;
+
+    while (m_runNotificationThread)
+    {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+
+        int rc = poll(fds, 2, -1);
+
+        if (rc < 0)
+        {
+            if (errno != EINTR)
+            {
+                SWSS_LOG_ERROR("poll failed: %s", strerror(errno));
+            }
+
+            continue;
+        }
+
+        if (fds[0].revents)
+        {
+            // user requested shutdown_switch
+            break;
+        }
+
+        m_notification->clearEvent();
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        while (m_notification->pop(kco))
+        {
+            const std::string& op = kfvOp(kco);
+            const std::string& data = kfvKey(kco);
+
+            SWSS_LOG_DEBUG("notification: op = %s, data = %s", op.c_str(), data.c_str());
+
+            m_callback(op, data, kfvFieldsValues(kco));
+        }
+    }
+
+    SWSS_LOG_NOTICE("exiting notification thread");
+}
+
+void ShmChannel::setBuffered(
+        _In_ bool buffered)
+{
+    SWSS_LOG_ENTER();
+
+    // not supported
+}
+
+void ShmChannel::flush()
+{
+    SWSS_LOG_ENTER();
+
+    // not supported
+}
+
+void ShmChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    // syncd may be blocked on sending response to full response ring, and
+    // it will not consume requests until responses are read, so responses
+    // are moved to pending queue while waiting for free space
+
+    while (!m_request->push(key, values, command, 0))
+    {
+        if (!receivePendingResponses())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                SWSS_LOG_THROW("failed to send %s request on %s, request ring is full", command.c_str(), m_endpoint.c_str());
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(SHM_REQUEST_RETRY_INTERVAL_US));
+        }
+    }
+}
+
+bool ShmChannel::receivePendingResponses()
+{
+    SWSS_LOG_ENTER();
+
+    bool received = false;
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    while (m_response->pop(kco))
+    {
+        m_pendingResponses.push_back(std::move(kco));
+
+        received = true;
+    }
+
+    return received;
+}
+
+void ShmChannel::del(
+        _In_ const std::string& key,
+        _In_ const std::string& command)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    set(key, values, command);
+}
+
+sai_status_t ShmChannel::wait(
+        _In_ const std::string& command,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_DEBUG("wait for %s response", command.c_str());
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_responseTimeoutMs);
+
+    pollfd pfd;
+
+    pfd.fd = m_response->getEventFd();
+    pfd.events = POLLIN;
+
+    while (true)
+    {
+        // responses received while request ring was full don't need poll
+
+        if (popPendingResponse(kco) || m_response->pop(kco))
+        {
+            const std::string &op = kfvOp(kco);
+            const std::string &opkey = kfvKey(kco);
+
+            SWSS_LOG_DEBUG("response: op = %s, key = %s", op.c_str(), opkey.c_str());
+
+            if (op != command)
+            {
+                SWSS_LOG_WARN("got not expected response: %s:%s", opkey.c_str(), op.c_str());
+
+                // ignore non response messages
+                continue;
+            }
+
+            sai_status_t status;
+            sai_deserialize_status(opkey, status);
+
+            SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
+
+            return status;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (now >= deadline)
+        {
+            break;
+        }
+
+        pfd.revents = 0;
+
+        int timeout = (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count() + 1;
+
+        if (poll(&pfd, 1, timeout) < 0 && errno != EINTR)
+        {
+            SWSS_LOG_THROW("poll failed: %s", strerror(errno));
+        }
+
+        m_response->clearEvent();
+    }
+
+    SWSS_LOG_ERROR("failed to get response for %s", command.c_str());
+
+    return SAI_STATUS_FAILURE;
+}
+
+bool ShmChannel::isPipelineSupported() const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+bool ShmChannel::isResponseAvailable()
+{
+    SWSS_LOG_ENTER();
+
+    return !m_pendingResponses.empty() || !m_response->empty();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Channel.h"
+
+#include "meta/ShmSelectableChannel.h"
+
+#include <memory>
+#include <functional>
+
+namespace sairedis
+{
+    /**
+     * @brief Shared memory channel.
+     *
+     * Client side of shared memory transport, see ShmSelectableChannel.
+     * Connection to syncd is made in constructor, and it's retried until
+     * response timeout, so syncd can be started later than client.
+     *
+     * Requests and responses are passed through rings in shared memory, so
+     * multiple requests can be sent before responses are received.
+     */
+    class ShmChannel:
+        public Channel
+    {
+        public:
+
+            ShmChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ Channel::Callback callback);
+
+            virtual ~ShmChannel();
+
+        public:
+
+            virtual void setBuffered(
+                    _In_ bool buffered) override;
+
+            virtual void flush() override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& command) override;
+
+            virtual void del(
+                    _In_ const std::string& key,
+                    _In_ const std::string& command) override;
+
+            virtual sai_status_t wait(
+                    _In_ const std::string& command,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco) override;
+
+            virtual bool isPipelineSupported() const override;
+
+            virtual bool isResponseAvailable() override;
+
+        protected:
+
+            virtual void notificationThreadFunction() override;
+
+        private:
+
+            void connect();
+
+            /**
+             * @brief Move all responses from response ring to pending queue.
+             *
+             * @return True if any response was received.
+             */
+            bool receivePendingResponses();
+
+        private:
+
+            std::string m_endpoint;
+
+            int m_socket;
+
+            int m_fds[SHM_CHANNEL_FD_COUNT];
+
+            void* m_memory;
+
+            size_t m_memorySize;
+
+            std::shared_ptr<ShmRing> m_request;
+
+            std::shared_ptr<ShmRing> m_response;
+
+            std::shared_ptr<ShmRing> m_notification;
+    };
+}
@@ -84,6 +84,20 @@ typedef enum _sai_redis_communication_mode_t
      */
     SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC,
 
+    /**
+     * @brief Synchronous mode using shared memory.
+     *
+     * When enabled syncd also needs to be running in shm synchronous mode on
+     * the same host. Requests, responses and notifications are passed through
+     * shared memory rings, and multiple requests can be sent before their
+     * responses are received.
+     *
+     * Default endpoint "/tmp/shm_ep" is used when this attribute is set, to
+     * change it, a context config json file must be provided via
+     * SAI_REDIS_KEY_CONTEXT_CONFIG profile argument.
+     */
+    SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC,
+
 } sai_redis_communication_mode_t;
 
 /**
@@ -16,6 +16,7 @@
 #define REDIS_COMMUNICATION_MODE_REDIS_ASYNC_STRING "redis_async"
 #define REDIS_COMMUNICATION_MODE_REDIS_SYNC_STRING  "redis_sync"
 #define REDIS_COMMUNICATION_MODE_ZMQ_SYNC_STRING    "zmq_sync"
+#define REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING    "shm_sync"
 
 /*
  * Asic state table commands. Those names are special and they will be used
@@ -40,6 +41,14 @@
 
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
+/**
+ * @brief Multiple responses sent in single message.
+ *
+ * Sent by syncd when response batching is enabled, see
+ * saimeta::Globals::appendBatchResponse for encoding.
+ */
+#define REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE     "batch_response"
+
 #define REDIS_ASIC_STATE_COMMAND_FLUSH              "flush"
 #define REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE      "flushresponse"
 
@@ -2,6 +2,10 @@
 
 #include "sai_serialize.h"
 
+#include "swss/tokenize.h"
+
+#include <iterator>
+
 using namespace saimeta;
 
 std::string Globals::getAttrInfo(
@@ -88,3 +92,153 @@ std::string Globals::joinFieldValues(
 
     return ss.str();
 }
+
+constexpr const char* Globals::BULK_FIELDS_ENCODING;
+
+std::string Globals::getBulkKey(
+        _In_ const std::string& objectType,
+        _In_ size_t count,
+        _In_ bool fieldsEncoding)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key = objectType + ":" + std::to_string(count);
+
+    if (fieldsEncoding)
+    {
+        key += ":";
+        key += BULK_FIELDS_ENCODING;
+    }
+
+    return key;
+}
+
+void Globals::appendBulkFields(
+        _Inout_ std::vector<swss::FieldValueTuple>& entries,
+        _In_ const std::string& objectId,
+        _In_ std::vector<swss::FieldValueTuple>&& attributes)
+{
+    SWSS_LOG_ENTER();
+
+    entries.emplace_back(objectId, std::to_string(attributes.size()));
+
+    entries.insert(entries.end(),
+            std::make_move_iterator(attributes.begin()),
+            std::make_move_iterator(attributes.end()));
+}
+
+void Globals::parseBulk(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _Out_ std::vector<std::string>& objectIds,
+        _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
+{
+    SWSS_LOG_ENTER();
+
+    objectIds.clear();
+    strAttributes.clear();
+
+    auto pos = key.rfind(':');
+
+    if (pos != std::string::npos && key.compare(pos + 1, std::string::npos, BULK_FIELDS_ENCODING) == 0)
+    {
+        // field = objectId, value = attribute count, followed by attributes
+
+        size_t idx = 0;
+
+        while (idx < values.size())
+        {
+            const auto& header = values[idx++];
+
+            size_t count = std::stoul(fvValue(header));
+
+            if (count > values.size() - idx)
+            {
+                SWSS_LOG_THROW("bulk object %s attribute count %zu exceeds entries count",
+                        fvField(header).c_str(),
+                        count);
+            }
+
+            objectIds.push_back(fvField(header));
+
+            strAttributes.emplace_back(values.begin() + idx, values.begin() + idx + count);
+
+            idx += count;
+        }
+
+        return;
+    }
+
+    // field = objectId
+    // value = attrid=attrvalue|...
+
+    objectIds.reserve(values.size());
+    strAttributes.reserve(values.size());
+
+    for (const auto &fvt: values)
+    {
+        objectIds.push_back(fvField(fvt));
+
+        std::vector<swss::FieldValueTuple> entries; // attributes per object id
+
+        for (const auto& item: swss::tokenize(fvValue(fvt), '|'))
+        {
+            auto start = item.find_first_of("=");
+
+            entries.emplace_back(item.substr(0, start), item.substr(start + 1));
+        }
+
+        strAttributes.push_back(std::move(entries));
+    }
+}
+
+void Globals::appendBatchResponse(
+        _Inout_ std::vector<swss::FieldValueTuple>& entries,
+        _In_ uint64_t sequence,
+        _In_ const swss::KeyOpFieldsValuesTuple& response)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& values = kfvFieldsValues(response);
+
+    entries.emplace_back(std::to_string(sequence), std::to_string(values.size()));
+    entries.emplace_back(kfvKey(response), kfvOp(response));
+
+    entries.insert(entries.end(), values.begin(), values.end());
+}
+
+void Globals::parseBatchResponse(
+        _In_ const std::vector<swss::FieldValueTuple>& entries,
+        _Out_ std::vector<uint64_t>& sequences,
+        _Out_ std::vector<swss::KeyOpFieldsValuesTuple>& responses)
+{
+    SWSS_LOG_ENTER();
+
+    sequences.clear();
+    responses.clear();
+
+    size_t idx = 0;
+
+    while (idx < entries.size())
+    {
+        const auto& header = entries[idx++];
+
+        size_t count = std::stoul(fvValue(header));
+
+        if (idx >= entries.size() || count > entries.size() - idx - 1)
+        {
+            SWSS_LOG_THROW("batch response %s value count %zu exceeds entries count",
+                    fvField(header).c_str(),
+                    count);
+        }
+
+        const auto& keyOp = entries[idx++];
+
+        sequences.push_back(std::stoull(fvField(header)));
+
+        responses.emplace_back(fvField(keyOp), fvValue(keyOp),
+                std::vector<swss::FieldValueTuple>(entries.begin() + idx, entries.begin() + idx + count));
+
+        idx += count;
+    }
+}
@@ -38,6 +38,71 @@ namespace saimeta
 
             static std::string joinFieldValues(
                     _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        public: // bulk encoding
+
+            /*
+             * Bulk operations are encoded with key "object_type:count". In
+             * joined encoding each object is single field/value pair (object
+             * id, "attr=value|attr=value"). In fields encoding (key has
+             * additional ":fields" suffix) each object is encoded as header
+             * pair (object id, attribute count) followed by attribute pairs,
+             * so attributes don't need to be joined and split again.
+             *
+             * Joined encoding must be used when bulk is applied to redis by
+             * consumer table LUA script (redis async mode).
+             */
+
+            static constexpr const char* BULK_FIELDS_ENCODING = "fields";
+
+            static std::string getBulkKey(
+                    _In_ const std::string& objectType,
+                    _In_ size_t count,
+                    _In_ bool fieldsEncoding);
+
+            /**
+             * @brief Append object to fields encoded bulk entries.
+             */
+            static void appendBulkFields(
+                    _Inout_ std::vector<swss::FieldValueTuple>& entries,
+                    _In_ const std::string& objectId,
+                    _In_ std::vector<swss::FieldValueTuple>&& attributes);
+
+            /**
+             * @brief Decode bulk entries in any encoding.
+             *
+             * Throws when fields encoded entries are malformed.
+             */
+            static void parseBulk(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _Out_ std::vector<std::string>& objectIds,
+                    _Out_ std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
+
+        public: // batch response encoding
+
+            /*
+             * Multiple responses can be sent in single message with op
+             * "batch_response" and key holding number of responses. Each
+             * response is encoded as header pair (sequence number, value
+             * count), followed by pair (key, op) and response values.
+             */
+
+            static void appendBatchResponse(
+                    _Inout_ std::vector<swss::FieldValueTuple>& entries,
+                    _In_ uint64_t sequence,
+                    _In_ const swss::KeyOpFieldsValuesTuple& response);
+
+            /**
+             * @brief Decode batch response entries, responses are returned
+             * in the same order as they were appended.
+             *
+             * Throws when entries are malformed.
+             */
+            static void parseBatchResponse(
+                    _In_ const std::vector<swss::FieldValueTuple>& entries,
+                    _Out_ std::vector<uint64_t>& sequences,
+                    _Out_ std::vector<swss::KeyOpFieldsValuesTuple>& responses);
     };
 }
 
@@ -0,0 +1,140 @@
+#include "LatencyHistogram.h"
+
+#include "swss/logger.h"
+
+#include <cmath>
+
+using namespace sairediscommon;
+
+constexpr unsigned int LatencyHistogram::SUB_BUCKET_BITS;
+constexpr unsigned int LatencyHistogram::SUB_BUCKETS;
+constexpr unsigned int LatencyHistogram::BUCKETS;
+
+LatencyHistogram::LatencyHistogram():
+    m_count(0),
+    m_sum(0),
+    m_max(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& bucket: m_buckets)
+    {
+        bucket = 0;
+    }
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t nanoseconds)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_buckets[getBucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+
+    while (nanoseconds > max && !m_max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+    {
+        // max was updated by other thread, retry
+    }
+
+    // count is updated last, so reader which loaded count will see at least
+    // count samples in buckets
+
+    m_count.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count.load(std::memory_order_acquire);
+}
+
+uint64_t LatencyHistogram::getSum() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_sum.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_max.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getPercentile(
+        _In_ double percentile) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t count = getCount();
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)std::ceil(percentile / 100.0 * (double)count);
+
+    rank = (rank == 0) ? 1 : rank;
+
+    uint64_t max = getMax();
+
+    uint64_t seen = 0;
+
+    for (unsigned int idx = 0; idx < BUCKETS; idx++)
+    {
+        seen += m_buckets[idx].load(std::memory_order_relaxed);
+
+        if (seen >= rank)
+        {
+            uint64_t upper = getBucketUpperBound(idx);
+
+            return (upper < max) ? upper : max;
+        }
+    }
+
+    return max;
+}
+
+unsigned int LatencyHistogram::getBucketIndex(
+        _In_ uint64_t value)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (value < SUB_BUCKETS)
+    {
+        return (unsigned int)value;
+    }
+
+    unsigned int msb = 63 - (unsigned int)__builtin_clzll(value);
+
+    unsigned int shift = msb - SUB_BUCKET_BITS;
+
+    unsigned int sub = (unsigned int)(value >> shift) & (SUB_BUCKETS - 1);
+
+    return (shift + 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(
+        _In_ unsigned int index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    unsigned int shift = index / SUB_BUCKETS - 1;
+
+    uint64_t sub = index % SUB_BUCKETS;
+
+    uint64_t lower = (SUB_BUCKETS + sub) << shift;
+
+    return lower + ((1ULL << shift) - 1);
+}
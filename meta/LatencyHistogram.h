@@ -0,0 +1,77 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace sairediscommon
+{
+    /**
+     * @brief Lock free latency histogram.
+     *
+     * Values are in nanoseconds and are counted in logarithmic buckets, each
+     * power of 2 is split into 4 linear sub buckets, so reported percentile
+     * is within 25% of the real value. Recording is wait free and can be done
+     * concurrently with reading from other thread.
+     */
+    class LatencyHistogram
+    {
+        public:
+
+            static constexpr unsigned int SUB_BUCKET_BITS = 2;
+
+            static constexpr unsigned int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+
+            static constexpr unsigned int BUCKETS = 64 * SUB_BUCKETS;
+
+        public:
+
+            LatencyHistogram();
+
+            ~LatencyHistogram() = default; // non virtual
+
+            LatencyHistogram(const LatencyHistogram&) = delete;
+            LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        public:
+
+            void record(
+                    _In_ uint64_t nanoseconds);
+
+            uint64_t getCount() const;
+
+            uint64_t getSum() const;
+
+            uint64_t getMax() const;
+
+            /**
+             * @brief Gets percentile value in nanoseconds.
+             *
+             * @param percentile Percentile in range <0..100>.
+             *
+             * @return Upper bound of bucket containing percentile, but not
+             * more than maximum recorded value, or 0 if histogram is empty.
+             */
+            uint64_t getPercentile(
+                    _In_ double percentile) const;
+
+        public:
+
+            static unsigned int getBucketIndex(
+                    _In_ uint64_t value);
+
+            static uint64_t getBucketUpperBound(
+                    _In_ unsigned int index);
+
+        private:
+
+            std::atomic<uint64_t> m_buckets[BUCKETS];
+
+            std::atomic<uint64_t> m_count;
+
+            std::atomic<uint64_t> m_sum;
+
+            std::atomic<uint64_t> m_max;
+    };
+}
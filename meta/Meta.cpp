@@ -11,6 +11,7 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include <set>
+#include <algorithm>
 
 // TODO add validation for all oids belong to the same switch
 
@@ -1105,6 +1106,48 @@ sai_status_t Meta::clearStats(
     return status;
 }
 
+std::vector<uint32_t> Meta::meta_validate_bulk_stats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint32_t> valid;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        uint64_t counter; // only checked for not null
+
+        auto status = meta_validate_stats(
+                object_type,
+                object_key[idx].key.object_id,
+                number_of_counters,
+                counter_ids,
+                &counter,
+                mode);
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("bulk stats validation failed for object %u: %s",
+                    idx,
+                    sai_serialize_status(status).c_str());
+
+            object_statuses[idx] = status;
+
+            continue;
+        }
+
+        valid.push_back(idx);
+    }
+
+    return valid;
+}
+
 sai_status_t Meta::bulkGetStats(
         _In_ sai_object_id_t switchId,
         _In_ sai_object_type_t object_type,
@@ -1118,7 +1161,89 @@ sai_status_t Meta::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+    PARAMETER_CHECK_IF_NOT_NULL(counters);
+
+    if (mode != SAI_STATS_MODE_BULK_READ && mode != SAI_STATS_MODE_BULK_READ_AND_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %d is not valid for bulk get stats", mode);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    auto valid = meta_validate_bulk_stats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
+
+    if (valid.size() == object_count)
+    {
+        auto status = m_implementation->bulkGetStats(
+                switchId,
+                object_type,
+                object_count,
+                object_key,
+                number_of_counters,
+                counter_ids,
+                mode,
+                object_statuses,
+                counters);
+
+        // no post validation required
+
+        return status;
+    }
+
+    if (valid.empty())
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    /*
+     * Some objects failed validation, forward only valid objects, so single
+     * invalid object will not prevent obtaining counters of other objects.
+     */
+
+    std::vector<sai_object_key_t> keys;
+
+    for (auto idx: valid)
+    {
+        keys.push_back(object_key[idx]);
+    }
+
+    std::vector<sai_status_t> statuses(valid.size(), SAI_STATUS_NOT_EXECUTED);
+
+    std::vector<uint64_t> values(valid.size() * number_of_counters);
+
+    auto status = m_implementation->bulkGetStats(
+            switchId,
+            object_type,
+            (uint32_t)keys.size(),
+            keys.data(),
+            number_of_counters,
+            counter_ids,
+            mode,
+            statuses.data(),
+            values.data());
+
+    for (size_t i = 0; i < valid.size(); i++)
+    {
+        object_statuses[valid[i]] = statuses[i];
+
+        std::copy(
+                values.begin() + i * number_of_counters,
+                values.begin() + (i + 1) * number_of_counters,
+                &counters[valid[i] * number_of_counters]);
+    }
+
+    return (status == SAI_STATUS_SUCCESS) ? SAI_STATUS_FAILURE : status;
 }
 
 sai_status_t Meta::bulkClearStats(
@@ -1133,7 +1258,74 @@ sai_status_t Meta::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_OBJECT_TYPE_VALID(object_type);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    if (mode != SAI_STATS_MODE_BULK_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %d is not valid for bulk clear stats", mode);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    auto valid = meta_validate_bulk_stats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
+
+    if (valid.size() == object_count)
+    {
+        auto status = m_implementation->bulkClearStats(
+                switchId,
+                object_type,
+                object_count,
+                object_key,
+                number_of_counters,
+                counter_ids,
+                mode,
+                object_statuses);
+
+        // no post validation required
+
+        return status;
+    }
+
+    if (valid.empty())
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    std::vector<sai_object_key_t> keys;
+
+    for (auto idx: valid)
+    {
+        keys.push_back(object_key[idx]);
+    }
+
+    std::vector<sai_status_t> statuses(valid.size(), SAI_STATUS_NOT_EXECUTED);
+
+    auto status = m_implementation->bulkClearStats(
+            switchId,
+            object_type,
+            (uint32_t)keys.size(),
+            keys.data(),
+            number_of_counters,
+            counter_ids,
+            mode,
+            statuses.data());
+
+    for (size_t i = 0; i < valid.size(); i++)
+    {
+        object_statuses[valid[i]] = statuses[i];
+    }
+
+    return (status == SAI_STATUS_SUCCESS) ? SAI_STATUS_FAILURE : status;
 }
 
 // for bulk operations actually we could make copy of current db and actually
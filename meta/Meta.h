@@ -464,6 +464,23 @@ namespace saimeta
                     _Out_ uint64_t *counters,
                     _In_ sai_stats_mode_t mode);
 
+            /**
+             * @brief Validate each object of bulk stats request.
+             *
+             * Status of object which failed validation is set in
+             * object_statuses, other statuses are left untouched.
+             *
+             * @return Indexes of objects which passed validation.
+             */
+            std::vector<uint32_t> meta_validate_bulk_stats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses);
+
         private: // validate OID
 
             sai_status_t meta_sai_validate_oid(
@@ -764,3 +764,37 @@ std::size_t MetaKeyHasher::operator()(
             SWSS_LOG_THROW("not handled: %s", sai_serialize_object_type(k.objecttype).c_str());
     }
 }
+
+std::size_t IpAddressHasher::operator()(
+        _In_ const sai_ip_address_t& k) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return sai_get_hash(k);
+}
+
+bool IpAddressHasher::operator()(
+        _In_ const sai_ip_address_t& a,
+        _In_ const sai_ip_address_t& b) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return a == b;
+}
+
+std::size_t IpPrefixHasher::operator()(
+        _In_ const sai_ip_prefix_t& k) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return sai_get_hash(k);
+}
+
+bool IpPrefixHasher::operator()(
+        _In_ const sai_ip_prefix_t& a,
+        _In_ const sai_ip_prefix_t& b) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return a == b;
+}
@@ -17,4 +17,24 @@ namespace saimeta
                 _In_ const sai_object_meta_key_t& a,
                 _In_ const sai_object_meta_key_t& b) const;
     };
+
+    struct IpAddressHasher
+    {
+        std::size_t operator()(
+                _In_ const sai_ip_address_t& k) const;
+
+        bool operator()(
+                _In_ const sai_ip_address_t& a,
+                _In_ const sai_ip_address_t& b) const;
+    };
+
+    struct IpPrefixHasher
+    {
+        std::size_t operator()(
+                _In_ const sai_ip_prefix_t& k) const;
+
+        bool operator()(
+                _In_ const sai_ip_prefix_t& a,
+                _In_ const sai_ip_prefix_t& b) const;
+    };
 }
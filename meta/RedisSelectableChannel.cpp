@@ -48,6 +48,15 @@ void RedisSelectableChannel::set(
     m_getResponse->set(key, values, op);
 }
 
+bool RedisSelectableChannel::isResponseBatchSupported() const
+{
+    SWSS_LOG_ENTER();
+
+    // responses are pushed to queue, which client pops independently
+
+    return true;
+}
+
 void RedisSelectableChannel::pop(
         _Out_ swss::KeyOpFieldsValuesTuple& kco,
         _In_ bool initViewMode)
@@ -34,6 +34,8 @@ namespace sairedis
                     _In_ const std::vector<swss::FieldValueTuple>& values,
                     _In_ const std::string& op) override;
 
+            virtual bool isResponseBatchSupported() const override;
+
         public: // Selectable overrides
 
             virtual int getFd() override;
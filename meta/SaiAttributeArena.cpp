@@ -0,0 +1,129 @@
+#include "SaiAttributeArena.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace saimeta;
+
+constexpr size_t SaiAttributeArena::DEFAULT_BLOCK_SIZE;
+
+static thread_local SaiAttributeArena* g_currentArena = nullptr;
+
+SaiAttributeArena::SaiAttributeArena(
+        _In_ size_t reserve):
+    m_offset(0),
+    m_used(0),
+    m_reserved(0)
+{
+    SWSS_LOG_ENTER();
+
+    addBlock(std::max(reserve, DEFAULT_BLOCK_SIZE));
+}
+
+void SaiAttributeArena::addBlock(
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    block_t block;
+
+    block.data.reset(new uint8_t[size]);
+    block.size = size;
+
+    m_blocks.push_back(std::move(block));
+
+    m_offset = 0;
+    m_reserved += size;
+}
+
+void* SaiAttributeArena::allocate(
+        _In_ size_t size,
+        _In_ size_t alignment)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    // zero size allocation must still return unique non null pointer
+
+    size = std::max(size, (size_t)1);
+
+    auto* block = &m_blocks.back();
+
+    uintptr_t base = (uintptr_t)block->data.get();
+
+    size_t offset = ((base + m_offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+
+    if (offset + size > block->size)
+    {
+        // blocks are growing, so number of blocks stays small when initial
+        // reservation was too low
+
+        addBlock(std::max(block->size * 2, size + alignment));
+
+        block = &m_blocks.back();
+
+        base = (uintptr_t)block->data.get();
+
+        offset = ((base + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+    }
+
+    m_offset = offset + size;
+    m_used += size;
+
+    return block->data.get() + offset;
+}
+
+bool SaiAttributeArena::contains(
+        _In_ const void* ptr) const
+{
+    SWSS_LOG_ENTER();
+
+    auto* p = static_cast<const uint8_t*>(ptr);
+
+    for (auto& block: m_blocks)
+    {
+        if (p >= block.data.get() && p < block.data.get() + block.size)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t SaiAttributeArena::getUsedSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_used;
+}
+
+size_t SaiAttributeArena::getReservedSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_reserved;
+}
+
+SaiAttributeArena* SaiAttributeArena::getCurrent()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    return g_currentArena;
+}
+
+SaiAttributeArena::Scope::Scope(
+        _In_ SaiAttributeArena* arena):
+    m_previous(g_currentArena)
+{
+    SWSS_LOG_ENTER();
+
+    g_currentArena = arena;
+}
+
+SaiAttributeArena::Scope::~Scope()
+{
+    SWSS_LOG_ENTER();
+
+    g_currentArena = m_previous;
+}
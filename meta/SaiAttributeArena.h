@@ -0,0 +1,124 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace saimeta
+{
+    /**
+     * @brief Attribute arena.
+     *
+     * Bump allocator used to hold variable length attribute values (lists)
+     * and attribute arrays of many attribute lists created from the same
+     * request (for example bulk create). Memory is reserved up front and
+     * released at once when arena is destroyed, individual allocations are
+     * never freed.
+     *
+     * When arena is set as current on a thread (using Scope), lists
+     * allocated by sai_deserialize_attr_value on that thread are taken from
+     * arena, and sai_deserialize_free_attribute_value will not free them.
+     *
+     * Arena is not thread safe, allocations must not be made concurrently.
+     */
+    class SaiAttributeArena
+    {
+        public:
+
+            static constexpr size_t DEFAULT_BLOCK_SIZE = 4096;
+
+        public:
+
+            SaiAttributeArena(
+                    _In_ size_t reserve = 0);
+
+            virtual ~SaiAttributeArena() = default;
+
+        public:
+
+            void* allocate(
+                    _In_ size_t size,
+                    _In_ size_t alignment);
+
+            template <typename T>
+            T* allocate_n(
+                    _In_ size_t count)
+            {
+                return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+            }
+
+            /**
+             * @brief Check whether given pointer was allocated from this arena.
+             */
+            bool contains(
+                    _In_ const void* ptr) const;
+
+            /**
+             * @brief Number of bytes allocated from arena.
+             */
+            size_t getUsedSize() const;
+
+            /**
+             * @brief Number of bytes reserved by all arena blocks.
+             */
+            size_t getReservedSize() const;
+
+        public:
+
+            /**
+             * @brief Arena set as current on calling thread, or nullptr.
+             */
+            static SaiAttributeArena* getCurrent();
+
+            /**
+             * @brief Sets arena as current on calling thread for the scope
+             * lifetime, previous arena is restored on destruction.
+             */
+            class Scope
+            {
+                public:
+
+                    Scope(
+                            _In_ SaiAttributeArena* arena);
+
+                    ~Scope();
+
+                private:
+
+                    Scope(const Scope&);
+                    Scope& operator=(const Scope&);
+
+                    SaiAttributeArena* m_previous;
+            };
+
+        private:
+
+            SaiAttributeArena(const SaiAttributeArena&);
+            SaiAttributeArena& operator=(const SaiAttributeArena&);
+
+            void addBlock(
+                    _In_ size_t size);
+
+            typedef struct _block_t
+            {
+                std::unique_ptr<uint8_t[]> data;
+
+                size_t size;
+
+            } block_t;
+
+            std::vector<block_t> m_blocks;
+
+            /**
+             * @brief Bytes used in last block.
+             */
+            size_t m_offset;
+
+            size_t m_used;
+
+            size_t m_reserved;
+    };
+}
@@ -7,12 +7,17 @@ using namespace saimeta;
 SaiAttributeList::SaiAttributeList(
         _In_ const sai_object_type_t objectType,
         _In_ const std::vector<swss::FieldValueTuple> &values,
-        _In_ bool countOnly)
+        _In_ bool countOnly):
+    m_arena_attr_list(nullptr),
+    m_arena_attr_count(0)
 {
     SWSS_LOG_ENTER();
 
     size_t attr_count = values.size();
 
+    m_attr_list.reserve(attr_count);
+    m_attr_value_type_list.reserve(attr_count);
+
     for (size_t i = 0; i < attr_count; ++i)
     {
         const std::string &str_attr_id = fvField(values[i]);
@@ -46,10 +51,15 @@ SaiAttributeList::SaiAttributeList(
 SaiAttributeList::SaiAttributeList(
         _In_ const sai_object_type_t objectType,
         _In_ const std::unordered_map<std::string, std::string>& hash,
-        _In_ bool countOnly)
+        _In_ bool countOnly):
+    m_arena_attr_list(nullptr),
+    m_arena_attr_count(0)
 {
     SWSS_LOG_ENTER();
 
+    m_attr_list.reserve(hash.size());
+    m_attr_value_type_list.reserve(hash.size());
+
     for (auto it = hash.begin(); it != hash.end(); it++)
     {
         const std::string &str_attr_id = it->first;
@@ -80,10 +90,68 @@ SaiAttributeList::SaiAttributeList(
     }
 }
 
+SaiAttributeList::SaiAttributeList(
+        _In_ const sai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ bool countOnly,
+        _In_ std::shared_ptr<SaiAttributeArena> arena):
+    m_arena(arena),
+    m_arena_attr_list(nullptr),
+    m_arena_attr_count(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_arena)
+    {
+        SWSS_LOG_THROW("arena can't be nullptr");
+    }
+
+    // attribute array is sized from field count, NULL fields only leave
+    // unused slots
+
+    m_arena_attr_list = m_arena->allocate_n<sai_attribute_t>(values.size());
+
+    SaiAttributeArena::Scope scope(m_arena.get());
+
+    for (auto& fvt: values)
+    {
+        const std::string &str_attr_id = fvField(fvt);
+        const std::string &str_attr_value = fvValue(fvt);
+
+        if (str_attr_id == "NULL")
+        {
+            continue;
+        }
+
+        sai_attribute_t &attr = m_arena_attr_list[m_arena_attr_count];
+        memset(&attr, 0, sizeof(sai_attribute_t));
+
+        sai_deserialize_attr_id(str_attr_id, attr.id);
+
+        auto meta = sai_metadata_get_attr_metadata(objectType, attr.id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
+        }
+
+        sai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
+
+        m_arena_attr_count++;
+    }
+}
+
 SaiAttributeList::~SaiAttributeList()
 {
     SWSS_LOG_ENTER();
 
+    if (m_arena)
+    {
+        // values are released together with arena
+
+        return;
+    }
+
     size_t attr_count = m_attr_list.size();
 
     for (size_t i = 0; i < attr_count; ++i)
@@ -133,6 +201,11 @@ sai_attribute_t* SaiAttributeList::get_attr_list()
 {
     SWSS_LOG_ENTER();
 
+    if (m_arena)
+    {
+        return m_arena_attr_list;
+    }
+
     return m_attr_list.data();
 }
 
@@ -140,5 +213,10 @@ uint32_t SaiAttributeList::get_attr_count()
 {
     SWSS_LOG_ENTER();
 
+    if (m_arena)
+    {
+        return m_arena_attr_count;
+    }
+
     return (uint32_t)m_attr_list.size();
 }
@@ -4,8 +4,11 @@ extern "C" {
 #include "saimetadata.h"
 }
 
+#include "SaiAttributeArena.h"
+
 #include "swss/table.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -26,6 +29,19 @@ namespace saimeta
                     _In_ const std::unordered_map<std::string, std::string>& hash,
                     _In_ bool countOnly);
 
+            /**
+             * @brief Create attribute list with attribute array and all
+             * attribute values allocated from given arena.
+             *
+             * Values are not freed in destructor, they are released when
+             * arena is destroyed, arena is kept alive by this list.
+             */
+            SaiAttributeList(
+                    _In_ const sai_object_type_t object_type,
+                    _In_ const std::vector<swss::FieldValueTuple> &values,
+                    _In_ bool countOnly,
+                    _In_ std::shared_ptr<SaiAttributeArena> arena);
+
             virtual ~SaiAttributeList();
 
         public:
@@ -47,5 +63,11 @@ namespace saimeta
 
             std::vector<sai_attribute_t> m_attr_list;
             std::vector<sai_attr_value_type_t> m_attr_value_type_list;
+
+            std::shared_ptr<SaiAttributeArena> m_arena;
+
+            sai_attribute_t* m_arena_attr_list;
+
+            uint32_t m_arena_attr_count;
     };
 }
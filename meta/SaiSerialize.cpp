@@ -1,5 +1,6 @@
 #include "sai_serialize.h"
 #include "sairediscommon.h"
+#include "SaiAttributeArena.h"
 
 #include "swss/tokenize.h"
 
@@ -45,6 +46,13 @@ T* sai_alloc_n_of_ptr_type(U count, T*)
 {
     SWSS_LOG_ENTER();
 
+    auto arena = saimeta::SaiAttributeArena::getCurrent();
+
+    if (arena)
+    {
+        return arena->allocate_n<T>(count);
+    }
+
     return new T[count];
 }
 
@@ -65,7 +73,15 @@ void sai_free_list(
 {
     SWSS_LOG_ENTER();
 
-    delete[] element.list;
+    auto arena = saimeta::SaiAttributeArena::getCurrent();
+
+    // list allocated from arena is released together with arena
+
+    if (arena == nullptr || !arena->contains(element.list))
+    {
+        delete[] element.list;
+    }
+
     element.list = NULL;
 }
 
@@ -2824,6 +2840,9 @@ std::string sai_serialize_redis_communication_mode(
         case SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC:
             return REDIS_COMMUNICATION_MODE_ZMQ_SYNC_STRING;
 
+        case SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC:
+            return REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING;
+
         default:
 
             SWSS_LOG_THROW("unknown value on sai_redis_communication_mode_t: %d", value);
@@ -5702,6 +5721,10 @@ void sai_deserialize_redis_communication_mode(
     {
         value = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
     }
+    else if (s == REDIS_COMMUNICATION_MODE_SHM_SYNC_STRING)
+    {
+        value = SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC;
+    }
     else
     {
         SWSS_LOG_THROW("enum '%s' not found in sai_redis_communication_mode_t", s.c_str());
@@ -12,3 +12,10 @@ SelectableChannel::SelectableChannel(
 
     // empty
 }
+
+bool SelectableChannel::isResponseBatchSupported() const
+{
+    SWSS_LOG_ENTER();
+
+    return false;
+}
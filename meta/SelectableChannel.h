@@ -31,5 +31,13 @@ namespace sairedis
                     _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& values,
                     _In_ const std::string& op) = 0;
+
+            /**
+             * @brief Whether multiple responses can be sent by single set.
+             *
+             * Request/reply transports require exactly one response per
+             * request, so responses can't be batched. By default false.
+             */
+            virtual bool isResponseBatchSupported() const;
     };
 }
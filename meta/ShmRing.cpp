@@ -0,0 +1,317 @@
+#include "ShmRing.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace sairedis;
+
+constexpr size_t ShmRing::DEFAULT_CAPACITY;
+
+/*
+ * Message layout: total size of strings, number of strings, then each string
+ * as length and bytes. Strings are key, op and field value pairs.
+ */
+
+#define SHM_RING_LENGTH_SIZE (sizeof(uint32_t))
+
+#define SHM_RING_FULL_SLEEP_US 10
+
+ShmRing::ShmRing(
+        _In_ void* memory,
+        _In_ size_t capacity,
+        _In_ int eventFd):
+    m_header(static_cast<shm_ring_header_t*>(memory)),
+    m_data(static_cast<uint8_t*>(memory) + sizeof(shm_ring_header_t)),
+    m_capacity(capacity),
+    m_eventFd(eventFd)
+{
+    SWSS_LOG_ENTER();
+
+    if (capacity == 0)
+    {
+        SWSS_LOG_THROW("ring capacity must be positive");
+    }
+}
+
+size_t ShmRing::getRequiredSize(
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = sizeof(shm_ring_header_t) + capacity;
+
+    // keep next ring header aligned when rings are placed one after another
+
+    return (size + alignof(shm_ring_header_t) - 1) & ~(alignof(shm_ring_header_t) - 1);
+}
+
+void ShmRing::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_header->capacity = m_capacity;
+    m_header->tail.store(0);
+    m_header->head.store(0);
+}
+
+bool ShmRing::isValid() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header->capacity == m_capacity;
+}
+
+void ShmRing::write(
+        _In_ uint64_t position,
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    size_t offset = (size_t)(position % m_capacity);
+    size_t first = std::min(size, m_capacity - offset);
+
+    memcpy(m_data + offset, data, first);
+    memcpy(m_data, static_cast<const uint8_t*>(data) + first, size - first);
+}
+
+void ShmRing::read(
+        _In_ uint64_t position,
+        _Out_ void* data,
+        _In_ size_t size) const
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    size_t offset = (size_t)(position % m_capacity);
+    size_t first = std::min(size, m_capacity - offset);
+
+    memcpy(data, m_data + offset, first);
+    memcpy(static_cast<uint8_t*>(data) + first, m_data, size - first);
+}
+
+uint64_t ShmRing::writeString(
+        _In_ uint64_t position,
+        _In_ const std::string& str)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    uint32_t length = (uint32_t)str.size();
+
+    write(position, &length, SHM_RING_LENGTH_SIZE);
+    write(position + SHM_RING_LENGTH_SIZE, str.data(), str.size());
+
+    return position + SHM_RING_LENGTH_SIZE + str.size();
+}
+
+uint64_t ShmRing::readString(
+        _In_ uint64_t position,
+        _In_ uint64_t end,
+        _Out_ std::string& str) const
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    uint32_t length;
+
+    if (position + SHM_RING_LENGTH_SIZE > end)
+    {
+        SWSS_LOG_THROW("corrupted message, string length is outside of message");
+    }
+
+    read(position, &length, SHM_RING_LENGTH_SIZE);
+
+    position += SHM_RING_LENGTH_SIZE;
+
+    if (position + length > end)
+    {
+        SWSS_LOG_THROW("corrupted message, string of length %u is outside of message", length);
+    }
+
+    str.resize(length);
+
+    read(position, &str[0], length);
+
+    return position + length;
+}
+
+bool ShmRing::push(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op,
+        _In_ uint64_t timeoutMs)
+{
+    SWSS_LOG_ENTER();
+
+    size_t body = 2 * SHM_RING_LENGTH_SIZE + key.size() + op.size();
+
+    for (auto& fv: values)
+    {
+        body += 2 * SHM_RING_LENGTH_SIZE + fvField(fv).size() + fvValue(fv).size();
+    }
+
+    size_t size = 2 * SHM_RING_LENGTH_SIZE + body;
+
+    if (size > m_capacity || body > UINT32_MAX)
+    {
+        SWSS_LOG_THROW("message of size %zu don't fit into ring of capacity %zu", size, m_capacity);
+    }
+
+    // only producer modifies head
+
+    uint64_t head = m_header->head.load(std::memory_order_relaxed);
+
+    if (m_capacity - (head - m_header->tail.load()) < size)
+    {
+        if (timeoutMs == 0)
+        {
+            return false;
+        }
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+        while (m_capacity - (head - m_header->tail.load()) < size)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                SWSS_LOG_ERROR("no free space in ring for message of size %zu in %" PRIu64 " ms", size, timeoutMs);
+
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(SHM_RING_FULL_SLEEP_US));
+        }
+    }
+
+    uint32_t bodySize = (uint32_t)body;
+    uint32_t count = (uint32_t)(2 + 2 * values.size());
+
+    uint64_t position = head;
+
+    write(position, &bodySize, SHM_RING_LENGTH_SIZE);
+    write(position + SHM_RING_LENGTH_SIZE, &count, SHM_RING_LENGTH_SIZE);
+
+    position += 2 * SHM_RING_LENGTH_SIZE;
+
+    position = writeString(position, key);
+    position = writeString(position, op);
+
+    for (auto& fv: values)
+    {
+        position = writeString(position, fvField(fv));
+        position = writeString(position, fvValue(fv));
+    }
+
+    // sequentially consistent publish and tail load, pairs with consumer
+    // storing tail and then loading head, so either consumer will see this
+    // message, or we will see that consumer drained ring and signal it
+
+    m_header->head.store(head + size);
+
+    if (m_header->tail.load() == head)
+    {
+        signal();
+    }
+
+    return true;
+}
+
+bool ShmRing::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    // only consumer modifies tail
+
+    uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+
+    uint64_t head = m_header->head.load();
+
+    if (head == tail)
+    {
+        return false;
+    }
+
+    uint32_t bodySize;
+    uint32_t count;
+
+    read(tail, &bodySize, SHM_RING_LENGTH_SIZE);
+    read(tail + SHM_RING_LENGTH_SIZE, &count, SHM_RING_LENGTH_SIZE);
+
+    uint64_t position = tail + 2 * SHM_RING_LENGTH_SIZE;
+    uint64_t end = position + bodySize;
+
+    if (end > head || count < 2 || count % 2)
+    {
+        SWSS_LOG_THROW("corrupted message at ring position %" PRIu64 ", size %u, count %u", tail, bodySize, count);
+    }
+
+    position = readString(position, end, kfvKey(kco));
+    position = readString(position, end, kfvOp(kco));
+
+    auto& values = kfvFieldsValues(kco);
+
+    values.resize((count - 2) / 2);
+
+    for (auto& fv: values)
+    {
+        position = readString(position, end, fvField(fv));
+        position = readString(position, end, fvValue(fv));
+    }
+
+    m_header->tail.store(end);
+
+    return true;
+}
+
+bool ShmRing::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_header->head.load() == m_header->tail.load();
+}
+
+int ShmRing::getEventFd() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_eventFd;
+}
+
+void ShmRing::signal()
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value = 1;
+
+    ssize_t rc = ::write(m_eventFd, &value, sizeof(value));
+
+    if (rc != sizeof(value))
+    {
+        // counter overflow would only happen if consumer is not reading
+        // events, in that case it's already signaled
+
+        SWSS_LOG_WARN("failed to signal ring event fd %d, errno: %s", m_eventFd, strerror(errno));
+    }
+}
+
+void ShmRing::clearEvent()
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value;
+
+    // event fd is non blocking, EAGAIN means there was no event
+
+    ssize_t rc = ::read(m_eventFd, &value, sizeof(value));
+
+    if (rc < 0 && errno != EAGAIN)
+    {
+        SWSS_LOG_WARN("failed to clear ring event fd %d, errno: %s", m_eventFd, strerror(errno));
+    }
+}
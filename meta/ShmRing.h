@@ -0,0 +1,149 @@
+#pragma once
+
+#include "swss/table.h"
+#include "swss/sal.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Shared memory ring.
+     *
+     * Single producer single consumer queue of messages placed in memory
+     * shared between processes. Message (key, op and field value pairs) is
+     * written directly to ring as length prefixed strings, so no intermediate
+     * buffer or text encoding is needed.
+     *
+     * Producer and consumer positions are only increasing byte counters, data
+     * offset is position modulo capacity. Consumer is woken up by eventfd,
+     * which is signaled only when ring was empty before message was pushed,
+     * so consumer must drain all messages after event is cleared.
+     */
+    class ShmRing
+    {
+        public:
+
+            static constexpr size_t DEFAULT_CAPACITY = 8 * 1024 * 1024;
+
+        public:
+
+            /**
+             * @brief Attach ring to shared memory.
+             *
+             * Memory must be at least getRequiredSize(capacity) bytes and
+             * aligned to cache line. Ring header is not modified, producer
+             * side must call reset before ring is used.
+             */
+            ShmRing(
+                    _In_ void* memory,
+                    _In_ size_t capacity,
+                    _In_ int eventFd);
+
+            virtual ~ShmRing() = default;
+
+        public:
+
+            static size_t getRequiredSize(
+                    _In_ size_t capacity);
+
+            /**
+             * @brief Initialize ring header, all messages are dropped.
+             */
+            void reset();
+
+            /**
+             * @brief Check whether ring header was initialized with the same
+             * capacity.
+             */
+            bool isValid() const;
+
+            /**
+             * @brief Push message to ring.
+             *
+             * When ring is full, waits until consumer frees enough space.
+             * With zero timeout returns immediately without logging error,
+             * so caller can do other work while waiting for free space.
+             * Throws when message is larger than ring capacity.
+             *
+             * @return False if there was no free space before timeout.
+             */
+            bool push(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op,
+                    _In_ uint64_t timeoutMs);
+
+            /**
+             * @brief Pop message from ring.
+             *
+             * @return False if ring is empty.
+             */
+            bool pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
+            bool empty() const;
+
+            int getEventFd() const;
+
+            /**
+             * @brief Clear consumer event, must be done before ring is
+             * drained, otherwise wake up could be lost.
+             */
+            void clearEvent();
+
+        private:
+
+            ShmRing(const ShmRing&);
+            ShmRing& operator=(const ShmRing&);
+
+            void write(
+                    _In_ uint64_t position,
+                    _In_ const void* data,
+                    _In_ size_t size);
+
+            void read(
+                    _In_ uint64_t position,
+                    _Out_ void* data,
+                    _In_ size_t size) const;
+
+            uint64_t writeString(
+                    _In_ uint64_t position,
+                    _In_ const std::string& str);
+
+            uint64_t readString(
+                    _In_ uint64_t position,
+                    _In_ uint64_t end,
+                    _Out_ std::string& str) const;
+
+            void signal();
+
+        private:
+
+            /**
+             * @brief Ring header placed at the beginning of shared memory.
+             *
+             * Positions are in separate cache lines, since they are written
+             * by different processes.
+             */
+            typedef struct _shm_ring_header_t
+            {
+                alignas(64) std::atomic<uint64_t> head; // producer position
+
+                alignas(64) std::atomic<uint64_t> tail; // consumer position
+
+                alignas(64) uint64_t capacity;
+
+            } shm_ring_header_t;
+
+            shm_ring_header_t* m_header;
+
+            uint8_t* m_data;
+
+            size_t m_capacity;
+
+            int m_eventFd;
+    };
+}
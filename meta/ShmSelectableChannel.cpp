@@ -0,0 +1,426 @@
+#include "ShmSelectableChannel.h"
+
+#include "swss/logger.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <cstring>
+
+using namespace sairedis;
+
+#define SHM_CHANNEL_MAX_EPOLL_EVENTS 3
+
+// same as default sync operation response timeout on client side
+
+#define SHM_CHANNEL_SEND_TIMEOUT_MS (60*1000)
+
+ShmSelectableChannel::ShmSelectableChannel(
+        _In_ const std::string& endpoint,
+        _In_ size_t ringCapacity):
+    m_endpoint(endpoint),
+    m_ringCapacity(ringCapacity),
+    m_memFd(-1),
+    m_memory(MAP_FAILED),
+    m_memorySize(0),
+    m_requestEventFd(-1),
+    m_responseEventFd(-1),
+    m_notificationEventFd(-1),
+    m_listenFd(-1),
+    m_clientFd(-1),
+    m_epollFd(-1)
+{
+    SWSS_LOG_ENTER();
+
+    size_t ringSize = ShmRing::getRequiredSize(ringCapacity);
+
+    m_memorySize = 3 * ringSize;
+
+    m_memFd = memfd_create("sairedis_shm", MFD_CLOEXEC);
+
+    if (m_memFd < 0)
+    {
+        SWSS_LOG_THROW("memfd_create failed: %s", strerror(errno));
+    }
+
+    if (ftruncate(m_memFd, (off_t)m_memorySize) != 0)
+    {
+        SWSS_LOG_THROW("ftruncate to %zu failed: %s", m_memorySize, strerror(errno));
+    }
+
+    m_memory = mmap(nullptr, m_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, m_memFd, 0);
+
+    if (m_memory == MAP_FAILED)
+    {
+        SWSS_LOG_THROW("mmap of %zu bytes failed: %s", m_memorySize, strerror(errno));
+    }
+
+    m_requestEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_responseEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_notificationEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (m_requestEventFd < 0 || m_responseEventFd < 0 || m_notificationEventFd < 0)
+    {
+        SWSS_LOG_THROW("eventfd failed: %s", strerror(errno));
+    }
+
+    auto* memory = static_cast<uint8_t*>(m_memory);
+
+    m_request = std::make_shared<ShmRing>(memory, ringCapacity, m_requestEventFd);
+    m_response = std::make_shared<ShmRing>(memory + ringSize, ringCapacity, m_responseEventFd);
+    m_notification = std::make_shared<ShmRing>(memory + 2 * ringSize, ringCapacity, m_notificationEventFd);
+
+    m_request->reset();
+    m_response->reset();
+    m_notification->reset();
+
+    sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    addr.sun_family = AF_UNIX;
+
+    if (endpoint.size() >= sizeof(addr.sun_path))
+    {
+        SWSS_LOG_THROW("endpoint path %s is too long", endpoint.c_str());
+    }
+
+    strncpy(addr.sun_path, endpoint.c_str(), sizeof(addr.sun_path) - 1);
+
+    SWSS_LOG_NOTICE("binding on %s", endpoint.c_str());
+
+    m_listenFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    if (m_listenFd < 0)
+    {
+        SWSS_LOG_THROW("socket failed: %s", strerror(errno));
+    }
+
+    // socket file left by previous instance would fail bind
+
+    unlink(endpoint.c_str());
+
+    if (bind(m_listenFd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(m_listenFd, 1) != 0)
+    {
+        SWSS_LOG_THROW("failed to listen on endpoint %s: %s", endpoint.c_str(), strerror(errno));
+    }
+
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (m_epollFd < 0)
+    {
+        SWSS_LOG_THROW("epoll_create1 failed: %s", strerror(errno));
+    }
+
+    for (int fd: { m_listenFd, m_requestEventFd })
+    {
+        epoll_event ev;
+
+        memset(&ev, 0, sizeof(ev));
+
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+
+        if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &ev) != 0)
+        {
+            SWSS_LOG_THROW("epoll_ctl failed: %s", strerror(errno));
+        }
+    }
+}
+
+ShmSelectableChannel::~ShmSelectableChannel()
+{
+    SWSS_LOG_ENTER();
+
+    for (int fd: { m_epollFd, m_clientFd, m_listenFd, m_notificationEventFd, m_responseEventFd, m_requestEventFd, m_memFd })
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    if (m_memory != MAP_FAILED)
+    {
+        munmap(m_memory, m_memorySize);
+    }
+
+    unlink(m_endpoint.c_str());
+
+    SWSS_LOG_NOTICE("closed channel %s", m_endpoint.c_str());
+}
+
+void ShmSelectableChannel::acceptClient()
+{
+    SWSS_LOG_ENTER();
+
+    int fd = accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+
+    if (fd < 0)
+    {
+        if (errno != EAGAIN && errno != EINTR)
+        {
+            SWSS_LOG_ERROR("accept on %s failed: %s", m_endpoint.c_str(), strerror(errno));
+        }
+
+        return;
+    }
+
+    if (m_clientFd >= 0)
+    {
+        SWSS_LOG_WARN("new client connected on %s, replacing previous one", m_endpoint.c_str());
+
+        disconnectClient();
+    }
+
+    // messages left by previous client are dropped
+
+    m_request->reset();
+    m_response->reset();
+
+    m_request->clearEvent();
+    m_response->clearEvent();
+
+    {
+        std::lock_guard<std::mutex> lock(m_notificationMutex);
+
+        m_notification->reset();
+        m_notification->clearEvent();
+
+        m_clientFd = fd;
+    }
+
+    int fds[SHM_CHANNEL_FD_COUNT];
+
+    fds[SHM_CHANNEL_FD_MEMORY] = m_memFd;
+    fds[SHM_CHANNEL_FD_REQUEST_EVENT] = m_requestEventFd;
+    fds[SHM_CHANNEL_FD_RESPONSE_EVENT] = m_responseEventFd;
+    fds[SHM_CHANNEL_FD_NOTIFICATION_EVENT] = m_notificationEventFd;
+
+    uint64_t capacity = m_ringCapacity;
+
+    iovec iov;
+
+    iov.iov_base = &capacity;
+    iov.iov_len = sizeof(capacity);
+
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(fds))];
+
+        cmsghdr align;
+
+    } control;
+
+    memset(&control, 0, sizeof(control));
+
+    msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    if (sendmsg(m_clientFd, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(capacity))
+    {
+        SWSS_LOG_ERROR("failed to send descriptors to client on %s: %s", m_endpoint.c_str(), strerror(errno));
+
+        disconnectClient();
+
+        return;
+    }
+
+    // client socket is only watched for disconnect
+
+    epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.fd = m_clientFd;
+
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_clientFd, &ev) != 0)
+    {
+        SWSS_LOG_ERROR("epoll_ctl failed: %s", strerror(errno));
+    }
+
+    SWSS_LOG_NOTICE("client connected on %s", m_endpoint.c_str());
+}
+
+void ShmSelectableChannel::disconnectClient()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_notificationMutex);
+
+    // closed descriptor is removed from epoll automatically
+
+    close(m_clientFd);
+
+    m_clientFd = -1;
+}
+
+bool ShmSelectableChannel::isClientConnected() const
+{
+    SWSS_LOG_ENTER();
+
+    pollfd pfd;
+
+    pfd.fd = m_clientFd;
+    pfd.events = POLLRDHUP;
+    pfd.revents = 0;
+
+    if (poll(&pfd, 1, 0) < 0)
+    {
+        SWSS_LOG_ERROR("poll failed: %s", strerror(errno));
+
+        return false;
+    }
+
+    return (pfd.revents & (POLLRDHUP | POLLHUP | POLLERR | POLLNVAL)) == 0;
+}
+
+// SelectableChannel overrides
+
+bool ShmSelectableChannel::empty()
+{
+    SWSS_LOG_ENTER();
+
+    return m_request->empty();
+}
+
+void ShmSelectableChannel::pop(
+        _Out_ swss::KeyOpFieldsValuesTuple& kco,
+        _In_ bool initViewMode)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_request->pop(kco))
+    {
+        SWSS_LOG_THROW("queue is empty, can't pop");
+    }
+}
+
+void ShmSelectableChannel::set(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_clientFd < 0)
+    {
+        SWSS_LOG_ERROR("no client connected on %s, dropping %s response", m_endpoint.c_str(), op.c_str());
+
+        return;
+    }
+
+    // client reads responses also while its request ring is full, so
+    // response is dropped only when client is gone
+
+    while (!m_response->push(key, values, op, SHM_CHANNEL_SEND_TIMEOUT_MS))
+    {
+        if (!isClientConnected())
+        {
+            SWSS_LOG_ERROR("client disconnected from %s, dropping %s response", m_endpoint.c_str(), op.c_str());
+
+            return;
+        }
+
+        SWSS_LOG_WARN("response ring on %s is still full, retrying %s response", m_endpoint.c_str(), op.c_str());
+    }
+}
+
+void ShmSelectableChannel::sendNotification(
+        _In_ const std::string& op,
+        _In_ const std::string& data,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_notificationMutex);
+
+    if (m_clientFd < 0)
+    {
+        SWSS_LOG_INFO("no client connected on %s, dropping %s notification", m_endpoint.c_str(), op.c_str());
+
+        return;
+    }
+
+    // push doesn't wait for free space, since client which stopped reading
+    // notifications would block readData on this lock, notification is
+    // dropped when ring is full, same as when redis producer fails
+
+    if (!m_notification->push(data, values, op, 0))
+    {
+        SWSS_LOG_ERROR("notification ring on %s is full, dropping %s notification", m_endpoint.c_str(), op.c_str());
+    }
+}
+
+// Selectable overrides
+
+int ShmSelectableChannel::getFd()
+{
+    SWSS_LOG_ENTER();
+
+    return m_epollFd;
+}
+
+uint64_t ShmSelectableChannel::readData()
+{
+    SWSS_LOG_ENTER();
+
+    epoll_event events[SHM_CHANNEL_MAX_EPOLL_EVENTS];
+
+    int count = epoll_wait(m_epollFd, events, SHM_CHANNEL_MAX_EPOLL_EVENTS, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (events[i].data.fd == m_listenFd)
+        {
+            acceptClient();
+        }
+        else if (events[i].data.fd == m_clientFd)
+        {
+            SWSS_LOG_NOTICE("client disconnected from %s", m_endpoint.c_str());
+
+            disconnectClient();
+        }
+    }
+
+    // event is cleared before ring is drained by pop, so request pushed
+    // after that will signal again
+
+    m_request->clearEvent();
+
+    return 0;
+}
+
+bool ShmSelectableChannel::hasData()
+{
+    SWSS_LOG_ENTER();
+
+    return !m_request->empty();
+}
+
+bool ShmSelectableChannel::hasCachedData()
+{
+    SWSS_LOG_ENTER();
+
+    return !m_request->empty();
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "SelectableChannel.h"
+#include "ShmRing.h"
+
+#include "swss/table.h"
+
+#include <memory>
+#include <mutex>
+
+namespace sairedis
+{
+    /**
+     * @brief Descriptors sent to client when it connects, in this order.
+     *
+     * Message payload is ring capacity. Rings are placed in segment in the
+     * same order as their events.
+     */
+    typedef enum _shm_channel_fd_t
+    {
+        SHM_CHANNEL_FD_MEMORY,
+
+        SHM_CHANNEL_FD_REQUEST_EVENT,
+
+        SHM_CHANNEL_FD_RESPONSE_EVENT,
+
+        SHM_CHANNEL_FD_NOTIFICATION_EVENT,
+
+        SHM_CHANNEL_FD_COUNT
+
+    } shm_channel_fd_t;
+
+    /**
+     * @brief Shared memory selectable channel.
+     *
+     * Server side of shared memory transport. Shared memory segment (memfd)
+     * holds request, response and notification ring, each has its own
+     * eventfd for wake ups. Client connects to unix socket on endpoint path
+     * and receives segment and event descriptors, after that all messages are
+     * exchanged through rings only.
+     *
+     * Only single client is supported, new client connection replaces
+     * previous one and all rings are reset.
+     *
+     * Epoll descriptor which watches listening socket, client socket and
+     * request event is exposed to select.
+     */
+    class ShmSelectableChannel:
+        public SelectableChannel
+    {
+        public:
+
+            ShmSelectableChannel(
+                    _In_ const std::string& endpoint,
+                    _In_ size_t ringCapacity = ShmRing::DEFAULT_CAPACITY);
+
+            virtual ~ShmSelectableChannel();
+
+        public: // SelectableChannel overrides
+
+            virtual bool empty() override;
+
+            virtual void pop(
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco,
+                    _In_ bool initViewMode) override;
+
+            virtual void set(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op) override;
+
+        public: // Selectable overrides
+
+            virtual int getFd() override;
+
+            virtual uint64_t readData() override;
+
+            virtual bool hasData() override;
+
+            virtual bool hasCachedData() override;
+
+        public:
+
+            /**
+             * @brief Send notification to client.
+             *
+             * Can be called from different thread than the one processing
+             * requests. Notification is dropped when no client is connected
+             * or when notification ring is full, it never waits for client.
+             */
+            void sendNotification(
+                    _In_ const std::string& op,
+                    _In_ const std::string& data,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+        private:
+
+            void acceptClient();
+
+            void disconnectClient();
+
+            /**
+             * @brief Check without blocking whether client socket is still open.
+             */
+            bool isClientConnected() const;
+
+        private:
+
+            std::string m_endpoint;
+
+            size_t m_ringCapacity;
+
+            int m_memFd;
+
+            void* m_memory;
+
+            size_t m_memorySize;
+
+            int m_requestEventFd;
+
+            int m_responseEventFd;
+
+            int m_notificationEventFd;
+
+            int m_listenFd;
+
+            int m_clientFd;
+
+            int m_epollFd;
+
+            std::shared_ptr<ShmRing> m_request;
+
+            std::shared_ptr<ShmRing> m_response;
+
+            std::shared_ptr<ShmRing> m_notification;
+
+            /**
+             * @brief Guards notification ring and client descriptor, since
+             * notifications are sent from notification thread.
+             */
+            std::mutex m_notificationMutex;
+    };
+}
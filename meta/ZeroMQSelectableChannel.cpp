@@ -4,12 +4,6 @@
 #include "swss/json.h"
 
 #include <zmq.h>
-#include <unistd.h>
-
-#define ZMQ_RESPONSE_BUFFER_SIZE (4*1024*1024)
-
-//#define ZMQ_POLL_TIMEOUT (2*60*1000)
-#define ZMQ_POLL_TIMEOUT (1000)
 
 using namespace sairedis;
 
@@ -18,17 +12,13 @@ ZeroMQSelectableChannel::ZeroMQSelectableChannel(
     m_endpoint(endpoint),
     m_context(nullptr),
     m_socket(nullptr),
-    m_fd(0),
-    m_allowZmqPoll(false),
-    m_runThread(true)
+    m_fd(0)
 {
     SWSS_LOG_ENTER();
 
     SWSS_LOG_NOTICE("binding on %s", endpoint.c_str());
 
-    m_buffer.resize(ZMQ_RESPONSE_BUFFER_SIZE);
-
-    m_context = zmq_ctx_new();;
+    m_context = zmq_ctx_new();
 
     m_socket = zmq_socket(m_context, ZMQ_REP);
 
@@ -51,98 +41,66 @@ ZeroMQSelectableChannel::ZeroMQSelectableChannel(
                 endpoint.c_str(),
                 zmq_errno());
     }
-
-    m_zmlPollThread = std::make_shared<std::thread>(&ZeroMQSelectableChannel::zmqPollThread, this);
 }
 
 ZeroMQSelectableChannel::~ZeroMQSelectableChannel()
 {
     SWSS_LOG_ENTER();
 
-    m_runThread = false;
-    m_allowZmqPoll = true;
-
     zmq_close(m_socket);
     zmq_ctx_destroy(m_context);
 
-    SWSS_LOG_NOTICE("ending zmq poll thread for channel %s", m_endpoint.c_str());
-
-    m_zmlPollThread->join();
-
-    SWSS_LOG_NOTICE("ended zmq poll thread for channel %s", m_endpoint.c_str());
+    SWSS_LOG_NOTICE("closed channel %s", m_endpoint.c_str());
 }
 
-void ZeroMQSelectableChannel::zmqPollThread()
+void ZeroMQSelectableChannel::receiveMessages()
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_NOTICE("begin");
-
-    while (m_runThread)
+    while (true)
     {
-        zmq_pollitem_t items [1] = { };
-
-        items[0].socket = m_socket;
-        items[0].events = ZMQ_POLLIN;
+        // reading ZMQ_EVENTS also processes pending socket commands and
+        // resets ZMQ_FD signal, so it must be done before every receive
 
-        m_allowZmqPoll = false;
+        int zmq_events = 0;
+        size_t zmq_events_len = sizeof(zmq_events);
 
-        int rc = zmq_poll(items, 1, ZMQ_POLL_TIMEOUT);
+        int rc = zmq_getsockopt(m_socket, ZMQ_EVENTS, &zmq_events, &zmq_events_len);
 
-        if (m_runThread == false)
+        if (rc != 0)
         {
-            SWSS_LOG_NOTICE("ending pool thread, since run is false");
-            break;
+            SWSS_LOG_THROW("zmq_getsockopt ZMQ_EVENTS failed, zmqerrno: %d", zmq_errno());
         }
 
-        if (rc <= 0 && zmq_errno() == ETERM)
+        if ((zmq_events & ZMQ_POLLIN) == 0)
         {
-            SWSS_LOG_NOTICE("zmq_poll ETERM");
             break;
         }
 
-        if (rc == 0)
-        {
-            SWSS_LOG_DEBUG("zmq_poll: no events, continue");
-            continue;
-        }
-
-        // TODO we should have loop here in case we get multiple events since
-        // zmq poll will only signal events once, but in our case we don't
-        // expect multiple events, since we want to send/receive
+        zmq_msg_t msg;
 
-        int zmq_events = 0;
-        size_t zmq_events_len = sizeof(zmq_events);
+        zmq_msg_init(&msg);
 
-        rc = zmq_getsockopt(m_socket, ZMQ_EVENTS, &zmq_events, &zmq_events_len);
+        rc = zmq_msg_recv(&msg, m_socket, ZMQ_DONTWAIT);
 
-        if (rc != 0)
+        if (rc < 0)
         {
-            SWSS_LOG_ERROR("zmq_getsockopt FAILED, zmq_errno: %d", zmq_errno());
-            break;
-        }
+            int err = zmq_errno();
 
-        if (rc == 0 && zmq_events & ZMQ_POLLIN)
-        {
-            m_selectableEvent.notify(); // will release epoll
+            zmq_msg_close(&msg);
 
-            while (m_runThread && !m_allowZmqPoll)
+            if (err == EAGAIN || err == EINTR)
             {
-                usleep(10); // could be increased or replaced by spin lock
-
-                //SWSS_LOG_NOTICE("m_allowZmqPoll == false");
+                break;
             }
-        }
-        else
-        {
-            // should not happen, we only except ZMQ_POLLIN events
 
-            SWSS_LOG_ERROR("unknown condition: rc: %d, zmq_events: %d, bug?", rc, zmq_events);
-            break;
+            SWSS_LOG_THROW("zmq_msg_recv failed, zmqerrno: %d", err);
         }
-    }
 
-    SWSS_LOG_NOTICE("end");
+        m_queue.emplace_back((const char*)zmq_msg_data(&msg), zmq_msg_size(&msg));
+
+        zmq_msg_close(&msg);
+    }
 }
 
 // SelectableChannel overrides
@@ -165,8 +123,9 @@ void ZeroMQSelectableChannel::pop(
         SWSS_LOG_THROW("queue is empty, can't pop");
     }
 
-    std::string msg = m_queue.front();
-    m_queue.pop();
+    std::string msg = std::move(m_queue.front());
+
+    m_queue.pop_front();
 
     auto& values = kfvFieldsValues(kco);
 
@@ -201,10 +160,6 @@ void ZeroMQSelectableChannel::set(
 
     int rc = zmq_send(m_socket, msg.c_str(), msg.length(), 0);
 
-    // at this point we already did send/receive pattern, so we can notify
-    // thread that we can poll again
-    m_allowZmqPoll = true;
-
     if (rc <= 0)
     {
         SWSS_LOG_THROW("zmq_send failed, on endpoint %s, zmqerrno: %d: %s",
@@ -212,6 +167,12 @@ void ZeroMQSelectableChannel::set(
                 zmq_errno(),
                 zmq_strerror(zmq_errno()));
     }
+
+    // at this point we already did send/receive pattern, so next request can
+    // be received, ZMQ_FD may not be signaled again for request which
+    // arrived while we were processing, so receive it now
+
+    receiveMessages();
 }
 
 // Selectable overrides
@@ -220,33 +181,14 @@ int ZeroMQSelectableChannel::getFd()
 {
     SWSS_LOG_ENTER();
 
-    return m_selectableEvent.getFd();
+    return m_fd;
 }
 
 uint64_t ZeroMQSelectableChannel::readData()
 {
     SWSS_LOG_ENTER();
 
-    // clear selectable event so it could be triggered in next select()
-    m_selectableEvent.readData();
-
-    int rc = zmq_recv(m_socket, m_buffer.data(), ZMQ_RESPONSE_BUFFER_SIZE, 0);
-
-    if (rc < 0)
-    {
-        SWSS_LOG_THROW("zmq_recv failed, zmqerrno: %d", zmq_errno());
-    }
-
-    if (rc >= ZMQ_RESPONSE_BUFFER_SIZE)
-    {
-        SWSS_LOG_THROW("zmq_recv message was truncated (over %d bytes, received %d), increase buffer size, message DROPPED",
-                ZMQ_RESPONSE_BUFFER_SIZE,
-                rc);
-    }
-
-    m_buffer.at(rc) = 0; // make sure that we end string with zero before parse
-
-    m_queue.push((char*)m_buffer.data());
+    receiveMessages();
 
     return 0;
 }
@@ -3,14 +3,20 @@
 #include "SelectableChannel.h"
 
 #include "swss/table.h"
-#include "swss/selectableevent.h"
 
 #include <deque>
-#include <thread>
 #include <memory>
 
 namespace sairedis
 {
+    /**
+     * @brief ZeroMQ selectable channel.
+     *
+     * Socket ZMQ_FD is exposed directly to select. This descriptor only
+     * signals that socket state may have changed (edge triggered), so every
+     * time it's signaled, and after each send, ZMQ_EVENTS are checked and all
+     * messages that can be received are drained to queue.
+     */
     class ZeroMQSelectableChannel:
         public SelectableChannel
     {
@@ -52,7 +58,14 @@ namespace sairedis
 
         private:
 
-            void zmqPollThread();
+            /**
+             * @brief Receive all messages currently available on socket.
+             *
+             * In REP pattern at most one request can be received before
+             * response is sent, next request is received right after
+             * response is sent.
+             */
+            void receiveMessages();
 
         private:
 
@@ -64,16 +77,6 @@ namespace sairedis
 
             int m_fd;
 
-            std::queue<std::string> m_queue;
-
-            std::vector<uint8_t> m_buffer;
-
-            volatile bool m_allowZmqPoll;
-
-            volatile bool m_runThread;
-
-            std::shared_ptr<std::thread> m_zmlPollThread;
-
-            swss::SelectableEvent m_selectableEvent;
+            std::deque<std::string> m_queue;
     };
 }
@@ -3,7 +3,9 @@
 #include "swss/logger.h"
 #include "swss/select.h"
 #include "swss/table.h"
+#include "swss/tokenize.h"
 
+#include "meta/Globals.h"
 #include "meta/SaiAttributeList.h"
 #include "meta/sai_serialize.h"
 #include "meta/ZeroMQSelectableChannel.h"
@@ -312,8 +314,6 @@ void Proxy::processSingleEvent(
         return;
     }
 
-    // TODO implement bulk create/remove/set/get
-
     if (op == "create")
         return processCreate(kco);
 
@@ -362,6 +362,24 @@ void Proxy::processSingleEvent(
     if (op == "clear_stats")
         return processClearStats(kco);
 
+    if (op == "bulk_create")
+        return processBulkCreate(kco);
+
+    if (op == "bulk_remove")
+        return processBulkRemove(kco);
+
+    if (op == "bulk_set")
+        return processBulkSet(kco);
+
+    if (op == "bulk_get")
+        return processBulkGet(kco);
+
+    if (op == "bulk_get_stats")
+        return processBulkGetStats(kco);
+
+    if (op == "bulk_clear_stats")
+        return processBulkClearStats(kco);
+
     SWSS_LOG_THROW("event op '%s' is not implemented, FIXME", op.c_str());
 }
 
@@ -1087,6 +1105,574 @@ void Proxy::processClearStats(
     m_selectableChannel->set(strStatus, entry, "clear_stats_response");
 }
 
+sai_object_type_t Proxy::deserializeBulk(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _Out_ std::vector<sai_object_meta_key_t>& metaKeys,
+        _Out_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string& key = kfvKey(kco); // objectType:count
+
+    std::string strObjectType = key.substr(0, key.find(":"));
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(strObjectType, objectType);
+
+    if (!sai_metadata_is_object_type_valid(objectType))
+    {
+        SWSS_LOG_THROW("invalid object type %s", key.c_str());
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    metaKeys.clear();
+    attributes.clear();
+
+    metaKeys.reserve(values.size());
+    attributes.reserve(values.size());
+
+    for (auto& fvt: values)
+    {
+        // field = objectId
+        // value = attrid=attrvalue|...
+
+        sai_object_meta_key_t metaKey;
+        sai_deserialize_object_meta_key(strObjectType + ":" + fvField(fvt), metaKey);
+
+        metaKeys.push_back(metaKey);
+
+        std::vector<swss::FieldValueTuple> entries;
+
+        for (auto& item: swss::tokenize(fvValue(fvt), '|'))
+        {
+            auto pos = item.find_first_of("=");
+
+            entries.emplace_back(item.substr(0, pos), item.substr(pos + 1));
+        }
+
+        attributes.push_back(std::make_shared<saimeta::SaiAttributeList>(objectType, entries, false));
+    }
+
+    SWSS_LOG_INFO("bulk %s with %zu items", strObjectType.c_str(), metaKeys.size());
+
+    return objectType;
+}
+
+sai_object_type_t Proxy::deserializeBulkStats(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco,
+        _Out_ sai_object_id_t& switchId,
+        _Out_ std::vector<sai_object_key_t>& objectKeys,
+        _Out_ std::vector<sai_stat_id_t>& counterIds,
+        _Out_ sai_stats_mode_t& mode)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string& key = kfvKey(kco); // objectType:count
+
+    auto pos = key.find(":");
+
+    std::string strObjectType = key.substr(0, pos);
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(strObjectType, objectType);
+
+    auto oi = sai_metadata_get_object_type_info(objectType);
+
+    if (oi == NULL || oi->statenum == NULL)
+    {
+        SWSS_LOG_THROW("invalid object type %s", key.c_str());
+    }
+
+    size_t objectCount = std::stoul(key.substr(pos + 1));
+
+    auto& values = kfvFieldsValues(kco);
+
+    // object keys, counter ids, STATS_MODE, SWITCH_ID
+
+    if (values.size() < objectCount + 2)
+    {
+        SWSS_LOG_THROW("logic error, wrong number of values, got %zu, expected at least %zu", values.size(), objectCount + 2);
+    }
+
+    objectKeys.clear();
+    counterIds.clear();
+
+    for (size_t idx = 0; idx < objectCount; idx++)
+    {
+        sai_object_meta_key_t metaKey;
+        sai_deserialize_object_meta_key(strObjectType + ":" + fvField(values[idx]), metaKey);
+
+        objectKeys.push_back(metaKey.objectkey);
+    }
+
+    for (size_t idx = objectCount; idx < values.size() - 2; idx++)
+    {
+        int32_t stat;
+        sai_deserialize_enum(fvField(values[idx]), oi->statenum, stat);
+
+        counterIds.push_back((sai_stat_id_t)stat);
+    }
+
+    mode = (sai_stats_mode_t)stoull(fvValue(values[values.size() - 2]));
+
+    sai_deserialize_object_id(fvValue(values.back()), switchId);
+
+    return objectType;
+}
+
+void Proxy::sendBulkResponse(
+        _In_ const std::string& response,
+        _In_ sai_status_t status,
+        _In_ const std::vector<sai_status_t>& statuses,
+        _In_ const std::vector<std::string>& values)
+{
+    SWSS_LOG_ENTER();
+
+    // field = object status
+    // value = optional object data
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(statuses.size());
+
+    for (size_t idx = 0; idx < statuses.size(); idx++)
+    {
+        entry.emplace_back(sai_serialize_status(statuses[idx]), values.empty() ? "" : values[idx]);
+    }
+
+    std::string strStatus = sai_serialize_status(status);
+
+    SWSS_LOG_INFO("sending %s with status: %s", response.c_str(), strStatus.c_str());
+
+    m_selectableChannel->set(strStatus, entry, response);
+}
+
+/*
+ * Entry structures are already deserialized as part of object meta key, so
+ * for each bulk entry type we only need to collect them into contiguous array
+ * which is expected by bulk api.
+ */
+
+#define PROXY_BULK_ENTRIES(ot)                                          \
+    std::vector<sai_ ## ot ## _t> entries;                              \
+    entries.reserve(metaKeys.size());                                   \
+    for (auto& mk: metaKeys)                                            \
+        entries.push_back(mk.objectkey.key.ot);
+
+#define DECLARE_BULK_CREATE_ENTRY_CASE(OT,ot)                           \
+    case SAI_OBJECT_TYPE_ ## OT:                                        \
+    {                                                                   \
+        PROXY_BULK_ENTRIES(ot)                                          \
+        status = m_vendorSai->bulkCreate(                               \
+                objectCount,                                            \
+                entries.data(),                                         \
+                attrCounts.data(),                                      \
+                attrLists.data(),                                       \
+                mode,                                                   \
+                statuses.data());                                       \
+        break;                                                          \
+    }
+
+#define DECLARE_BULK_REMOVE_ENTRY_CASE(OT,ot)                           \
+    case SAI_OBJECT_TYPE_ ## OT:                                        \
+    {                                                                   \
+        PROXY_BULK_ENTRIES(ot)                                          \
+        status = m_vendorSai->bulkRemove(                               \
+                objectCount,                                            \
+                entries.data(),                                         \
+                mode,                                                   \
+                statuses.data());                                       \
+        break;                                                          \
+    }
+
+#define DECLARE_BULK_SET_ENTRY_CASE(OT,ot)                              \
+    case SAI_OBJECT_TYPE_ ## OT:                                        \
+    {                                                                   \
+        PROXY_BULK_ENTRIES(ot)                                          \
+        status = m_vendorSai->bulkSet(                                  \
+                objectCount,                                            \
+                entries.data(),                                         \
+                attrs.data(),                                           \
+                mode,                                                   \
+                statuses.data());                                       \
+        break;                                                          \
+    }
+
+#define DECLARE_BULK_GET_ENTRY_CASE(OT,ot)                              \
+    case SAI_OBJECT_TYPE_ ## OT:                                        \
+    {                                                                   \
+        PROXY_BULK_ENTRIES(ot)                                          \
+        status = m_vendorSai->bulkGet(                                  \
+                objectCount,                                            \
+                entries.data(),                                         \
+                attrCounts.data(),                                      \
+                attrLists.data(),                                       \
+                mode,                                                   \
+                statuses.data());                                       \
+        break;                                                          \
+    }
+
+void Proxy::processBulkCreate(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> metaKeys;
+    std::vector<std::shared_ptr<saimeta::SaiAttributeList>> attributes;
+
+    auto objectType = deserializeBulk(kco, metaKeys, attributes);
+
+    uint32_t objectCount = (uint32_t)metaKeys.size();
+
+    std::vector<uint32_t> attrCounts;
+    std::vector<const sai_attribute_t*> attrLists;
+
+    for (auto& list: attributes)
+    {
+        if (objectType == SAI_OBJECT_TYPE_SWITCH)
+        {
+            updateAttributteNotificationPointers(list->get_attr_count(), list->get_attr_list());
+        }
+
+        attrCounts.push_back(list->get_attr_count());
+        attrLists.push_back(list->get_attr_list());
+    }
+
+    sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    std::vector<sai_object_id_t> objectIds(objectCount, SAI_NULL_OBJECT_ID);
+
+    sai_status_t status = SAI_STATUS_NOT_SUPPORTED;
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isobjectid)
+    {
+        // all passed oids are switch ids, since client don't know what oid
+        // will be assigned to created object
+
+        sai_object_id_t switchId = objectCount ? metaKeys[0].objectkey.key.object_id : SAI_NULL_OBJECT_ID;
+
+        status = m_vendorSai->bulkCreate(
+                objectType,
+                switchId,
+                objectCount,
+                attrCounts.data(),
+                attrLists.data(),
+                mode,
+                objectIds.data(),
+                statuses.data());
+    }
+    else
+    {
+        switch ((int)objectType)
+        {
+            SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_CREATE_ENTRY_CASE);
+
+            default:
+                SWSS_LOG_ERROR("object type %s is not supported in bulk", info->objecttypename);
+                break;
+        }
+    }
+
+    // statuses followed by created oids, same as syncd bulk create response
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(2 * objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        entry.emplace_back(sai_serialize_status(statuses[idx]), "");
+    }
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        entry.emplace_back("oid", sai_serialize_object_id(objectIds[idx]));
+    }
+
+    std::string strStatus = sai_serialize_status(status);
+
+    m_selectableChannel->set(strStatus, entry, "bulk_create_response");
+}
+
+void Proxy::processBulkRemove(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> metaKeys;
+    std::vector<std::shared_ptr<saimeta::SaiAttributeList>> attributes;
+
+    auto objectType = deserializeBulk(kco, metaKeys, attributes);
+
+    uint32_t objectCount = (uint32_t)metaKeys.size();
+
+    sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    sai_status_t status = SAI_STATUS_NOT_SUPPORTED;
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isobjectid)
+    {
+        std::vector<sai_object_id_t> objectIds;
+
+        for (auto& mk: metaKeys)
+        {
+            objectIds.push_back(mk.objectkey.key.object_id);
+        }
+
+        status = m_vendorSai->bulkRemove(objectType, objectCount, objectIds.data(), mode, statuses.data());
+    }
+    else
+    {
+        switch ((int)objectType)
+        {
+            SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_REMOVE_ENTRY_CASE);
+
+            default:
+                SWSS_LOG_ERROR("object type %s is not supported in bulk", info->objecttypename);
+                break;
+        }
+    }
+
+    sendBulkResponse("bulk_remove_response", status, statuses, {});
+}
+
+void Proxy::processBulkSet(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> metaKeys;
+    std::vector<std::shared_ptr<saimeta::SaiAttributeList>> attributes;
+
+    auto objectType = deserializeBulk(kco, metaKeys, attributes);
+
+    uint32_t objectCount = (uint32_t)metaKeys.size();
+
+    std::vector<sai_attribute_t> attrs;
+
+    for (auto& list: attributes)
+    {
+        if (list->get_attr_count() != 1)
+        {
+            SWSS_LOG_THROW("bulk set expects exactly 1 attribute per object, got %u", list->get_attr_count());
+        }
+
+        if (objectType == SAI_OBJECT_TYPE_SWITCH)
+        {
+            updateAttributteNotificationPointers(1, list->get_attr_list());
+        }
+
+        attrs.push_back(list->get_attr_list()[0]);
+    }
+
+    sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    sai_status_t status = SAI_STATUS_NOT_SUPPORTED;
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isobjectid)
+    {
+        std::vector<sai_object_id_t> objectIds;
+
+        for (auto& mk: metaKeys)
+        {
+            objectIds.push_back(mk.objectkey.key.object_id);
+        }
+
+        status = m_vendorSai->bulkSet(objectType, objectCount, objectIds.data(), attrs.data(), mode, statuses.data());
+    }
+    else
+    {
+        switch ((int)objectType)
+        {
+            SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_SET_ENTRY_CASE);
+
+            default:
+                SWSS_LOG_ERROR("object type %s is not supported in bulk", info->objecttypename);
+                break;
+        }
+    }
+
+    sendBulkResponse("bulk_set_response", status, statuses, {});
+}
+
+void Proxy::processBulkGet(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_meta_key_t> metaKeys;
+    std::vector<std::shared_ptr<saimeta::SaiAttributeList>> attributes;
+
+    auto objectType = deserializeBulk(kco, metaKeys, attributes);
+
+    uint32_t objectCount = (uint32_t)metaKeys.size();
+
+    std::vector<uint32_t> attrCounts;
+    std::vector<sai_attribute_t*> attrLists;
+
+    for (auto& list: attributes)
+    {
+        attrCounts.push_back(list->get_attr_count());
+        attrLists.push_back(list->get_attr_list());
+    }
+
+    sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    sai_status_t status = SAI_STATUS_NOT_SUPPORTED;
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isobjectid)
+    {
+        std::vector<sai_object_id_t> objectIds;
+
+        for (auto& mk: metaKeys)
+        {
+            objectIds.push_back(mk.objectkey.key.object_id);
+        }
+
+        status = m_vendorSai->bulkGet(
+                objectType,
+                objectCount,
+                objectIds.data(),
+                attrCounts.data(),
+                attrLists.data(),
+                mode,
+                statuses.data());
+    }
+    else
+    {
+        switch ((int)objectType)
+        {
+            SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_GET_ENTRY_CASE);
+
+            default:
+                SWSS_LOG_ERROR("object type %s is not supported in bulk", info->objecttypename);
+                break;
+        }
+    }
+
+    std::vector<std::string> values;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        if (statuses[idx] != SAI_STATUS_SUCCESS && statuses[idx] != SAI_STATUS_BUFFER_OVERFLOW)
+        {
+            values.emplace_back();
+
+            continue;
+        }
+
+        // on buffer overflow serialize only list counts, see processGet
+
+        auto entry = saimeta::SaiAttributeList::serialize_attr_list(
+                objectType,
+                attrCounts[idx],
+                attrLists[idx],
+                statuses[idx] == SAI_STATUS_BUFFER_OVERFLOW);
+
+        values.push_back(saimeta::Globals::joinFieldValues(entry));
+    }
+
+    sendBulkResponse("bulk_get_response", status, statuses, values);
+}
+
+void Proxy::processBulkGetStats(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t switchId;
+    std::vector<sai_object_key_t> objectKeys;
+    std::vector<sai_stat_id_t> counterIds;
+    sai_stats_mode_t mode;
+
+    auto objectType = deserializeBulkStats(kco, switchId, objectKeys, counterIds, mode);
+
+    uint32_t objectCount = (uint32_t)objectKeys.size();
+    uint32_t numberOfCounters = (uint32_t)counterIds.size();
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    std::vector<uint64_t> counters(objectCount * numberOfCounters);
+
+    auto status = m_vendorSai->bulkGetStats(
+            switchId,
+            objectType,
+            objectCount,
+            objectKeys.data(),
+            numberOfCounters,
+            counterIds.data(),
+            mode,
+            statuses.data(),
+            counters.data());
+
+    std::vector<std::string> values;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        std::string joined;
+
+        for (uint32_t i = 0; statuses[idx] == SAI_STATUS_SUCCESS && i < numberOfCounters; i++)
+        {
+            if (i != 0)
+            {
+                joined += "|";
+            }
+
+            joined += std::to_string(counters[idx * numberOfCounters + i]);
+        }
+
+        values.push_back(joined);
+    }
+
+    sendBulkResponse("bulk_get_stats_response", status, statuses, values);
+}
+
+void Proxy::processBulkClearStats(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t switchId;
+    std::vector<sai_object_key_t> objectKeys;
+    std::vector<sai_stat_id_t> counterIds;
+    sai_stats_mode_t mode;
+
+    auto objectType = deserializeBulkStats(kco, switchId, objectKeys, counterIds, mode);
+
+    uint32_t objectCount = (uint32_t)objectKeys.size();
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_FAILURE);
+
+    auto status = m_vendorSai->bulkClearStats(
+            switchId,
+            objectType,
+            objectCount,
+            objectKeys.data(),
+            (uint32_t)counterIds.size(),
+            counterIds.data(),
+            mode,
+            statuses.data());
+
+    sendBulkResponse("bulk_clear_stats_response", status, statuses, {});
+}
+
 void Proxy::updateAttributteNotificationPointers(
         _In_ uint32_t count,
         _Inout_ sai_attribute_t* attr_list)
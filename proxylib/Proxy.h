@@ -3,6 +3,7 @@
 #include "swss/selectableevent.h"
 
 #include "meta/SaiInterface.h"
+#include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
 
 #include "syncd/ServiceMethodTable.h"
@@ -15,6 +16,7 @@
 #include <memory>
 #include <thread>
 #include <string>
+#include <vector>
 
 namespace saiproxy
 {
@@ -106,6 +108,44 @@ namespace saiproxy
             void processClearStats(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            void processBulkCreate(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processBulkRemove(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processBulkSet(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processBulkGet(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processBulkGetStats(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            void processBulkClearStats(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+        private: // bulk helpers
+
+            sai_object_type_t deserializeBulk(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco,
+                    _Out_ std::vector<sai_object_meta_key_t>& metaKeys,
+                    _Out_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes);
+
+            sai_object_type_t deserializeBulkStats(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco,
+                    _Out_ sai_object_id_t& switchId,
+                    _Out_ std::vector<sai_object_key_t>& objectKeys,
+                    _Out_ std::vector<sai_stat_id_t>& counterIds,
+                    _Out_ sai_stats_mode_t& mode);
+
+            void sendBulkResponse(
+                    _In_ const std::string& response,
+                    _In_ sai_status_t status,
+                    _In_ const std::vector<sai_status_t>& statuses,
+                    _In_ const std::vector<std::string>& values);
+
         private: // notifications
 
             void onFdbEvent(
@@ -6,8 +6,11 @@
 #include "NotificationFactory.h"
 
 #include "meta/Meta.h"
+#include "meta/Globals.h"
 #include "meta/sai_serialize.h"
 
+#include "swss/tokenize.h"
+
 using namespace saiproxy;
 using namespace std::placeholders;
 
@@ -564,11 +567,25 @@ sai_status_t Sai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
+    MUTEX();
     SWSS_LOG_ENTER();
-
-    SWSS_LOG_ERROR("not implemented, FIXME");
-
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PROXY_CHECK_API_INITIALIZED();
+    PROXY_CHECK_POINTER(object_key);
+    PROXY_CHECK_POINTER(counter_ids);
+    PROXY_CHECK_POINTER(object_statuses);
+    PROXY_CHECK_POINTER(counters);
+
+    return bulkStats(
+            "bulk_get_stats",
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -581,11 +598,24 @@ sai_status_t Sai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
+    MUTEX();
     SWSS_LOG_ENTER();
+    PROXY_CHECK_API_INITIALIZED();
+    PROXY_CHECK_POINTER(object_key);
+    PROXY_CHECK_POINTER(counter_ids);
+    PROXY_CHECK_POINTER(object_statuses);
 
-    SWSS_LOG_ERROR("not implemented, FIXME");
-
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return bulkStats(
+            "bulk_clear_stats",
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            nullptr);
 }
 
 // BULK QUAD OID
@@ -606,9 +636,18 @@ sai_status_t Sai::bulkCreate(
     PROXY_CHECK_POINTER(object_id);
     PROXY_CHECK_POINTER(object_statuses);
 
-    SWSS_LOG_ERROR("not implemented, FIXME");
+    // proxy is responsible for generating new OIDs but for that it needs
+    // switch ID, so instead of sending empty oids we will send switch IDs
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    std::vector<std::string> serializedObjectIds(object_count, sai_serialize_object_id(switch_id));
+
+    return bulkCreate(
+            object_type,
+            serializedObjectIds,
+            attr_count,
+            attr_list,
+            object_statuses,
+            object_id);
 }
 
 sai_status_t Sai::bulkRemove(
@@ -624,9 +663,16 @@ sai_status_t Sai::bulkRemove(
     PROXY_CHECK_POINTER(object_id);
     PROXY_CHECK_POINTER(object_statuses);
 
-    SWSS_LOG_ERROR("not implemented, FIXME");
+    std::vector<std::string> serializedObjectIds;
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    serializedObjectIds.reserve(object_count);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        serializedObjectIds.emplace_back(sai_serialize_object_id(object_id[idx]));
+    }
+
+    return bulkRemove(object_type, serializedObjectIds, object_statuses);
 }
 
 sai_status_t Sai::bulkSet(
@@ -640,11 +686,20 @@ sai_status_t Sai::bulkSet(
     MUTEX();
     SWSS_LOG_ENTER();
     PROXY_CHECK_API_INITIALIZED();
+    PROXY_CHECK_POINTER(object_id);
+    PROXY_CHECK_POINTER(attr_list);
     PROXY_CHECK_POINTER(object_statuses);
 
-    SWSS_LOG_ERROR("not implemented, FIXME");
+    std::vector<std::string> serializedObjectIds;
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    serializedObjectIds.reserve(object_count);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        serializedObjectIds.emplace_back(sai_serialize_object_id(object_id[idx]));
+    }
+
+    return bulkSet(object_type, serializedObjectIds, attr_list, object_statuses);
 }
 
 sai_status_t Sai::bulkGet(
@@ -658,10 +713,22 @@ sai_status_t Sai::bulkGet(
 {
     MUTEX();
     SWSS_LOG_ENTER();
+    PROXY_CHECK_API_INITIALIZED();
+    PROXY_CHECK_POINTER(object_id);
+    PROXY_CHECK_POINTER(attr_count);
+    PROXY_CHECK_POINTER(attr_list);
+    PROXY_CHECK_POINTER(object_statuses);
 
-    SWSS_LOG_ERROR("not implemented, FIXME");
+    std::vector<std::string> serializedObjectIds;
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    serializedObjectIds.reserve(object_count);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        serializedObjectIds.emplace_back(sai_serialize_object_id(object_id[idx]));
+    }
+
+    return bulkGet(object_type, serializedObjectIds, attr_count, attr_list, object_statuses);
 }
 
 // BULK QUAD ENTRY
@@ -679,8 +746,21 @@ sai_status_t Sai::bulkCreate(                               \
     SWSS_LOG_ENTER();                                       \
     PROXY_CHECK_API_INITIALIZED();                          \
     PROXY_CHECK_POINTER(entries)                            \
-    SWSS_LOG_ERROR("not implemented, FIXME");               \
-    return SAI_STATUS_NOT_IMPLEMENTED;                      \
+    PROXY_CHECK_POINTER(object_statuses)                    \
+    std::vector<std::string> serializedObjectIds;           \
+    serializedObjectIds.reserve(object_count);              \
+    for (uint32_t idx = 0; idx < object_count; idx++)       \
+    {                                                       \
+        serializedObjectIds.emplace_back(                   \
+                sai_serialize_ ## ot(entries[idx]));        \
+    }                                                       \
+    return bulkCreate(                                      \
+            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,      \
+            serializedObjectIds,                            \
+            attr_count,                                     \
+            attr_list,                                      \
+            object_statuses,                                \
+            nullptr);                                       \
 }
 
 SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_CREATE_ENTRY);
@@ -698,8 +778,18 @@ sai_status_t Sai::bulkRemove(                               \
     SWSS_LOG_ENTER();                                       \
     PROXY_CHECK_API_INITIALIZED();                          \
     PROXY_CHECK_POINTER(entries)                            \
-    SWSS_LOG_ERROR("not implemented, FIXME");               \
-    return SAI_STATUS_NOT_IMPLEMENTED;                      \
+    PROXY_CHECK_POINTER(object_statuses)                    \
+    std::vector<std::string> serializedObjectIds;           \
+    serializedObjectIds.reserve(object_count);              \
+    for (uint32_t idx = 0; idx < object_count; idx++)       \
+    {                                                       \
+        serializedObjectIds.emplace_back(                   \
+                sai_serialize_ ## ot(entries[idx]));        \
+    }                                                       \
+    return bulkRemove(                                      \
+            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,      \
+            serializedObjectIds,                            \
+            object_statuses);                               \
 }
 
 SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_REMOVE_ENTRY);
@@ -718,8 +808,20 @@ sai_status_t Sai::bulkSet(                                  \
     SWSS_LOG_ENTER();                                       \
     PROXY_CHECK_API_INITIALIZED();                          \
     PROXY_CHECK_POINTER(entries)                            \
-    SWSS_LOG_ERROR("not implemented, FIXME");               \
-    return SAI_STATUS_NOT_IMPLEMENTED;                      \
+    PROXY_CHECK_POINTER(attr_list)                          \
+    PROXY_CHECK_POINTER(object_statuses)                    \
+    std::vector<std::string> serializedObjectIds;           \
+    serializedObjectIds.reserve(object_count);              \
+    for (uint32_t idx = 0; idx < object_count; idx++)       \
+    {                                                       \
+        serializedObjectIds.emplace_back(                   \
+                sai_serialize_ ## ot(entries[idx]));        \
+    }                                                       \
+    return bulkSet(                                         \
+            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,      \
+            serializedObjectIds,                            \
+            attr_list,                                      \
+            object_statuses);                               \
 }
 
 SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_SET_ENTRY);
@@ -729,7 +831,7 @@ SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_SET_ENTRY);
 #define DECLARE_BULK_GET_ENTRY(OT,ot)                       \
 sai_status_t Sai::bulkGet(                                  \
         _In_ uint32_t object_count,                         \
-        _In_ const sai_ ## ot ## _t *ot,                    \
+        _In_ const sai_ ## ot ## _t *entries,               \
         _In_ const uint32_t *attr_count,                    \
         _Inout_ sai_attribute_t **attr_list,                \
         _In_ sai_bulk_op_error_mode_t mode,                 \
@@ -737,12 +839,355 @@ sai_status_t Sai::bulkGet(                                  \
 {                                                           \
     MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
-    SWSS_LOG_ERROR("FIXME not implemented");                \
-    return SAI_STATUS_NOT_IMPLEMENTED;                      \
+    PROXY_CHECK_API_INITIALIZED();                          \
+    PROXY_CHECK_POINTER(entries)                            \
+    PROXY_CHECK_POINTER(attr_count)                         \
+    PROXY_CHECK_POINTER(attr_list)                          \
+    PROXY_CHECK_POINTER(object_statuses)                    \
+    std::vector<std::string> serializedObjectIds;           \
+    serializedObjectIds.reserve(object_count);              \
+    for (uint32_t idx = 0; idx < object_count; idx++)       \
+    {                                                       \
+        serializedObjectIds.emplace_back(                   \
+                sai_serialize_ ## ot(entries[idx]));        \
+    }                                                       \
+    return bulkGet(                                         \
+            (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT,      \
+            serializedObjectIds,                            \
+            attr_count,                                     \
+            attr_list,                                      \
+            object_statuses);                               \
 }
 
 SAIREDIS_DECLARE_EVERY_BULK_ENTRY(DECLARE_BULK_GET_ENTRY);
 
+// BULK HELPERS
+
+sai_status_t Sai::bulkCreate(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& serializedObjectIds,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _Out_ sai_status_t *object_statuses,
+        _Out_ sai_object_id_t *object_id)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t objectCount = (uint32_t)serializedObjectIds.size();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        auto entry = saimeta::SaiAttributeList::serialize_attr_list(objectType, attr_count[idx], attr_list[idx], false);
+
+        if (entry.empty())
+        {
+            // make sure that object is created even if there are no attributes
+
+            entry.emplace_back("NULL", "NULL");
+        }
+
+        entries.emplace_back(serializedObjectIds[idx], saimeta::Globals::joinFieldValues(entry));
+    }
+
+    // key:         object_type:count
+    // field:       object_id (switch id for object id types)
+    // value:       object_attrs
+
+    std::string key = sai_serialize_object_type(objectType) + ":" + std::to_string(objectCount);
+
+    m_communicationChannel->set(key, entries, "bulk_create");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForBulkResponse("bulk_create_response", objectCount, object_statuses, kco);
+
+    if (object_id)
+    {
+        // create response contains statuses followed by created oids
+
+        auto& values = kfvFieldsValues(kco);
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            object_id[idx] = SAI_NULL_OBJECT_ID;
+
+            if (object_statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                sai_deserialize_object_id(fvValue(values.at(objectCount + idx)), object_id[idx]);
+            }
+        }
+    }
+
+    return status;
+}
+
+sai_status_t Sai::bulkRemove(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& serializedObjectIds,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t objectCount = (uint32_t)serializedObjectIds.size();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(objectCount);
+
+    for (auto& serializedObjectId: serializedObjectIds)
+    {
+        entries.emplace_back(serializedObjectId, "");
+    }
+
+    std::string key = sai_serialize_object_type(objectType) + ":" + std::to_string(objectCount);
+
+    m_communicationChannel->set(key, entries, "bulk_remove");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    return waitForBulkResponse("bulk_remove_response", objectCount, object_statuses, kco);
+}
+
+sai_status_t Sai::bulkSet(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& serializedObjectIds,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t objectCount = (uint32_t)serializedObjectIds.size();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        auto entry = saimeta::SaiAttributeList::serialize_attr_list(objectType, 1, &attr_list[idx], false);
+
+        entries.emplace_back(serializedObjectIds[idx], saimeta::Globals::joinFieldValues(entry));
+    }
+
+    std::string key = sai_serialize_object_type(objectType) + ":" + std::to_string(objectCount);
+
+    m_communicationChannel->set(key, entries, "bulk_set");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForBulkResponse("bulk_set_response", objectCount, object_statuses, kco);
+
+    if (objectType == SAI_OBJECT_TYPE_SWITCH)
+    {
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            if (object_statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                updateNotifications(1, &attr_list[idx]);
+            }
+        }
+    }
+
+    return status;
+}
+
+sai_status_t Sai::bulkGet(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& serializedObjectIds,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _Out_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t objectCount = (uint32_t)serializedObjectIds.size();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        // user may reuse buffers, send all oids as null to proxy
+
+        sairedis::Utils::clearOidValues(objectType, attr_count[idx], attr_list[idx]);
+
+        auto entry = saimeta::SaiAttributeList::serialize_attr_list(objectType, attr_count[idx], attr_list[idx], false);
+
+        entries.emplace_back(serializedObjectIds[idx], saimeta::Globals::joinFieldValues(entry));
+    }
+
+    std::string key = sai_serialize_object_type(objectType) + ":" + std::to_string(objectCount);
+
+    m_communicationChannel->set(key, entries, "bulk_get");
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForBulkResponse("bulk_get_response", objectCount, object_statuses, kco);
+
+    auto& values = kfvFieldsValues(kco);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        // field = status
+        // value = attrid=attrvalue|...
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS && object_statuses[idx] != SAI_STATUS_BUFFER_OVERFLOW)
+        {
+            continue;
+        }
+
+        bool countOnly = (object_statuses[idx] == SAI_STATUS_BUFFER_OVERFLOW);
+
+        std::vector<swss::FieldValueTuple> attrs;
+
+        for (auto& item: swss::tokenize(fvValue(values[idx]), '|'))
+        {
+            auto pos = item.find_first_of("=");
+
+            attrs.emplace_back(item.substr(0, pos), item.substr(pos + 1));
+        }
+
+        saimeta::SaiAttributeList list(objectType, attrs, countOnly);
+
+        transfer_attributes(objectType, attr_count[idx], list.get_attr_list(), attr_list[idx], countOnly);
+    }
+
+    return status;
+}
+
+sai_status_t Sai::bulkStats(
+        _In_ const std::string& op,
+        _In_ sai_object_id_t switchId,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto oi = sai_metadata_get_object_type_info(objectType);
+
+    if (oi == NULL || oi->statenum == NULL)
+    {
+        SWSS_LOG_ERROR("invalid object type: %s", sai_serialize_object_type(objectType).c_str());
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    // key:         object_type:count
+    // values:      object keys, counter ids, STATS_MODE, SWITCH_ID
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(object_count + number_of_counters + 2);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_object_meta_key_t metaKey;
+
+        metaKey.objecttype = objectType;
+        metaKey.objectkey = object_key[idx];
+
+        auto strMetaKey = sai_serialize_object_meta_key(metaKey);
+
+        entries.emplace_back(strMetaKey.substr(strMetaKey.find(":") + 1), "");
+    }
+
+    for (uint32_t idx = 0; idx < number_of_counters; idx++)
+    {
+        entries.emplace_back(sai_serialize_enum(counter_ids[idx], oi->statenum), "");
+    }
+
+    entries.emplace_back("STATS_MODE", std::to_string(mode)); // TODO add serialize
+    entries.emplace_back("SWITCH_ID", sai_serialize_object_id(switchId));
+
+    std::string key = sai_serialize_object_type(objectType) + ":" + std::to_string(object_count);
+
+    m_communicationChannel->set(key, entries, op);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = waitForBulkResponse(op + "_response", object_count, object_statuses, kco);
+
+    if (counters == nullptr)
+    {
+        return status;
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        // value = counter|counter|...
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        auto items = swss::tokenize(fvValue(values[idx]), '|');
+
+        if (items.size() != number_of_counters)
+        {
+            SWSS_LOG_THROW("logic error, wrong number of counters, got %zu, expected %u", items.size(), number_of_counters);
+        }
+
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[idx * number_of_counters + i] = stoull(items[i]);
+        }
+    }
+
+    return status;
+}
+
+sai_status_t Sai::waitForBulkResponse(
+        _In_ const std::string& response,
+        _In_ uint32_t object_count,
+        _Out_ sai_status_t *object_statuses,
+        _Out_ swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto status = m_communicationChannel->wait(response, kco);
+
+    auto& values = kfvFieldsValues(kco);
+
+    if (values.size() < object_count)
+    {
+        // no response from proxy, or response is malformed
+
+        SWSS_LOG_ERROR("wrong number of statuses, got %zu, expected %u", values.size(), object_count);
+
+        values.clear();
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = SAI_STATUS_FAILURE;
+        }
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    // first object_count fields are statuses for all objects
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_deserialize_status(fvField(values[idx]), object_statuses[idx]);
+    }
+
+    return status;
+}
+
 // NON QUAD API
 
 sai_status_t Sai::flushFdbEntries(
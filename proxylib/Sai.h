@@ -213,6 +213,59 @@ namespace saiproxy
                     _In_ uint32_t attr_count,
                     _Inout_ sai_attribute_t *attr_list);
 
+        private:    // BULK helpers
+
+            /*
+             * Bulk requests use the same encoding as syncd bulk operations,
+             * key is "object_type:count", field is serialized object id and
+             * value is joined attribute list. Error mode is not transferred,
+             * proxy executes bulk with ignore error mode.
+             */
+
+            sai_status_t bulkCreate(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& serializedObjectIds,
+                    _In_ const uint32_t *attr_count,
+                    _In_ const sai_attribute_t **attr_list,
+                    _Out_ sai_status_t *object_statuses,
+                    _Out_ sai_object_id_t *object_id);
+
+            sai_status_t bulkRemove(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& serializedObjectIds,
+                    _Out_ sai_status_t *object_statuses);
+
+            sai_status_t bulkSet(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& serializedObjectIds,
+                    _In_ const sai_attribute_t *attr_list,
+                    _Out_ sai_status_t *object_statuses);
+
+            sai_status_t bulkGet(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& serializedObjectIds,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ sai_attribute_t **attr_list,
+                    _Out_ sai_status_t *object_statuses);
+
+            sai_status_t bulkStats(
+                    _In_ const std::string& op,
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
+            sai_status_t waitForBulkResponse(
+                    _In_ const std::string& response,
+                    _In_ uint32_t object_count,
+                    _Out_ sai_status_t *object_statuses,
+                    _Out_ swss::KeyOpFieldsValuesTuple& kco);
+
         private:
 
             //sai_switch_notifications_t handle_notification(
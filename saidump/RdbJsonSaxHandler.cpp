@@ -0,0 +1,233 @@
+#include "RdbJsonSaxHandler.h"
+#include "swss/logger.h"
+
+using namespace syncd;
+
+RdbJsonSaxHandler::RdbJsonSaxHandler(
+        _In_ const std::string& table,
+        _In_ Callback callback):
+    m_table(table),
+    m_callback(callback),
+    m_entryMatch(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+const std::string& RdbJsonSaxHandler::getError() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_error;
+}
+
+bool RdbJsonSaxHandler::value(
+        _In_ const std::string* str)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.empty())
+    {
+        return true;
+    }
+
+    switch (m_stack.back())
+    {
+        case Frame::ENTRIES:
+
+            if (m_entryMatch)
+            {
+                m_callback(m_entryKey, nullptr);
+            }
+
+            return true;
+
+        case Frame::ATTRS:
+
+            if (m_attrKey == "NULL")
+            {
+                return true;
+            }
+
+            if (str == nullptr)
+            {
+                m_error = "value of " + m_entryKey + " field " + m_attrKey + " is not a string";
+                return false;
+            }
+
+            m_attrs[m_attrKey] = *str;
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+bool RdbJsonSaxHandler::nested(
+        _In_ bool object)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.empty() || m_stack.back() == Frame::ARRAY)
+    {
+        m_stack.push_back(object ? Frame::ENTRIES : Frame::ARRAY);
+        return true;
+    }
+
+    switch (m_stack.back())
+    {
+        case Frame::ENTRIES:
+
+            if (m_entryMatch && object)
+            {
+                m_attrs.clear();
+                m_stack.push_back(Frame::ATTRS);
+                return true;
+            }
+
+            if (m_entryMatch)
+            {
+                m_callback(m_entryKey, nullptr);
+            }
+
+            m_stack.push_back(Frame::SKIP);
+            return true;
+
+        case Frame::ATTRS:
+
+            m_error = "value of " + m_entryKey + " field " + m_attrKey + " is not a string";
+            return false;
+
+        default:
+
+            m_stack.push_back(Frame::SKIP);
+            return true;
+    }
+}
+
+bool RdbJsonSaxHandler::null()
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::boolean(bool val)
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::number_integer(number_integer_t val)
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::number_unsigned(number_unsigned_t val)
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::number_float(number_float_t val, const string_t& s)
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::string(string_t& val)
+{
+    SWSS_LOG_ENTER();
+
+    return value(&val);
+}
+
+bool RdbJsonSaxHandler::binary(binary_t& val)
+{
+    SWSS_LOG_ENTER();
+
+    return value(nullptr);
+}
+
+bool RdbJsonSaxHandler::start_object(std::size_t elements)
+{
+    SWSS_LOG_ENTER();
+
+    return nested(true);
+}
+
+bool RdbJsonSaxHandler::key(string_t& val)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.back() == Frame::ATTRS)
+    {
+        m_attrKey = val;
+        return true;
+    }
+
+    if (m_stack.back() != Frame::ENTRIES)
+    {
+        return true;
+    }
+
+    // filter out items from other tables, like "ROUTE_TABLE:..."
+
+    size_t pos = val.find_first_of(":");
+
+    m_entryMatch = (pos != std::string::npos) && (val.substr(0, pos) == m_table);
+
+    if (m_entryMatch)
+    {
+        m_entryKey = val.substr(pos + 1);
+    }
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::end_object()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_stack.back() == Frame::ATTRS)
+    {
+        m_callback(m_entryKey, &m_attrs);
+
+        m_attrs.clear();
+    }
+
+    m_stack.pop_back();
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::start_array(std::size_t elements)
+{
+    SWSS_LOG_ENTER();
+
+    return nested(false);
+}
+
+bool RdbJsonSaxHandler::end_array()
+{
+    SWSS_LOG_ENTER();
+
+    m_stack.pop_back();
+
+    return true;
+}
+
+bool RdbJsonSaxHandler::parse_error(std::size_t position, const std::string& last_token, const nlohmann::detail::exception& ex)
+{
+    SWSS_LOG_ENTER();
+
+    m_error = ex.what();
+
+    return false;
+}
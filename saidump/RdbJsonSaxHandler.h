@@ -0,0 +1,84 @@
+#pragma once
+#include "swss/table.h"
+#include <nlohmann/json.hpp>
+#include <functional>
+#include <vector>
+
+namespace syncd
+{
+    /*
+     * SAX handler for RDB JSON file, created by redis-rdb-tools from
+     * dump.rdb. Instead of building DOM of the whole file, it reports each
+     * table entry as soon as its attributes are parsed, so memory usage is
+     * bounded by the size of the largest entry and not by the file size.
+     *
+     * Callback receives entry key without table prefix, and attributes map
+     * or nullptr if entry value is not an object.
+     */
+    class RdbJsonSaxHandler:
+        public nlohmann::json_sax<nlohmann::json>
+    {
+        public:
+            typedef std::function<void(const std::string&, const swss::TableMap*)> Callback;
+
+            RdbJsonSaxHandler(
+                    _In_ const std::string& table,
+                    _In_ Callback callback);
+
+            virtual ~RdbJsonSaxHandler() = default;
+
+        public: // json_sax interface
+
+            bool null() override;
+            bool boolean(bool val) override;
+            bool number_integer(number_integer_t val) override;
+            bool number_unsigned(number_unsigned_t val) override;
+            bool number_float(number_float_t val, const string_t& s) override;
+            bool string(string_t& val) override;
+            bool binary(binary_t& val) override;
+            bool start_object(std::size_t elements) override;
+            bool key(string_t& val) override;
+            bool end_object() override;
+            bool start_array(std::size_t elements) override;
+            bool end_array() override;
+            bool parse_error(std::size_t position, const std::string& last_token, const nlohmann::detail::exception& ex) override;
+
+        public:
+
+            const std::string& getError() const;
+
+        private:
+
+            enum class Frame
+            {
+                ARRAY,      // array at top level or inside array
+                ENTRIES,    // object which keys are table entries
+                ATTRS,      // attributes of matching table entry
+                SKIP,       // anything else, ignored
+            };
+
+            bool value(
+                    _In_ const std::string* str);
+
+            bool nested(
+                    _In_ bool object);
+
+        private:
+
+            std::string m_table;
+
+            Callback m_callback;
+
+            std::vector<Frame> m_stack;
+
+            bool m_entryMatch;
+
+            std::string m_entryKey;
+
+            std::string m_attrKey;
+
+            swss::TableMap m_attrs;
+
+            std::string m_error;
+    };
+}
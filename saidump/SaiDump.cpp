@@ -7,7 +7,10 @@ extern "C" {
 #include <regex>
 #include <climits>
 #include <getopt.h>
+#include <sys/stat.h>
 #include "sairediscommon.h"
+#include "RdbJsonSaxHandler.h"
+#include "VirtualObjectIdManager.h"
 
 using namespace swss;
 using json = nlohmann::json;
@@ -181,185 +184,185 @@ void SaiDump::printAttributes(size_t indent, const TableMap& map)
 #define GV_ROOT_COLOR   "0.650 0.200 1.000"
 #define GV_NODE_COLOR   "0.650 0.500 1.000"
 
-void SaiDump::dumpGraphFun(const TableDump& td)
+const sai_object_type_info_t* SaiDump::getOidTypeInfo(sai_object_id_t oid)
 {
     SWSS_LOG_ENTER();
 
-    std::map<sai_object_id_t, const sai_object_type_info_t*> oidtypemap;
-    std::map<sai_object_type_t,const sai_object_type_info_t*> typemap;
-
-    std::cout << "digraph \"SAI Object Dependency Graph\" {" << std::endl;
-    std::cout << "size = \"30,12\"; ratio = fill;" << std::endl;
-    std::cout << "node [ style = filled ];" << std::endl;
+    // object type is encoded in VID, so no need to keep map of all objects
 
-    // build object type map first
+    auto ot = sairedis::VirtualObjectIdManager::objectTypeQuery(oid);
 
-    std::set<sai_object_type_t> definedtypes;
+    auto info = sai_metadata_get_object_type_info(ot);
 
-    std::map<sai_object_type_t, int> usagemap;
-
-    for (const auto& key: td)
+    if (ot == SAI_OBJECT_TYPE_NULL || info == NULL)
     {
-        sai_object_meta_key_t meta_key;
-        sai_deserialize_object_meta_key(key.first, meta_key);
+        SWSS_LOG_THROW("failed to get object type of oid %s", sai_serialize_object_id(oid).c_str());
+    }
 
-        auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+    return info;
+}
 
-        typemap[info->objecttype] = info;
+void SaiDump::dumpGraphBegin()
+{
+    SWSS_LOG_ENTER();
 
-        if (!info->isnonobjectid)
-            oidtypemap[meta_key.objectkey.key.object_id] = info;
+    mGraphTypeMap.clear();
+    mGraphLinks.clear();
+    mGraphRef.clear();
+    mGraphAttrRef.clear();
 
-        if (definedtypes.find(meta_key.objecttype) != definedtypes.end())
-            continue;
+    std::cout << "digraph \"SAI Object Dependency Graph\" {" << std::endl;
+    std::cout << "size = \"30,12\"; ratio = fill;" << std::endl;
+    std::cout << "node [ style = filled ];" << std::endl;
+}
 
-        definedtypes.insert(meta_key.objecttype);
-    }
+#define SAI_OBJECT_TYPE_PREFIX_LEN (sizeof("SAI_OBJECT_TYPE_") - 1)
 
-    std::set<std::string> definedlinks;
+void SaiDump::dumpGraphObject(const std::string& key, const TableMap& map)
+{
+    SWSS_LOG_ENTER();
 
-    std::set<sai_object_type_t> ref;
-    std::set<sai_object_type_t> attrref;
+    sai_object_meta_key_t meta_key;
+    sai_deserialize_object_meta_key(key, meta_key);
 
-#define SAI_OBJECT_TYPE_PREFIX_LEN (sizeof("SAI_OBJECT_TYPE_") - 1)
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
 
-    for (const auto& key: td)
-    {
-        sai_object_meta_key_t meta_key;
-        sai_deserialize_object_meta_key(key.first, meta_key);
+    mGraphTypeMap[info->objecttype] = info;
 
-        auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+    // process non object id objects if any
+    for (size_t j = 0; j < info->structmemberscount; ++j)
+    {
+        const sai_struct_member_info_t *m = info->structmembers[j];
 
-        // process non object id objects if any
-        for (size_t j = 0; j < info->structmemberscount; ++j)
+        if (m->membervaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
         {
-            const sai_struct_member_info_t *m = info->structmembers[j];
+            sai_object_id_t member_oid = m->getoid(&meta_key);
+
+            auto member_info = getOidTypeInfo(member_oid);
 
-            if (m->membervaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+            if (member_info->objecttype == SAI_OBJECT_TYPE_SWITCH)
             {
-                sai_object_id_t member_oid = m->getoid(&meta_key);
+                // skip link of SWITCH to non object id object types, since
+                // all of them contain switch_id
+                continue;
+            }
 
-                auto member_info = oidtypemap.at(member_oid);
+            std::stringstream ss;
 
-                if (member_info->objecttype == SAI_OBJECT_TYPE_SWITCH)
-                {
-                    // skip link of SWITCH to non object id object types, since
-                    // all of them contain switch_id
-                    continue;
-                }
+            ss << std::string(member_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
+            << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
+            << "[ color=\"" << GV_ARROW_COLOR << "\", style = dashed, penwidth = 2 ]";
 
-                std::stringstream ss;
+            std::string link = ss.str();
 
-                ss << std::string(member_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
-                << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
-                << "[ color=\"" << GV_ARROW_COLOR << "\", style = dashed, penwidth = 2 ]";
+            if (mGraphLinks.find(link) != mGraphLinks.end())
+                continue;
 
-                std::string link = ss.str();
+            mGraphLinks.insert(link);
 
-                if (definedlinks.find(link) != definedlinks.end())
-                    continue;
+            std::cout << link << std::endl;
+        }
+    }
 
-                definedlinks.insert(link);
+    // process attributes for this object
 
-                std::cout << link << std::endl;
-            }
+    for (const auto&field: map)
+    {
+        const sai_attr_metadata_t *meta;
+        sai_deserialize_attr_id(field.first, &meta);
+
+        if (!meta->isoidattribute || meta->isreadonly)
+        {
+            // skip non oid attributes and read only attributes
+            continue;
         }
 
-        // process attributes for this object
+        sai_attribute_t attr;
+
+        sai_deserialize_attr_value(field.second, *meta, attr, false);
+
+        sai_object_list_t list = { 0, NULL };
 
-        for (const auto&field: key.second)
+        switch (meta->attrvaluetype)
         {
-            const sai_attr_metadata_t *meta;
-            sai_deserialize_attr_id(field.first, &meta);
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                list.count = 1;
+                list.list = &attr.value.oid;
+                break;
 
-            if (!meta->isoidattribute || meta->isreadonly)
-            {
-                // skip non oid attributes and read only attributes
-                continue;
-            }
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+                if (attr.value.aclfield.enable)
+                {
+                    list.count = 1;
+                    list.list = &attr.value.aclfield.data.oid;
+                }
+                break;
 
-            sai_attribute_t attr;
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+                if (attr.value.aclaction.enable)
+                {
+                    list.count = 1;
+                    list.list = &attr.value.aclaction.parameter.oid;
+                }
+                break;
 
-            sai_deserialize_attr_value(field.second, *meta, attr, false);
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                list = attr.value.objlist;
+                break;
 
-            sai_object_list_t list = { 0, NULL };
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                if (attr.value.aclfield.enable)
+                    list = attr.value.aclfield.data.objlist;
+                break;
 
-            switch (meta->attrvaluetype)
-            {
-                case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                    list.count = 1;
-                    list.list = &attr.value.oid;
-                    break;
-
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
-                    if (attr.value.aclfield.enable)
-                    {
-                        list.count = 1;
-                        list.list = &attr.value.aclfield.data.oid;
-                    }
-                    break;
-
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
-                    if (attr.value.aclaction.enable)
-                    {
-                        list.count = 1;
-                        list.list = &attr.value.aclaction.parameter.oid;
-                    }
-                    break;
-
-                case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                    list = attr.value.objlist;
-                    break;
-
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
-                    if (attr.value.aclfield.enable)
-                        list = attr.value.aclfield.data.objlist;
-                    break;
-
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
-                    if (attr.value.aclaction.enable)
-                        list = attr.value.aclaction.parameter.objlist;
-                    break;
-
-                default:
-                    SWSS_LOG_THROW("attr value type: %d is not supported, FIXME", meta->attrvaluetype);
-            }
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+                if (attr.value.aclaction.enable)
+                    list = attr.value.aclaction.parameter.objlist;
+                break;
 
-            for (uint32_t i = 0; i < list.count; ++i)
-            {
-                sai_object_id_t oid = list.list[i];
+            default:
+                SWSS_LOG_THROW("attr value type: %d is not supported, FIXME", meta->attrvaluetype);
+        }
 
-                if (oid == SAI_NULL_OBJECT_ID)
-                    continue;
+        for (uint32_t i = 0; i < list.count; ++i)
+        {
+            sai_object_id_t oid = list.list[i];
 
-                // this object type is not root, can be in the middle or leaf
-                ref.insert(info->objecttype);
+            if (oid == SAI_NULL_OBJECT_ID)
+                continue;
 
-                auto attr_oid_info = oidtypemap.at(oid);
+            // this object type is not root, can be in the middle or leaf
+            mGraphRef.insert(info->objecttype);
 
-                std::stringstream ss;
+            auto attr_oid_info = getOidTypeInfo(oid);
 
-                attrref.insert(attr_oid_info->objecttype);
+            std::stringstream ss;
 
-                ss << std::string(attr_oid_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
-                << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
-                << "[ color = \"" << GV_ARROW_COLOR << "\" ]";
+            mGraphAttrRef.insert(attr_oid_info->objecttype);
 
-                std::string link = ss.str();
+            ss << std::string(attr_oid_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
+            << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
+            << "[ color = \"" << GV_ARROW_COLOR << "\" ]";
 
-                if (definedlinks.find(link) != definedlinks.end())
-                    continue;
+            std::string link = ss.str();
 
-                definedlinks.insert(link);
+            if (mGraphLinks.find(link) != mGraphLinks.end())
+                continue;
 
-                std::cout << link << std::endl;
-            }
+            mGraphLinks.insert(link);
 
-            sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+            std::cout << link << std::endl;
         }
+
+        sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
     }
+}
+
+void SaiDump::dumpGraphEnd()
+{
+    SWSS_LOG_ENTER();
 
-    for (auto t: typemap)
+    for (auto t: mGraphTypeMap)
     {
         auto ot = t.first;
         auto info = t.second;
@@ -374,7 +377,7 @@ void SaiDump::dumpGraphFun(const TableDump& td)
             continue;
         }
 
-        if (ref.find(ot) != ref.end() && attrref.find(ot) != attrref.end())
+        if (mGraphRef.find(ot) != mGraphRef.end() && mGraphAttrRef.find(ot) != mGraphAttrRef.end())
         {
             /* middle nodes */
 
@@ -382,7 +385,7 @@ void SaiDump::dumpGraphFun(const TableDump& td)
             continue;
         }
 
-        if (ref.find(ot) != ref.end() && attrref.find(ot) == attrref.end())
+        if (mGraphRef.find(ot) != mGraphRef.end() && mGraphAttrRef.find(ot) == mGraphAttrRef.end())
         {
             /* leafs */
 
@@ -390,7 +393,7 @@ void SaiDump::dumpGraphFun(const TableDump& td)
             continue;
         }
 
-        if (ref.find(ot) == ref.end() && attrref.find(ot) != attrref.end())
+        if (mGraphRef.find(ot) == mGraphRef.end() && mGraphAttrRef.find(ot) != mGraphAttrRef.end())
         {
             /* roots */
 
@@ -409,78 +412,60 @@ void SaiDump::dumpGraphFun(const TableDump& td)
     std::cout << "}" << std::endl;
 }
 
-#define SWSS_LOG_ERROR_AND_STDERR(format, ...) { fprintf(stderr, format"\n", ##__VA_ARGS__); SWSS_LOG_ERROR(format, ##__VA_ARGS__); }
-
-void SaiDump::traverseJson(const json & jsn)
+void SaiDump::dumpGraphFun(const TableDump& td)
 {
     SWSS_LOG_ENTER();
-    if (jsn.is_object())
+
+    dumpGraphBegin();
+
+    for (const auto& key: td)
     {
-        for (auto it = jsn.begin(); it != jsn.end(); ++it)
-        {
-            std::string keystr = it.key();
-            std::string item_name = keystr;
-            size_t pos = keystr.find_first_of(":");
+        dumpGraphObject(key.first, key.second);
+    }
 
-            if (pos != std::string::npos)
-            {
-                if(ASIC_STATE_TABLE != keystr.substr(0, pos))  // filter out non "ASIC_STATE" items
-                {
-                    continue;
-                }
+    dumpGraphEnd();
+}
 
-                item_name = keystr.substr(pos + 1);
+#define SWSS_LOG_ERROR_AND_STDERR(format, ...) { fprintf(stderr, format"\n", ##__VA_ARGS__); SWSS_LOG_ERROR(format, ##__VA_ARGS__); }
 
-                if (item_name.find(":") != std::string::npos)
-                {
-                    item_name.replace(item_name.find_first_of(":"), 1, " ");
-                }
-            }
-            else
-            {
-                continue;
-            }
+void SaiDump::dumpRdbJsonObject(const std::string& key, const TableMap* map)
+{
+    SWSS_LOG_ENTER();
 
-            std::cout << item_name << " " << std::endl;
-            json jsn_sub = it.value();
+    if (dumpGraph)
+    {
+        if (map)
+        {
+            dumpGraphObject(key, *map);
+        }
 
-            if (!it->is_object())
-            {
-                continue;
-            }
+        return;
+    }
 
-            TableMap map;
+    std::string item_name = key;
 
-            for (auto it_sub = jsn_sub.begin(); it_sub != jsn_sub.end(); ++it_sub)
-            {
-                if (it_sub.key() != "NULL")
-                {
-                    map[it_sub.key()] = it_sub.value();
-                }
-            }
+    if (item_name.find(":") != std::string::npos)
+    {
+        item_name.replace(item_name.find_first_of(":"), 1, " ");
+    }
 
-            constexpr size_t LINE_IDENT = 4;
-            size_t max_len = getMaxAttrLen(map);
-            std::string str_indent = padString("", LINE_IDENT);
+    std::cout << item_name << " " << std::endl;
 
-            for (const auto&field: map)
-            {
-                std::cout << str_indent << padString(field.first, max_len) << " : ";
-                std::cout << field.second << std::endl;
-            }
-            std::cout << std::endl;
-        }
+    if (map == nullptr)
+    {
+        return;
     }
-    else if(jsn.is_array())
+
+    constexpr size_t LINE_IDENT = 4;
+    size_t max_len = getMaxAttrLen(*map);
+    std::string str_indent = padString("", LINE_IDENT);
+
+    for (const auto&field: *map)
     {
-        for (const auto& element : jsn)
-        {
-            if (element.is_object() || element.is_array())
-            {
-                traverseJson(element);
-            }
-        }
+        std::cout << str_indent << padString(field.first, max_len) << " : ";
+        std::cout << field.second << std::endl;
     }
+    std::cout << std::endl;
 }
 
 sai_status_t SaiDump::dumpFromRedisRdbJson()
@@ -495,13 +480,42 @@ sai_status_t SaiDump::dumpFromRedisRdbJson()
         return SAI_STATUS_FAILURE;
     }
 
+    struct stat st;
+
+    if (stat(rdbJsonFile.c_str(), &st) == 0 && (uint64_t)st.st_size > rdbJSonSizeLimit)
+    {
+        SWSS_LOG_ERROR_AND_STDERR("The file %s size %" PRIu64 " exceeds RDB JSON max size %" PRIu64 " MB, use -m to increase it.",
+                rdbJsonFile.c_str(),
+                (uint64_t)st.st_size,
+                rdbJSonSizeLimit / 1024 / 1024);
+        return SAI_STATUS_FAILURE;
+    }
+
+    // Parse the file as a stream and dump each ASIC_STATE entry as soon as
+    // it is read, so memory usage does not depend on the RDB JSON file size.
+
+    RdbJsonSaxHandler handler(ASIC_STATE_TABLE, [this](const std::string& key, const TableMap* map) {
+            dumpRdbJsonObject(key, map);
+    });
+
     try
     {
-        // Parse the JSON data from the file (validation)
-        json jsonData;
-        input_file >> jsonData;
-        traverseJson(jsonData);
-        return SAI_STATUS_SUCCESS;
+        if (dumpGraph)
+        {
+            dumpGraphBegin();
+        }
+
+        if (json::sax_parse(input_file, &handler))
+        {
+            if (dumpGraph)
+            {
+                dumpGraphEnd();
+            }
+
+            return SAI_STATUS_SUCCESS;
+        }
+
+        SWSS_LOG_ERROR_AND_STDERR("JSON parsing error: %s.", handler.getError().c_str());
     }
     catch (std::exception &ex)
     {
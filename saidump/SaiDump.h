@@ -2,6 +2,7 @@
 #include "swss/table.h"
 #include "meta/sai_serialize.h"
 #include <nlohmann/json.hpp>
+#include <set>
 
 namespace syncd
 {
@@ -14,8 +15,11 @@ namespace syncd
             void dumpFromRedisDb(int argc, char **argv);
             void printUsage();
             sai_status_t dumpFromRedisRdbJson();
-            void traverseJson(const nlohmann::json & jsn);
+            void dumpRdbJsonObject(const std::string& key, const swss::TableMap* map);
             void dumpGraphFun(const swss::TableDump& td);
+            void dumpGraphBegin();
+            void dumpGraphObject(const std::string& key, const swss::TableMap& map);
+            void dumpGraphEnd();
             void printAttributes(size_t indent, const swss::TableMap& map);
             void dumpGraphTable(const swss::TableDump &dump);
             std::string getRdbJsonFile();
@@ -29,8 +33,15 @@ namespace syncd
             bool dumpGraph;
         private:
             std::map<sai_object_id_t, const swss::TableMap*> mOidMap;
+        private:
+            // graph state, bounded by number of object types, not objects
+            std::map<sai_object_type_t, const sai_object_type_info_t*> mGraphTypeMap;
+            std::set<std::string> mGraphLinks;
+            std::set<sai_object_type_t> mGraphRef;
+            std::set<sai_object_type_t> mGraphAttrRef;
         private:
             size_t getMaxAttrLen(const swss::TableMap& map);
             std::string padString(std::string s, size_t pad);
+            const sai_object_type_info_t* getOidTypeInfo(sai_object_id_t oid);
     };
 }
@@ -58,6 +58,8 @@ void AsicView::fromDump(
 
     int switchesCount = 0;
 
+    m_vidReference.reserve(m_vidReference.size() + dump.size());
+
     for (const auto &key: dump)
     {
         auto start = key.first.find_first_of(":");
@@ -88,33 +90,33 @@ void AsicView::fromDump(
         {
             case SAI_OBJECT_TYPE_FDB_ENTRY:
                 sai_deserialize_fdb_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.fdb_entry);
-                m_soFdbs[o->m_str_object_id] = o;
+                m_soFdbs[o->m_meta_key] = o;
                 break;
 
             case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
                 sai_deserialize_neighbor_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.neighbor_entry);
-                m_soNeighbors[o->m_str_object_id] = o;
+                m_soNeighbors[o->m_meta_key] = o;
 
-                m_neighborsByIp[sai_serialize_ip_address(o->m_meta_key.objectkey.key.neighbor_entry.ip_address)].push_back(o->m_str_object_id);
+                m_neighborsByIp[o->m_meta_key.objectkey.key.neighbor_entry.ip_address].push_back(o);
 
                 break;
 
             case SAI_OBJECT_TYPE_ROUTE_ENTRY:
                 sai_deserialize_route_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.route_entry);
-                m_soRoutes[o->m_str_object_id] = o;
+                m_soRoutes[o->m_meta_key] = o;
 
-                m_routesByPrefix[sai_serialize_ip_prefix(o->m_meta_key.objectkey.key.route_entry.destination)].push_back(o->m_str_object_id);
+                m_routesByPrefix[o->m_meta_key.objectkey.key.route_entry.destination].push_back(o);
 
                 break;
 
             case SAI_OBJECT_TYPE_NAT_ENTRY:
                 sai_deserialize_nat_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.nat_entry);
-                m_soNatEntries[o->m_str_object_id] = o;
+                m_soNatEntries[o->m_meta_key] = o;
                 break;
 
             case SAI_OBJECT_TYPE_INSEG_ENTRY:
                 sai_deserialize_inseg_entry(o->m_str_object_id, o->m_meta_key.objectkey.key.inseg_entry);
-                m_soInsegs[o->m_str_object_id] = o;
+                m_soInsegs[o->m_meta_key] = o;
                 break;
 
             default:
@@ -139,6 +141,7 @@ void AsicView::fromDump(
 
         m_soAll[o->m_str_object_id] = o;
         m_sotAll[o->m_meta_key.objecttype][o->m_str_object_id] = o;
+        signatureIndexInsert(o);
 
         if (o->m_info->isnonobjectid)
         {
@@ -477,6 +480,164 @@ std::vector<std::shared_ptr<SaiObj>> AsicView::getNotProcessedObjectsByObjectTyp
     return list;
 }
 
+std::vector<std::shared_ptr<SaiObj>> AsicView::getNotProcessedObjectsBySignature(
+        _In_ sai_object_type_t object_type,
+        _In_ const std::string &signature,
+        _In_ const SignatureBuilder &builder) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<SaiObj>> list;
+
+    auto it = m_sotAll.find(object_type);
+
+    if (it == m_sotAll.end())
+    {
+        return list;
+    }
+
+    auto iit = m_signatureIndex.find(object_type);
+
+    if (iit == m_signatureIndex.end())
+    {
+        auto &index = m_signatureIndex[object_type];
+
+        index.m_pending = it->second;
+
+        SWSS_LOG_INFO("building signature index for %s: %zu objects",
+                sai_serialize_object_type(object_type).c_str(),
+                it->second.size());
+
+        iit = m_signatureIndex.find(object_type);
+    }
+
+    auto &index = iit->second;
+
+    /*
+     * Builder is not stored in index, since it can reference objects which
+     * don't live as long as this view, so objects added since last call are
+     * indexed here.
+     */
+
+    for (const auto &p: index.m_pending)
+    {
+        const auto &obj = p.second;
+
+        auto sig = builder(obj);
+
+        index.m_objectSignature[obj->m_str_object_id] = sig;
+
+        if (sig.empty())
+        {
+            index.m_unsigned[obj->m_str_object_id] = obj;
+
+            for (auto &bucket: index.m_buckets)
+            {
+                bucket.second[obj->m_str_object_id] = obj;
+            }
+
+            continue;
+        }
+
+        auto bit = index.m_buckets.find(sig);
+
+        if (bit == index.m_buckets.end())
+        {
+            // new bucket contains all objects without signature
+
+            bit = index.m_buckets.emplace(sig, index.m_unsigned).first;
+        }
+
+        bit->second[obj->m_str_object_id] = obj;
+    }
+
+    index.m_pending.clear();
+
+    /*
+     * Bucket is sorted by string object id, so order is the same as full
+     * scan, and when signature is not present only objects without
+     * signature can match.
+     */
+
+    auto bit = index.m_buckets.find(signature);
+
+    const auto &objects = (bit == index.m_buckets.end()) ? index.m_unsigned : bit->second;
+
+    for (const auto &p: objects)
+    {
+        if (p.second->getObjectStatus() == SAI_OBJECT_STATUS_NOT_PROCESSED)
+        {
+            list.push_back(p.second);
+        }
+    }
+
+    return list;
+}
+
+void AsicView::signatureIndexInsert(
+        _In_ const std::shared_ptr<SaiObj> &obj)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_signatureIndex.find(obj->m_meta_key.objecttype);
+
+    if (it == m_signatureIndex.end())
+    {
+        // index for this object type was not yet requested
+
+        return;
+    }
+
+    it->second.m_pending[obj->m_str_object_id] = obj;
+}
+
+void AsicView::signatureIndexRemove(
+        _In_ const std::shared_ptr<SaiObj> &obj)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_signatureIndex.find(obj->m_meta_key.objecttype);
+
+    if (it == m_signatureIndex.end())
+    {
+        return;
+    }
+
+    auto &index = it->second;
+
+    const auto &id = obj->m_str_object_id;
+
+    index.m_pending.erase(id);
+
+    auto sit = index.m_objectSignature.find(id);
+
+    if (sit == index.m_objectSignature.end())
+    {
+        return;
+    }
+
+    if (sit->second.empty())
+    {
+        index.m_unsigned.erase(id);
+
+        for (auto &bucket: index.m_buckets)
+        {
+            bucket.second.erase(id);
+        }
+    }
+    else
+    {
+        auto bit = index.m_buckets.find(sit->second);
+
+        if (bit != index.m_buckets.end())
+        {
+            bit->second.erase(id);
+        }
+    }
+
+    index.m_objectSignature.erase(sit);
+}
+
 /**
  * @brief Gets all not processed objects
  *
@@ -540,6 +701,7 @@ std::shared_ptr<SaiObj> AsicView::createDummyExistingObject(
 
     m_soAll[o->m_str_object_id] = o;
     m_sotAll[o->m_meta_key.objecttype][o->m_str_object_id] = o;
+    signatureIndexInsert(o);
 
     m_ridToVid[rid] = vid;
     m_vidToRid[vid] = rid;
@@ -666,6 +828,7 @@ void AsicView::asicCreateObject(
 
         m_soAll[currentObj->m_str_object_id] = currentObj;
         m_sotAll[currentObj->m_meta_key.objecttype][currentObj->m_str_object_id] = currentObj;
+        signatureIndexInsert(currentObj);
 
         /*
          * Since we are creating object, we just need to mark that
@@ -689,25 +852,25 @@ void AsicView::asicCreateObject(
         {
             case SAI_OBJECT_TYPE_FDB_ENTRY:
                 //sai_deserialize_fdb_entry(currentObj->m_str_object_id, currentObj->m_meta_key.objectkey.key.fdb_entry);
-                m_soFdbs[currentObj->m_str_object_id] = currentObj;
+                m_soFdbs[currentObj->m_meta_key] = currentObj;
                 break;
 
             case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
                 //sai_deserialize_neighbor_entry(currentObj->m_str_object_id, currentObj->m_meta_key.objectkey.key.neighbor_entry);
-                m_soNeighbors[currentObj->m_str_object_id] = currentObj;
+                m_soNeighbors[currentObj->m_meta_key] = currentObj;
                 break;
 
             case SAI_OBJECT_TYPE_ROUTE_ENTRY:
                 //sai_deserialize_route_entry(currentObj->m_str_object_id, currentObj->m_meta_key.objectkey.key.route_entry);
-                m_soRoutes[currentObj->m_str_object_id] = currentObj;
+                m_soRoutes[currentObj->m_meta_key] = currentObj;
                 break;
 
             case SAI_OBJECT_TYPE_NAT_ENTRY:
-                m_soNatEntries[currentObj->m_str_object_id] = currentObj;
+                m_soNatEntries[currentObj->m_meta_key] = currentObj;
                 break;
 
             case SAI_OBJECT_TYPE_INSEG_ENTRY:
-                m_soInsegs[currentObj->m_str_object_id] = currentObj;
+                m_soInsegs[currentObj->m_meta_key] = currentObj;
                 break;
 
             default:
@@ -718,6 +881,7 @@ void AsicView::asicCreateObject(
 
         m_soAll[currentObj->m_str_object_id] = currentObj;
         m_sotAll[currentObj->m_meta_key.objecttype][currentObj->m_str_object_id] = currentObj;
+        signatureIndexInsert(currentObj);
 
         updateNonObjectIdVidReferenceCountByValue(currentObj, 1);
     }
@@ -803,6 +967,7 @@ void AsicView::asicRemoveObject(
 
         m_soAll.erase(currentObj->m_str_object_id);
         m_sotAll.at(currentObj->m_meta_key.objecttype).erase(currentObj->m_str_object_id);
+        signatureIndexRemove(currentObj);
 
         m_vidReference[currentObj->m_meta_key.objectkey.key.object_id] -= 1;
 
@@ -839,23 +1004,23 @@ void AsicView::asicRemoveObject(
         switch (currentObj->getObjectType())
         {
             case SAI_OBJECT_TYPE_FDB_ENTRY:
-                m_soFdbs.erase(currentObj->m_str_object_id);
+                m_soFdbs.erase(currentObj->m_meta_key);
                 break;
 
             case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
-                m_soNeighbors.erase(currentObj->m_str_object_id);
+                m_soNeighbors.erase(currentObj->m_meta_key);
                 break;
 
             case SAI_OBJECT_TYPE_ROUTE_ENTRY:
-                m_soRoutes.erase(currentObj->m_str_object_id);
+                m_soRoutes.erase(currentObj->m_meta_key);
                 break;
 
             case SAI_OBJECT_TYPE_NAT_ENTRY:
-                m_soNatEntries.erase(currentObj->m_str_object_id);
+                m_soNatEntries.erase(currentObj->m_meta_key);
                 break;
 
             case SAI_OBJECT_TYPE_INSEG_ENTRY:
-                m_soInsegs.erase(currentObj->m_str_object_id);
+                m_soInsegs.erase(currentObj->m_meta_key);
                 break;
 
             default:
@@ -866,6 +1031,7 @@ void AsicView::asicRemoveObject(
 
         m_soAll.erase(currentObj->m_str_object_id);
         m_sotAll.at(currentObj->m_meta_key.objecttype).erase(currentObj->m_str_object_id);
+        signatureIndexRemove(currentObj);
 
         updateNonObjectIdVidReferenceCountByValue(currentObj, -1);
     }
@@ -1131,7 +1297,11 @@ void AsicView::dumpRef(const std::string & asicName)
 
     SWSS_LOG_NOTICE("dump references in ASIC VIEW: %s", asicName.c_str());
 
-    for (auto& kvp: m_vidReference)
+    // sorted copy, so dumps are comparable
+
+    std::map<sai_object_id_t, int> vidReference(m_vidReference.begin(), m_vidReference.end());
+
+    for (auto& kvp: vidReference)
     {
         sai_object_id_t oid = kvp.first;
 
@@ -1163,7 +1333,9 @@ void AsicView::dumpVidToAsicOperatioId() const
 {
     SWSS_LOG_ENTER();
 
-    for (auto& a: m_vidToAsicOperationId)
+    std::map<sai_object_id_t, int> vidToAsicOperationId(m_vidToAsicOperationId.begin(), m_vidToAsicOperationId.end());
+
+    for (auto& a: vidToAsicOperationId)
     {
         auto ot = VidManager::objectTypeQuery(a.first);
 
@@ -1265,16 +1437,18 @@ void AsicView::updateNonObjectIdVidReferenceCountByValue(
         {
             sai_object_id_t vid = m->getoid(&currentObj->m_meta_key);
 
-            m_vidReference[vid] += value;
+            int& referenceCount = m_vidReference[vid];
+
+            referenceCount += value;
 
             if (m_enableRefernceCountLogs)
             {
                 SWSS_LOG_WARN("updated vid %s reference to %d",
                         sai_serialize_object_id(vid).c_str(),
-                        m_vidReference[vid]);
+                        referenceCount);
             }
 
-            if (m_vidReference[vid] == 0)
+            if (referenceCount == 0)
             {
                 m_vidToAsicOperationId[vid] = m_asicOperationId;
             }
@@ -8,8 +8,13 @@ extern "C" {
 #include "SaiAttr.h"
 #include "AsicOperation.h"
 
+#include "meta/MetaKeyHasher.h"
+
 #include "swss/table.h"
 
+#include <functional>
+#include <unordered_map>
+
 namespace syncd
 {
     /**
@@ -22,6 +27,33 @@ namespace syncd
             typedef std::unordered_map<sai_object_id_t, sai_object_id_t> ObjectIdMap;
             typedef std::map<std::string, std::shared_ptr<SaiObj>> StrObjectIdToSaiObjectHash;
             typedef std::map<sai_object_id_t, std::shared_ptr<SaiObj>> ObjectIdToSaiObjectHash;
+            typedef std::unordered_map<sai_object_meta_key_t, std::shared_ptr<SaiObj>, saimeta::MetaKeyHasher, saimeta::MetaKeyHasher> MetaKeyToSaiObjectHash;
+            typedef std::unordered_map<sai_ip_prefix_t, std::vector<std::shared_ptr<SaiObj>>, saimeta::IpPrefixHasher, saimeta::IpPrefixHasher> IpPrefixToSaiObjectsHash;
+            typedef std::unordered_map<sai_ip_address_t, std::vector<std::shared_ptr<SaiObj>>, saimeta::IpAddressHasher, saimeta::IpAddressHasher> IpAddressToSaiObjectsHash;
+            typedef std::function<std::string(const std::shared_ptr<const SaiObj>&)> SignatureBuilder;
+
+            /**
+             * @brief Signature index of single object type.
+             *
+             * Buckets are sorted by string object id, same as m_sotAll.
+             * Objects without signature are present in every bucket.
+             */
+            struct SignatureIndex
+            {
+                std::unordered_map<std::string, StrObjectIdToSaiObjectHash> m_buckets;
+
+                StrObjectIdToSaiObjectHash m_unsigned;
+
+                /**
+                 * @brief Signature of each indexed object, used on remove.
+                 */
+                std::unordered_map<std::string, std::string> m_objectSignature;
+
+                /**
+                 * @brief Objects added since last lookup, not yet indexed.
+                 */
+                StrObjectIdToSaiObjectHash m_pending;
+            };
 
         private:
 
@@ -171,6 +203,28 @@ namespace syncd
             std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsByObjectType(
                     _In_ sai_object_type_t object_type) const;
 
+            /**
+             * @brief Gets not processed objects by object type and signature.
+             *
+             * Objects of given type are indexed by signature created by
+             * signature builder on first call. Index is updated when object
+             * of that type is added or removed, added objects are indexed on
+             * next call. Objects for which builder returned empty signature
+             * are returned for every signature.
+             *
+             * @param object_type Object type to be used as filter.
+             * @param signature Signature to be used as filter, not empty.
+             * @param builder Signature builder used to create index.
+             *
+             * @return List of objects with requested object type, signature
+             * (or without signature) and marked as not processed. Order on
+             * list is the same as in getNotProcessedObjectsByObjectType.
+             */
+            std::vector<std::shared_ptr<SaiObj>> getNotProcessedObjectsBySignature(
+                    _In_ sai_object_type_t object_type,
+                    _In_ const std::string &signature,
+                    _In_ const SignatureBuilder &builder) const;
+
             /**
              * @brief Gets all not processed objects
              *
@@ -268,20 +322,36 @@ namespace syncd
                     _In_ const std::shared_ptr<SaiObj> &currentObj,
                     _In_ int value);
 
+        private:
+
+            void signatureIndexInsert(
+                    _In_ const std::shared_ptr<SaiObj> &obj);
+
+            void signatureIndexRemove(
+                    _In_ const std::shared_ptr<SaiObj> &obj);
+
         public:
 
             // TODO convert to something like nonObjectIdMap
 
-            StrObjectIdToSaiObjectHash m_soFdbs;
-            StrObjectIdToSaiObjectHash m_soNeighbors;
-            StrObjectIdToSaiObjectHash m_soRoutes;
-            StrObjectIdToSaiObjectHash m_soNatEntries;
-            StrObjectIdToSaiObjectHash m_soInsegs;
+            /*
+             * Non object id maps are only used for lookups, never iterated,
+             * so they are hashed by native entry struct and lookup doesn't
+             * need to serialize entry. Object id maps (m_soOids, m_soAll,
+             * m_sotAll) stay keyed by serialized id, since their order
+             * decides order of generated ASIC operations.
+             */
+
+            MetaKeyToSaiObjectHash m_soFdbs;
+            MetaKeyToSaiObjectHash m_soNeighbors;
+            MetaKeyToSaiObjectHash m_soRoutes;
+            MetaKeyToSaiObjectHash m_soNatEntries;
+            MetaKeyToSaiObjectHash m_soInsegs;
             StrObjectIdToSaiObjectHash m_soOids;
             StrObjectIdToSaiObjectHash m_soAll;
 
-            std::unordered_map<std::string,std::vector<std::string>> m_routesByPrefix;
-            std::unordered_map<std::string,std::vector<std::string>> m_neighborsByIp;
+            IpPrefixToSaiObjectsHash m_routesByPrefix;
+            IpAddressToSaiObjectsHash m_neighborsByIp;
 
             ObjectIdToSaiObjectHash m_oOids;
 
@@ -309,7 +379,7 @@ namespace syncd
              *
              * VID is key, reference count is value.
              */
-            std::map<sai_object_id_t, int> m_vidReference;
+            std::unordered_map<sai_object_id_t, int> m_vidReference;
 
             /**
              * @brief Asic operation ID.
@@ -339,7 +409,7 @@ namespace syncd
              * with that VID will be removed, we can move remove operation right
              * after asic operation id pointed by this VID.
              */
-            std::map<sai_object_id_t, int> m_vidToAsicOperationId;
+            std::unordered_map<sai_object_id_t, int> m_vidToAsicOperationId;
 
             /**
              * @brief ASIC operation list.
@@ -354,5 +424,10 @@ namespace syncd
             std::vector<AsicOperation> m_asicRemoveOperationsNonObjectId;
 
             std::map<sai_object_type_t, StrObjectIdToSaiObjectHash> m_sotAll;
+
+            /**
+             * @brief Signature index per object type, populated on demand.
+             */
+            mutable std::map<sai_object_type_t, SignatureIndex> m_signatureIndex;
     };
 }
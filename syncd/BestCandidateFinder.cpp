@@ -8,9 +8,16 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <cstdlib>
 
 using namespace syncd;
 
+/*
+ * Views for different switches can be compared concurrently, so each
+ * thread keeps its own random state.
+ */
+static thread_local unsigned int g_randomSeed = 1;
+
 BestCandidateFinder::BestCandidateFinder(
         _In_ const AsicView& currentView,
         _In_ const AsicView& temporaryView,
@@ -1691,15 +1698,16 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
 
     sai_object_type_t object_type = temporaryObj->getObjectType();
 
-    const auto notProcessedObjects = m_currentView.getNotProcessedObjectsByObjectType(object_type);
+    const auto notProcessedObjects = getNotProcessedCandidates(temporaryObj);
 
     const auto attrs = temporaryObj->getAllAttributes();
 
     /*
      * Complexity here is O((n^2)*m) since we iterate via all not processed
      * objects, then we iterate through all present attributes.  N is squared
-     * since for given object type we iterate via entire list for each object,
-     * this can be optimized a little bit inside AsicView class.
+     * since for given object type we iterate via entire list for each object.
+     * Not processed objects are already narrowed down to objects with the
+     * same create only signature, so in most cases n is small.
      */
 
     SWSS_LOG_INFO("not processed objects for %s: %zu, attrs: %zu",
@@ -2030,11 +2038,19 @@ std::shared_ptr<SaiObj> BestCandidateFinder::selectRandomCandidate(
 
     SWSS_LOG_INFO("selecting random candidate from %zu objects", candidateCount);
 
-    size_t index = std::rand() % candidateCount;
+    size_t index = rand_r(&g_randomSeed) % candidateCount;
 
     return candidateObjects.at(index).obj;
 }
 
+void BestCandidateFinder::setRandomSeed(
+        _In_ unsigned int seed)
+{
+    SWSS_LOG_ENTER();
+
+    g_randomSeed = seed;
+}
+
 /**
  * @brief Find current best match for neighbor.
  *
@@ -2043,7 +2059,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::selectRandomCandidate(
  * processed we just need to check whether VID in neighbor_entry struct is
  * matched/final and it has RID assigned from current view. If, RID exists, we
  * can use that RID to get VID of current view, exchange in neighbor_entry
- * struct and do dictionary lookup on serialized neighbor_entry.
+ * struct and do dictionary lookup on neighbor_entry.
  *
  * With this approach for many entries this is the quickest possible way. In
  * case when RID doesn't exist, that means we have invalid neighbor entry, so we
@@ -2077,19 +2093,18 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForNeighborEntr
         return nullptr;
     }
 
-    std::string str_neighbor_entry = sai_serialize_neighbor_entry(mk.objectkey.key.neighbor_entry);
-
     /*
-     * Now when we have serialized neighbor entry with temporary rif_if VID
-     * replaced to current rif_id VID we can do dictionary lookup for neighbor.
+     * Now when we have neighbor entry with temporary rif_if VID replaced to
+     * current rif_id VID we can do dictionary lookup for neighbor, entry is
+     * serialized only for logging.
      */
 
-    auto currentNeighborIt = m_currentView.m_soNeighbors.find(str_neighbor_entry);
+    auto currentNeighborIt = m_currentView.m_soNeighbors.find(mk);
 
     if (currentNeighborIt == m_currentView.m_soNeighbors.end())
     {
         SWSS_LOG_DEBUG("unable to find neighbor entry %s in current asic view",
-                str_neighbor_entry.c_str());
+                sai_serialize_neighbor_entry(mk.objectkey.key.neighbor_entry).c_str());
 
         return nullptr;
     }
@@ -2112,7 +2127,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForNeighborEntr
      */
 
     SWSS_LOG_THROW("found neighbor entry %s in current view, but it status is %d, FATAL",
-            str_neighbor_entry.c_str(),
+            sai_serialize_neighbor_entry(mk.objectkey.key.neighbor_entry).c_str(),
             currentNeighborObj->getObjectStatus());
 }
 
@@ -2124,7 +2139,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForNeighborEntr
  * processed we just need to check whether VID in route_entry struct is
  * matched/final and it has RID assigned from current view. If, RID exists, we
  * can use that RID to get VID of current view, exchange in route_entry struct
- * and do dictionary lookup on serialized route_entry.
+ * and do dictionary lookup on route_entry.
  *
  * With this approach for many entries this is the quickest possible way. In
  * case when RID doesn't exist, that means we have invalid route entry, so we
@@ -2158,17 +2173,16 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForRouteEntry(
         return nullptr;
     }
 
-    std::string str_route_entry = sai_serialize_route_entry(mk.objectkey.key.route_entry);
-
     /*
-     * Now when we have serialized route entry with temporary vr_id VID
-     * replaced to current vr_id VID we can do dictionary lookup for route.
+     * Now when we have route entry with temporary vr_id VID replaced to
+     * current vr_id VID we can do dictionary lookup for route, entry is
+     * serialized only for logging.
      */
-    auto currentRouteIt = m_currentView.m_soRoutes.find(str_route_entry);
+    auto currentRouteIt = m_currentView.m_soRoutes.find(mk);
 
     if (currentRouteIt == m_currentView.m_soRoutes.end())
     {
-        SWSS_LOG_DEBUG("unable to find route entry %s in current asic view", str_route_entry.c_str());
+        SWSS_LOG_DEBUG("unable to find route entry %s in current asic view", sai_serialize_route_entry(mk.objectkey.key.route_entry).c_str());
 
         return nullptr;
     }
@@ -2191,7 +2205,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForRouteEntry(
      */
 
     SWSS_LOG_THROW("found route entry %s in current view, but it status is %d, FATAL",
-            str_route_entry.c_str(),
+            sai_serialize_route_entry(mk.objectkey.key.route_entry).c_str(),
             currentRouteObj->getObjectStatus());
 }
 
@@ -2203,7 +2217,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForRouteEntry(
  * processed we just need to check whether VID in inseg_entry struct is
  * matched/final and it has RID assigned from current view. If, RID exists, we
  * can use that RID to get VID of current view, exchange in inseg_entry struct
- * and do dictionary lookup on serialized inseg_entry.
+ * and do dictionary lookup on inseg_entry.
  *
  * With this approach for many entries this is the quickest possible way. In
  * case when RID doesn't exist, that means we have invalid inseg entry, so we
@@ -2237,17 +2251,16 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForInsegEntry(
         return nullptr;
     }
 
-    std::string str_inseg_entry = sai_serialize_inseg_entry(mk.objectkey.key.inseg_entry);
-
     /*
-     * Now when we have serialized inseg entry with temporary vr_id VID
-     * replaced to current vr_id VID we can do dictionary lookup for inseg.
+     * Now when we have inseg entry with temporary vr_id VID replaced to
+     * current vr_id VID we can do dictionary lookup for inseg, entry is
+     * serialized only for logging.
      */
-    auto currentInsegIt = m_currentView.m_soInsegs.find(str_inseg_entry);
+    auto currentInsegIt = m_currentView.m_soInsegs.find(mk);
 
     if (currentInsegIt == m_currentView.m_soInsegs.end())
     {
-        SWSS_LOG_DEBUG("unable to find inseg entry %s in current asic view", str_inseg_entry.c_str());
+        SWSS_LOG_DEBUG("unable to find inseg entry %s in current asic view", sai_serialize_inseg_entry(mk.objectkey.key.inseg_entry).c_str());
 
         return nullptr;
     }
@@ -2270,7 +2283,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForInsegEntry(
      */
 
     SWSS_LOG_THROW("found inseg entry %s in current view, but it status is %d, FATAL",
-            str_inseg_entry.c_str(),
+            sai_serialize_inseg_entry(mk.objectkey.key.inseg_entry).c_str(),
             currentInsegObj->getObjectStatus());
 }
 
@@ -2282,7 +2295,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForInsegEntry(
  * we just need to check whether VID in fdb_entry struct is matched/final and
  * it has RID assigned from current view. If, RID exists, we can use that RID
  * to get VID of current view, exchange in fdb_entry struct and do dictionary
- * lookup on serialized fdb_entry.
+ * lookup on fdb_entry.
  *
  * With this approach for many entries this is the quickest possible way. In
  * case when RID doesn't exist, that means we have invalid fdb entry, so we must
@@ -2316,18 +2329,17 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForFdbEntry(
         return nullptr;
     }
 
-    std::string str_fdb_entry = sai_serialize_fdb_entry(mk.objectkey.key.fdb_entry);
-
     /*
-     * Now when we have serialized fdb entry with temporary VIDs
-     * replaced to current VIDs we can do dictionary lookup for fdb.
+     * Now when we have fdb entry with temporary VIDs replaced to current
+     * VIDs we can do dictionary lookup for fdb, entry is serialized only
+     * for logging.
      */
 
-    auto currentFdbIt = m_currentView.m_soFdbs.find(str_fdb_entry);
+    auto currentFdbIt = m_currentView.m_soFdbs.find(mk);
 
     if (currentFdbIt == m_currentView.m_soFdbs.end())
     {
-        SWSS_LOG_DEBUG("unable to find fdb entry %s in current asic view", str_fdb_entry.c_str());
+        SWSS_LOG_DEBUG("unable to find fdb entry %s in current asic view", sai_serialize_fdb_entry(mk.objectkey.key.fdb_entry).c_str());
 
         return nullptr;
     }
@@ -2350,7 +2362,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForFdbEntry(
      */
 
     SWSS_LOG_THROW("found fdb entry %s in current view, but it status is %d, FATAL",
-            str_fdb_entry.c_str(),
+            sai_serialize_fdb_entry(mk.objectkey.key.fdb_entry).c_str(),
             currentFdbObj->getObjectStatus());
 }
 
@@ -2433,17 +2445,16 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForNatEntry(
         return nullptr;
     }
 
-    std::string str_nat_entry = sai_serialize_nat_entry(mk.objectkey.key.nat_entry);
-
     /*
-     * Now when we have serialized NAT entry with temporary vr_id VID
-     * replaced to current vr_id VID we can do dictionary lookup for NAT entry.
+     * Now when we have NAT entry with temporary vr_id VID replaced to
+     * current vr_id VID we can do dictionary lookup for NAT entry, entry is
+     * serialized only for logging.
      */
-    auto currentNatEntry = m_currentView.m_soNatEntries.find(str_nat_entry);
+    auto currentNatEntry = m_currentView.m_soNatEntries.find(mk);
 
     if (currentNatEntry == m_currentView.m_soNatEntries.end())
     {
-        SWSS_LOG_DEBUG("unable to find NAT entry %s in current asic view", str_nat_entry.c_str());
+        SWSS_LOG_DEBUG("unable to find NAT entry %s in current asic view", sai_serialize_nat_entry(mk.objectkey.key.nat_entry).c_str());
 
         return nullptr;
     }
@@ -2467,7 +2478,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForNatEntry(
      */
 
     SWSS_LOG_THROW("found NAT entry %s in current view, but it status is %d, FATAL",
-            str_nat_entry.c_str(),
+            sai_serialize_nat_entry(mk.objectkey.key.nat_entry).c_str(),
             currentNatObj->getObjectStatus());
 }
 
@@ -3120,6 +3131,150 @@ std::shared_ptr<SaiAttr> BestCandidateFinder::getSaiAttrFromDefaultValue(
     return nullptr;
 }
 
+const std::vector<std::pair<const sai_attr_metadata_t*, std::shared_ptr<SaiAttr>>>& BestCandidateFinder::getSignatureAttributes(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_signatureAttributes.size() && m_signatureAttributes.front().first->objecttype == objectType)
+    {
+        return m_signatureAttributes;
+    }
+
+    m_signatureAttributes.clear();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    for (size_t idx = 0; info && info->attrmetadata[idx]; idx++)
+    {
+        const auto* meta = info->attrmetadata[idx];
+
+        /*
+         * Only primitive create only attributes are used, since their values
+         * can be compared as strings, exactly like hasEqualAttribute does.
+         * Object id attributes need VID translation and are skipped.
+         */
+
+        if (!SAI_HAS_FLAG_CREATE_ONLY(meta->flags) || meta->isoidattribute)
+            continue;
+
+        if (meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER ||
+                meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST)
+            continue;
+
+        std::shared_ptr<SaiAttr> defaultValue;
+
+        if (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_NONE)
+        {
+            // always present, unless object was discovered without it
+
+            if (!SAI_HAS_FLAG_MANDATORY_ON_CREATE(meta->flags) || meta->isconditional)
+                continue;
+        }
+        else if (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST ||
+                (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_CONST && meta->isprimitive))
+        {
+            switch (meta->attrvaluetype)
+            {
+                case SAI_ATTR_VALUE_TYPE_BOOL:
+                case SAI_ATTR_VALUE_TYPE_UINT8:
+                case SAI_ATTR_VALUE_TYPE_INT8:
+                case SAI_ATTR_VALUE_TYPE_UINT16:
+                case SAI_ATTR_VALUE_TYPE_INT16:
+                case SAI_ATTR_VALUE_TYPE_UINT32:
+                case SAI_ATTR_VALUE_TYPE_INT32:
+                case SAI_ATTR_VALUE_TYPE_UINT64:
+                case SAI_ATTR_VALUE_TYPE_INT64:
+
+                    defaultValue = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
+                    break;
+
+                default:
+
+                    // lists have empty list default, other const types are not supported
+
+                    if (meta->defaultvaluetype == SAI_DEFAULT_VALUE_TYPE_EMPTY_LIST)
+                    {
+                        defaultValue = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
+                    }
+
+                    break;
+            }
+
+            if (defaultValue == nullptr)
+                continue;
+        }
+        else
+        {
+            continue;
+        }
+
+        m_signatureAttributes.emplace_back(meta, defaultValue);
+    }
+
+    return m_signatureAttributes;
+}
+
+std::string BestCandidateFinder::getCreateOnlySignature(
+        _In_ const std::shared_ptr<const SaiObj> &obj)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Two objects with different signatures will never be selected as
+     * candidates, since they differ by create only attribute value (or
+     * default value when attribute is not present). Empty signature means
+     * object can't be indexed and it must be considered with every object.
+     */
+
+    std::string signature;
+
+    for (const auto &p: getSignatureAttributes(obj->getObjectType()))
+    {
+        const auto* meta = p.first;
+
+        signature += std::to_string(meta->attrid);
+        signature += "=";
+
+        if (obj->hasAttr(meta->attrid))
+        {
+            signature += obj->getSaiAttr(meta->attrid)->getStrAttrValue();
+        }
+        else if (p.second)
+        {
+            signature += p.second->getStrAttrValue();
+        }
+        else
+        {
+            return "";
+        }
+
+        signature += "|";
+    }
+
+    return signature;
+}
+
+std::vector<std::shared_ptr<SaiObj>> BestCandidateFinder::getNotProcessedCandidates(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_type_t objectType = temporaryObj->getObjectType();
+
+    auto signature = getCreateOnlySignature(temporaryObj);
+
+    if (signature.empty())
+    {
+        return m_currentView.getNotProcessedObjectsByObjectType(objectType);
+    }
+
+    return m_currentView.getNotProcessedObjectsBySignature(
+            objectType,
+            signature,
+            [this](const std::shared_ptr<const SaiObj> &obj) { return getCreateOnlySignature(obj); });
+}
+
 bool BestCandidateFinder::exchangeTemporaryVidToCurrentVid(
         _Inout_ sai_object_meta_key_t &meta_key)
 {
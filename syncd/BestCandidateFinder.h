@@ -132,6 +132,17 @@ namespace syncd
             std::shared_ptr<SaiObj> findCurrentBestMatchForInsegEntry(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
 
+        private:
+
+            std::vector<std::shared_ptr<SaiObj>> getNotProcessedCandidates(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
+
+            const std::vector<std::pair<const sai_attr_metadata_t*, std::shared_ptr<SaiAttr>>>& getSignatureAttributes(
+                    _In_ sai_object_type_t objectType);
+
+            std::string getCreateOnlySignature(
+                    _In_ const std::shared_ptr<const SaiObj> &obj);
+
         private:
 
             bool exchangeTemporaryVidToCurrentVid(
@@ -170,6 +181,12 @@ namespace syncd
 
         public:
 
+            /**
+             * @brief Sets random candidate selection seed for calling thread.
+             */
+            static void setRandomSeed(
+                    _In_ unsigned int seed);
+
             static bool hasEqualAttribute(
                     _In_ const AsicView &currentView,
                     _In_ const AsicView &temporaryView,
@@ -196,5 +213,7 @@ namespace syncd
             std::shared_ptr<const SaiObj> m_temporaryObj;
 
             std::vector<sai_object_compare_info_t> m_candidateObjects;
+
+            std::vector<std::pair<const sai_attr_metadata_t*, std::shared_ptr<SaiAttr>>> m_signatureAttributes;
     };
 }
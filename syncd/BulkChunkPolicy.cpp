@@ -0,0 +1,234 @@
+#include "BulkChunkPolicy.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+constexpr uint32_t BulkChunkPolicy::AUTO_TUNE_INITIAL_CHUNK_SIZE;
+constexpr uint32_t BulkChunkPolicy::AUTO_TUNE_MIN_CHUNK_SIZE;
+constexpr uint32_t BulkChunkPolicy::AUTO_TUNE_MAX_CHUNK_SIZE;
+constexpr uint32_t BulkChunkPolicy::AUTO_TUNE_SAMPLES;
+
+BulkChunkPolicy::BulkChunkPolicy():
+    m_autoTune(false),
+    m_defaultChunkSize(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::shared_ptr<BulkChunkPolicy> BulkChunkPolicy::parse(
+        _In_ const std::string& config)
+{
+    SWSS_LOG_ENTER();
+
+    auto policy = std::make_shared<BulkChunkPolicy>();
+
+    for (auto& item: swss::tokenize(config, ','))
+    {
+        if (item == "auto")
+        {
+            policy->setAutoTune(true);
+            continue;
+        }
+
+        auto pos = item.find(':');
+
+        try
+        {
+            if (pos == std::string::npos)
+            {
+                policy->setDefaultChunkSize((uint32_t)std::stoul(item));
+                continue;
+            }
+
+            sai_object_type_t objectType;
+
+            sai_deserialize_object_type(item.substr(0, pos), objectType);
+
+            policy->setChunkSize(objectType, (uint32_t)std::stoul(item.substr(pos + 1)));
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_THROW("invalid bulk chunk size item '%s': %s", item.c_str(), e.what());
+        }
+    }
+
+    return policy;
+}
+
+void BulkChunkPolicy::setAutoTune(
+        _In_ bool autoTune)
+{
+    SWSS_LOG_ENTER();
+
+    m_autoTune = autoTune;
+
+    m_tuneStates.clear();
+}
+
+bool BulkChunkPolicy::isAutoTune() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_autoTune;
+}
+
+void BulkChunkPolicy::setDefaultChunkSize(
+        _In_ uint32_t chunkSize)
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultChunkSize = chunkSize;
+}
+
+void BulkChunkPolicy::setChunkSize(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t chunkSize)
+{
+    SWSS_LOG_ENTER();
+
+    m_chunkSizes[objectType] = chunkSize;
+
+    m_tuneStates.erase(objectType);
+}
+
+uint32_t BulkChunkPolicy::getChunkSize(
+        _In_ sai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_autoTune)
+    {
+        auto it = m_tuneStates.find(objectType);
+
+        if (it != m_tuneStates.end())
+        {
+            return it->second.chunkSize;
+        }
+    }
+
+    auto it = m_chunkSizes.find(objectType);
+
+    uint32_t chunkSize = (it == m_chunkSizes.end()) ? m_defaultChunkSize : it->second;
+
+    if (m_autoTune && chunkSize == 0)
+    {
+        return AUTO_TUNE_INITIAL_CHUNK_SIZE;
+    }
+
+    return chunkSize;
+}
+
+BulkChunkPolicy::tune_state_t& BulkChunkPolicy::getTuneState(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_tuneStates.find(objectType);
+
+    if (it != m_tuneStates.end())
+    {
+        return it->second;
+    }
+
+    tune_state_t state;
+
+    state.chunkSize = std::min(std::max(getChunkSize(objectType), AUTO_TUNE_MIN_CHUNK_SIZE), AUTO_TUNE_MAX_CHUNK_SIZE);
+    state.direction = 1;
+    state.samples = 0;
+    state.objects = 0;
+    state.time = 0;
+    state.lastLatency = 0;
+
+    return m_tuneStates[objectType] = state;
+}
+
+void BulkChunkPolicy::update(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t objectCount,
+        _In_ uint64_t time)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_autoTune)
+    {
+        return;
+    }
+
+    auto& state = getTuneState(objectType);
+
+    if (objectCount < state.chunkSize)
+    {
+        return;
+    }
+
+    state.samples++;
+    state.objects += objectCount;
+    state.time += time;
+
+    if (state.samples < AUTO_TUNE_SAMPLES)
+    {
+        return;
+    }
+
+    double latency = (double)state.time / (double)state.objects;
+
+    if (state.lastLatency != 0 && latency > state.lastLatency)
+    {
+        state.direction = -state.direction;
+    }
+
+    state.lastLatency = latency;
+
+    uint32_t chunkSize = (state.direction > 0) ? state.chunkSize * 2 : state.chunkSize / 2;
+
+    chunkSize = std::min(std::max(chunkSize, AUTO_TUNE_MIN_CHUNK_SIZE), AUTO_TUNE_MAX_CHUNK_SIZE);
+
+    if (chunkSize == state.chunkSize)
+    {
+        // reached limit, try other direction next time
+
+        state.direction = -state.direction;
+    }
+
+    SWSS_LOG_INFO("%s bulk chunk size %u -> %u (%.1f ns per object)",
+            sai_serialize_object_type(objectType).c_str(),
+            state.chunkSize,
+            chunkSize,
+            latency);
+
+    state.chunkSize = chunkSize;
+    state.samples = 0;
+    state.objects = 0;
+    state.time = 0;
+}
+
+bool BulkChunkPolicy::isBulkSupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_notSupported.find(std::make_pair(objectType, api)) == m_notSupported.end();
+}
+
+void BulkChunkPolicy::setBulkNotSupported(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_notSupported.insert(std::make_pair(objectType, api)).second)
+    {
+        SWSS_LOG_NOTICE("vendor SAI don't support %s on %s, next bulks will be executed one by one",
+                sai_serialize_common_api(api).c_str(),
+                sai_serialize_object_type(objectType).c_str());
+    }
+}
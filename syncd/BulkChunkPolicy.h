@@ -0,0 +1,140 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "swss/sal.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace syncd
+{
+    /**
+     * @brief Bulk chunk policy.
+     *
+     * Decides how many objects are passed to vendor SAI in single bulk call
+     * per object type and remembers object types and bulk apis which vendor
+     * SAI reported as not supported, so failing bulk call is not repeated.
+     *
+     * Configuration is comma separated list of items:
+     *
+     *  "auto"            - enable chunk size auto tune from measured latency
+     *  "size"            - default chunk size for all object types
+     *  "OBJECT_TYPE:size" - chunk size for specific object type
+     *
+     * For example: "auto,512,SAI_OBJECT_TYPE_ROUTE_ENTRY:1000". Chunk size 0
+     * means no limit (entire bulk is executed in single call).
+     */
+    class BulkChunkPolicy
+    {
+        public:
+
+            static constexpr uint32_t AUTO_TUNE_INITIAL_CHUNK_SIZE = 512;
+
+            static constexpr uint32_t AUTO_TUNE_MIN_CHUNK_SIZE = 16;
+
+            static constexpr uint32_t AUTO_TUNE_MAX_CHUNK_SIZE = 16384;
+
+            /**
+             * @brief Number of full chunks measured before chunk size is adjusted.
+             */
+            static constexpr uint32_t AUTO_TUNE_SAMPLES = 8;
+
+        public:
+
+            BulkChunkPolicy();
+
+            virtual ~BulkChunkPolicy() = default;
+
+        public:
+
+            /**
+             * @brief Parse configuration string, throws on invalid item.
+             */
+            static std::shared_ptr<BulkChunkPolicy> parse(
+                    _In_ const std::string& config);
+
+        public:
+
+            void setAutoTune(
+                    _In_ bool autoTune);
+
+            bool isAutoTune() const;
+
+            void setDefaultChunkSize(
+                    _In_ uint32_t chunkSize);
+
+            void setChunkSize(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t chunkSize);
+
+            /**
+             * @brief Get current chunk size for object type, 0 means no limit.
+             */
+            uint32_t getChunkSize(
+                    _In_ sai_object_type_t objectType) const;
+
+            /**
+             * @brief Report execution time (in nanoseconds) of single bulk chunk.
+             *
+             * Used to auto tune chunk size. Only full size chunks are taken
+             * into account, since latency per object of smaller chunks is
+             * not comparable. Chunk size is moved (doubled or halved) in the
+             * same direction while latency per object improves and direction
+             * is reversed when it gets worse.
+             */
+            void update(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t objectCount,
+                    _In_ uint64_t time);
+
+            bool isBulkSupported(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api) const;
+
+            void setBulkNotSupported(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api);
+
+        private:
+
+            typedef struct _tune_state_t
+            {
+                uint32_t chunkSize;
+
+                int direction;
+
+                uint32_t samples;
+
+                uint64_t objects;
+
+                uint64_t time;
+
+                /**
+                 * @brief Latency per object measured for previous chunk size.
+                 */
+                double lastLatency;
+
+            } tune_state_t;
+
+            tune_state_t& getTuneState(
+                    _In_ sai_object_type_t objectType);
+
+        private:
+
+            bool m_autoTune;
+
+            uint32_t m_defaultChunkSize;
+
+            std::map<sai_object_type_t, uint32_t> m_chunkSizes;
+
+            std::map<sai_object_type_t, tune_state_t> m_tuneStates;
+
+            std::set<std::pair<sai_object_type_t, sai_common_api_t>> m_notSupported;
+    };
+}
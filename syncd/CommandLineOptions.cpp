@@ -47,6 +47,16 @@ CommandLineOptions::CommandLineOptions()
     m_supportingBulkCounterGroups = "";
 
     m_enableAttrVersionCheck = false;
+
+    m_latencyStatsInterval = 0;
+
+    m_vendorSaiLockPolicy = VENDOR_SAI_LOCK_POLICY_GLOBAL;
+
+    m_bulkChunkSize = "";
+
+    m_bulkDeserializeThreads = 0;
+
+    m_enableResponseBatch = false;
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -71,6 +81,11 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " WatchdogWarnTimeSpan=" << m_watchdogWarnTimeSpan;
     ss << " SupportingBulkCounters=" << m_supportingBulkCounterGroups;
     ss << " EnableAttrVersionCheck=" << (m_enableAttrVersionCheck ? "YES" : "NO");
+    ss << " LatencyStatsInterval=" << m_latencyStatsInterval;
+    ss << " VendorSaiLockPolicy=" << VendorSaiOptions::lockPolicyToString(m_vendorSaiLockPolicy);
+    ss << " BulkChunkSize=" << m_bulkChunkSize;
+    ss << " BulkDeserializeThreads=" << m_bulkDeserializeThreads;
+    ss << " EnableResponseBatch=" << (m_enableResponseBatch ? "YES" : "NO");
 
 #ifdef SAITHRIFT
 
@@ -2,6 +2,8 @@
 
 #include "sairedis.h"
 
+#include "VendorSaiOptions.h"
+
 #include "swss/sal.h"
 
 #include <string>
@@ -101,5 +103,24 @@ namespace syncd
             std::string m_supportingBulkCounterGroups;
 
             bool m_enableAttrVersionCheck;
+
+            /**
+             * @brief Latency stats export interval in seconds, 0 disables.
+             */
+            uint32_t m_latencyStatsInterval;
+
+            vendor_sai_lock_policy_t m_vendorSaiLockPolicy;
+
+            /**
+             * @brief Bulk chunk size configuration, see BulkChunkPolicy.
+             */
+            std::string m_bulkChunkSize;
+
+            /**
+             * @brief Number of threads deserializing bulk objects, 0 disables.
+             */
+            uint32_t m_bulkDeserializeThreads;
+
+            bool m_enableResponseBatch;
     };
 }
@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:B:aw:L:P:k:j:euSUCsz:lrm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:B:aw:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:B:aw:L:P:k:j:euSUCsz:lh";
 #endif // SAITHRIFT
 
     while (true)
@@ -44,6 +44,11 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "watchdogWarnTimeSpan",    optional_argument, 0, 'w' },
             { "supportingBulkCounters",  required_argument, 0, 'B' },
             { "enableAttrVersionCheck",  no_argument,       0, 'a' },
+            { "latencyStatsInterval",    required_argument, 0, 'L' },
+            { "vendorSaiLockPolicy",     required_argument, 0, 'P' },
+            { "bulkChunkSize",           required_argument, 0, 'k' },
+            { "bulkDeserializeThreads",  required_argument, 0, 'j' },
+            { "enableResponseBatch",     no_argument,       0, 'e' },
 #ifdef SAITHRIFT
             { "rpcserver",               no_argument,       0, 'r' },
             { "portmap",                 required_argument, 0, 'm' },
@@ -143,6 +148,26 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableAttrVersionCheck = true;
                 break;
 
+            case 'L':
+                options->m_latencyStatsInterval = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'P':
+                options->m_vendorSaiLockPolicy = VendorSaiOptions::lockPolicyFromString(optarg);
+                break;
+
+            case 'k':
+                options->m_bulkChunkSize = std::string(optarg);
+                break;
+
+            case 'j':
+                options->m_bulkDeserializeThreads = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'e':
+                options->m_enableResponseBatch = true;
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -166,9 +191,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-P policy] [-k chunkSize] [-j threads] [-e] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-P policy] [-k chunkSize] [-j threads] [-e] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -188,7 +213,7 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "    -s --syncMode" << std::endl;
     std::cout << "        Enable synchronous mode (depreacated, use -z)" << std::endl;
     std::cout << "    -z --redisCommunicationMode" << std::endl;
-    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async" << std::endl;
+    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync|shm_sync), default: redis_async" << std::endl;
     std::cout << "    -l --enableBulk" << std::endl;
     std::cout << "        Enable SAI Bulk support" << std::endl;
     std::cout << "    -g --globalContext" << std::endl;
@@ -203,6 +228,16 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Counter groups those support bulk polling" << std::endl;
     std::cout << "    -a --enableAttrVersionCheck" << std::endl;
     std::cout << "        Enable attribute SAI version check when performing SAI discovery" << std::endl;
+    std::cout << "    -L --latencyStatsInterval interval" << std::endl;
+    std::cout << "        Record per operation latency and export it to COUNTERS_DB every interval seconds" << std::endl;
+    std::cout << "    -P --vendorSaiLockPolicy policy" << std::endl;
+    std::cout << "        Vendor SAI lock policy (global|domain|none), default: global" << std::endl;
+    std::cout << "    -k --bulkChunkSize chunkSize" << std::endl;
+    std::cout << "        Bulk chunk size per object type, e.g. auto,512,SAI_OBJECT_TYPE_ROUTE_ENTRY:1000" << std::endl;
+    std::cout << "    -j --bulkDeserializeThreads threads" << std::endl;
+    std::cout << "        Number of threads deserializing bulk objects in parallel, default: 0 (disabled)" << std::endl;
+    std::cout << "    -e --enableResponseBatch" << std::endl;
+    std::cout << "        Send responses of consecutively processed requests in single message (redis modes only)" << std::endl;
 
 #ifdef SAITHRIFT
 
@@ -64,11 +64,9 @@ ComparisonLogic::ComparisonLogic(
     m_current->m_defaultTrapGroupRid     = m_switch->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
     m_temp->m_defaultTrapGroupRid        = m_switch->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
 
-    auto seed = (unsigned int)std::time(0);
+    m_randomSeed = (unsigned int)std::time(0);
 
-    SWSS_LOG_NOTICE("srand seed for switch %s: %u", sai_serialize_object_id(m_switch->getVid()).c_str(), seed);
-
-    std::srand(seed);
+    SWSS_LOG_NOTICE("srand seed for switch %s: %u", sai_serialize_object_id(m_switch->getVid()).c_str(), m_randomSeed);
 }
 
 ComparisonLogic::~ComparisonLogic()
@@ -85,6 +83,8 @@ void ComparisonLogic::compareViews()
     AsicView& current = *m_current;
     AsicView& temp = *m_temp;
 
+    BestCandidateFinder::setRandomSeed(m_randomSeed);
+
     /*
      * Match oids before calling populate existing objects since after
      * matching oids RID and VID maps will be populated.
@@ -2935,8 +2935,8 @@ void ComparisonLogic::createPreMatchMap(
         if (it->second.size() != 1)
             continue;
 
-        auto& tObj = tmp.m_soAll.at(pk.second.at(0));
-        auto& cObj = cur.m_soAll.at(it->second.at(0));
+        auto& tObj = pk.second.at(0);
+        auto& cObj = it->second.at(0);
 
         createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
     }
@@ -2958,8 +2958,8 @@ void ComparisonLogic::createPreMatchMap(
         if (it->second.size() != 1)
             continue;
 
-        auto& tObj = tmp.m_soAll.at(pk.second.at(0));
-        auto& cObj = cur.m_soAll.at(it->second.at(0));
+        auto& tObj = pk.second.at(0);
+        auto& cObj = it->second.at(0);
 
         createPreMatchMapForObject(cur, tmp, cObj, tObj, processed);
 
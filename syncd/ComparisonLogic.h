@@ -254,5 +254,13 @@ namespace syncd
             std::shared_ptr<NotificationHandler> m_handler;
 
             std::shared_ptr<BreakConfig> m_breakConfig;
+
+            /**
+             * @brief Seed for random candidate selection.
+             *
+             * Applied in compareViews, since views can be compared on
+             * different threads.
+             */
+            unsigned int m_randomSeed;
     };
 }
@@ -0,0 +1,383 @@
+#include "LatencyRecorder.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/dbconnector.h"
+
+#include <chrono>
+
+using namespace syncd;
+using namespace sairediscommon;
+
+constexpr const char* LatencyRecorder::COUNTERS_TABLE;
+
+#define OBJECT_TYPE_SLOTS 512
+
+// last slot collects object types outside of known ranges
+
+#define OBJECT_TYPE_OVERFLOW_SLOT (OBJECT_TYPE_SLOTS - 1)
+
+#define OBJECT_TYPE_OVERFLOW_LABEL "OTHER"
+
+static_assert(SAI_OBJECT_TYPE_MAX <= OBJECT_TYPE_SLOTS / 2, "object type slots must fit all object types");
+static_assert((SAI_OBJECT_TYPE_EXTENSIONS_RANGE_END - SAI_OBJECT_TYPE_EXTENSIONS_RANGE_START) < OBJECT_TYPE_SLOTS / 2,
+        "object type slots must fit all extensions object types and overflow slot");
+
+#define STATUS_SLOTS 2
+
+static const std::vector<std::string> g_ops = {
+    REDIS_ASIC_STATE_COMMAND_CREATE,
+    REDIS_ASIC_STATE_COMMAND_REMOVE,
+    REDIS_ASIC_STATE_COMMAND_SET,
+    REDIS_ASIC_STATE_COMMAND_GET,
+    REDIS_ASIC_STATE_COMMAND_BULK_CREATE,
+    REDIS_ASIC_STATE_COMMAND_BULK_REMOVE,
+    REDIS_ASIC_STATE_COMMAND_BULK_SET,
+    REDIS_ASIC_STATE_COMMAND_BULK_GET,
+    REDIS_ASIC_STATE_COMMAND_NOTIFY,
+    REDIS_ASIC_STATE_COMMAND_GET_STATS,
+    REDIS_ASIC_STATE_COMMAND_CLEAR_STATS,
+    REDIS_ASIC_STATE_COMMAND_FLUSH,
+    REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY,
+    REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY,
+    REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_QUERY,
+    REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_QUERY,
+    REDIS_FLEX_COUNTER_COMMAND_START_POLL,
+    REDIS_FLEX_COUNTER_COMMAND_STOP_POLL,
+    REDIS_FLEX_COUNTER_COMMAND_SET_GROUP,
+    REDIS_FLEX_COUNTER_COMMAND_DEL_GROUP,
+};
+
+LatencyRecorder::LatencyRecorder(
+        _In_ const std::string& dbCounters,
+        _In_ uint32_t exportInterval):
+    m_dbCounters(dbCounters),
+    m_exportInterval(exportInterval),
+    m_enabled(exportInterval != 0),
+    m_ops(g_ops),
+    m_eventOpIndex(g_ops.size()),
+    m_eventObjectType(SAI_OBJECT_TYPE_NULL),
+    m_eventStart(0),
+    m_runThread(true)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < m_ops.size(); idx++)
+    {
+        m_opIndex[m_ops[idx]] = idx;
+    }
+
+    for (auto& stage: m_eventStages)
+    {
+        stage = 0;
+    }
+
+    m_slotCount = m_ops.size() * OBJECT_TYPE_SLOTS * STATUS_SLOTS;
+
+    m_entries.reset(new std::atomic<entry_t*>[m_slotCount]);
+
+    for (size_t idx = 0; idx < m_slotCount; idx++)
+    {
+        m_entries[idx] = nullptr;
+    }
+
+    if (m_enabled)
+    {
+        SWSS_LOG_NOTICE("latency stats enabled, export interval %u sec", m_exportInterval);
+
+        m_thread = std::make_shared<std::thread>(&LatencyRecorder::exportThreadFunction, this);
+    }
+}
+
+LatencyRecorder::~LatencyRecorder()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_thread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_runThread = false;
+        }
+
+        m_cv.notify_all();
+
+        m_thread->join();
+    }
+
+    for (size_t idx = 0; idx < m_slotCount; idx++)
+    {
+        delete m_entries[idx].load();
+    }
+}
+
+bool LatencyRecorder::isEnabled() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_enabled;
+}
+
+uint64_t LatencyRecorder::now()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LatencyRecorder::beginEvent(
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+        return;
+
+    auto it = m_opIndex.find(op);
+
+    m_eventOpIndex = (it == m_opIndex.end()) ? m_ops.size() : it->second;
+
+    m_eventObjectType = SAI_OBJECT_TYPE_NULL;
+
+    m_eventStart = now();
+}
+
+void LatencyRecorder::setObjectType(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    m_eventObjectType = objectType;
+}
+
+void LatencyRecorder::addStageTime(
+        _In_ stage_t stage,
+        _In_ uint64_t nanoseconds)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (m_enabled)
+    {
+        m_eventStages[stage] += nanoseconds;
+    }
+}
+
+uint64_t LatencyRecorder::getStageTime(
+        _In_ stage_t stage) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_eventStages[stage];
+}
+
+void LatencyRecorder::endEvent(
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+        return;
+
+    m_eventStages[STAGE_TOTAL] = now() - m_eventStart;
+
+    if (m_eventOpIndex < m_ops.size())
+    {
+        auto entry = getEntry(m_eventOpIndex, m_eventObjectType, status);
+
+        for (int stage = 0; stage < STAGE_MAX; stage++)
+        {
+            // stage was not executed for this event, e.g. pop of event
+            // processed outside of channel or translate on remove
+
+            if (m_eventStages[stage] == 0)
+                continue;
+
+            entry->m_stages[stage].record(m_eventStages[stage]);
+        }
+    }
+
+    for (auto& stage: m_eventStages)
+    {
+        stage = 0;
+    }
+
+    m_eventOpIndex = m_ops.size();
+}
+
+size_t LatencyRecorder::getObjectTypeSlot(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if ((int)objectType < SAI_OBJECT_TYPE_MAX)
+    {
+        return (size_t)objectType;
+    }
+
+    if ((int)objectType >= SAI_OBJECT_TYPE_EXTENSIONS_RANGE_START &&
+            (int)objectType < SAI_OBJECT_TYPE_EXTENSIONS_RANGE_END)
+    {
+        return OBJECT_TYPE_SLOTS / 2 + (size_t)(objectType - SAI_OBJECT_TYPE_EXTENSIONS_RANGE_START);
+    }
+
+    return OBJECT_TYPE_OVERFLOW_SLOT;
+}
+
+LatencyRecorder::entry_t* LatencyRecorder::getEntry(
+        _In_ size_t opIndex,
+        _In_ sai_object_type_t objectType,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    bool success = (status == SAI_STATUS_SUCCESS);
+
+    size_t objectTypeSlot = getObjectTypeSlot(objectType);
+
+    size_t slot = (opIndex * OBJECT_TYPE_SLOTS + objectTypeSlot) * STATUS_SLOTS + (success ? 0 : 1);
+
+    entry_t* entry = m_entries[slot].load(std::memory_order_acquire);
+
+    if (entry)
+    {
+        return entry;
+    }
+
+    // first event of this kind, entries are never removed, so export thread
+    // can safely read them without lock
+
+    auto created = new entry_t();
+
+    // overflow slot is shared by different object types, so it can't be
+    // labeled by type of the first event
+
+    created->m_key = m_ops[opIndex] + ":" +
+        (objectTypeSlot == OBJECT_TYPE_OVERFLOW_SLOT ? OBJECT_TYPE_OVERFLOW_LABEL : sai_serialize_object_type(objectType)) + ":" +
+        (success ? "SUCCESS" : "FAILURE");
+
+    if (m_entries[slot].compare_exchange_strong(entry, created, std::memory_order_acq_rel))
+    {
+        return created;
+    }
+
+    delete created;
+
+    return entry;
+}
+
+std::map<std::string, std::vector<swss::FieldValueTuple>> LatencyRecorder::getCounters() const
+{
+    SWSS_LOG_ENTER();
+
+    std::map<std::string, std::vector<swss::FieldValueTuple>> counters;
+
+    for (size_t idx = 0; idx < m_slotCount; idx++)
+    {
+        const entry_t* entry = m_entries[idx].load(std::memory_order_acquire);
+
+        if (entry == nullptr)
+            continue;
+
+        auto& values = counters[entry->m_key];
+
+        for (int stage = 0; stage < STAGE_MAX; stage++)
+        {
+            auto& hist = entry->m_stages[stage];
+
+            if (hist.getCount() == 0)
+                continue;
+
+            auto name = stageToString((stage_t)stage);
+
+            values.emplace_back(name + "_count", std::to_string(hist.getCount()));
+            values.emplace_back(name + "_sum_ns", std::to_string(hist.getSum()));
+            values.emplace_back(name + "_p50_ns", std::to_string(hist.getPercentile(50)));
+            values.emplace_back(name + "_p99_ns", std::to_string(hist.getPercentile(99)));
+            values.emplace_back(name + "_p999_ns", std::to_string(hist.getPercentile(99.9)));
+            values.emplace_back(name + "_max_ns", std::to_string(hist.getMax()));
+        }
+    }
+
+    return counters;
+}
+
+void LatencyRecorder::exportCounters()
+{
+    SWSS_LOG_ENTER();
+
+    auto counters = getCounters();
+
+    if (counters.empty())
+        return;
+
+    swss::DBConnector db(m_dbCounters, 0);
+
+    swss::Table table(&db, COUNTERS_TABLE);
+
+    for (auto& kv: counters)
+    {
+        table.set(kv.first, kv.second);
+    }
+}
+
+void LatencyRecorder::exportThreadFunction()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("starting latency stats export thread");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_runThread)
+    {
+        m_cv.wait_for(lock, std::chrono::seconds(m_exportInterval));
+
+        if (!m_runThread)
+            break;
+
+        try
+        {
+            exportCounters();
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to export latency stats: %s", e.what());
+        }
+    }
+
+    SWSS_LOG_NOTICE("ending latency stats export thread");
+}
+
+std::string LatencyRecorder::stageToString(
+        _In_ stage_t stage)
+{
+    SWSS_LOG_ENTER();
+
+    switch (stage)
+    {
+        case STAGE_POP:
+            return "pop";
+
+        case STAGE_DESERIALIZE:
+            return "deserialize";
+
+        case STAGE_TRANSLATE:
+            return "translate";
+
+        case STAGE_VENDOR:
+            return "vendor";
+
+        case STAGE_RESPONSE:
+            return "response";
+
+        case STAGE_TOTAL:
+            return "total";
+
+        default:
+            SWSS_LOG_THROW("unknown stage %d", stage);
+    }
+}
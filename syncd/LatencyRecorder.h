@@ -0,0 +1,185 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "meta/LatencyHistogram.h"
+
+#include "swss/table.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Per operation latency recorder.
+     *
+     * Keeps latency histogram of each processing stage per operation (redis
+     * command), object type and status (success or failure), and exports
+     * them periodically to COUNTERS_DB, so tail latency can be attributed to
+     * specific processing stage in production.
+     *
+     * Event state (begin, stages, end) is only accessed from syncd main
+     * thread, histograms are lock free and exported from separate thread.
+     */
+    class LatencyRecorder
+    {
+        public:
+
+            typedef enum _stage_t
+            {
+                /**
+                 * @brief Reading event from channel (and temporary view update).
+                 */
+                STAGE_POP,
+
+                /**
+                 * @brief Deserialization of object key and attributes.
+                 */
+                STAGE_DESERIALIZE,
+
+                /**
+                 * @brief Translation of VIDs to RIDs in attributes.
+                 */
+                STAGE_TRANSLATE,
+
+                /**
+                 * @brief Vendor SAI call, including object key translation.
+                 */
+                STAGE_VENDOR,
+
+                /**
+                 * @brief Sending response and updating redis database.
+                 */
+                STAGE_RESPONSE,
+
+                /**
+                 * @brief Whole event processing, excluding pop.
+                 */
+                STAGE_TOTAL,
+
+                STAGE_MAX,
+
+            } stage_t;
+
+            static constexpr const char* COUNTERS_TABLE = "SYNCD_LATENCY_STATS";
+
+        public:
+
+            /**
+             * @brief Latency recorder constructor.
+             *
+             * @param dbCounters Counters database name.
+             * @param exportInterval Export interval in seconds, 0 disables
+             * recording and export.
+             */
+            LatencyRecorder(
+                    _In_ const std::string& dbCounters,
+                    _In_ uint32_t exportInterval);
+
+            virtual ~LatencyRecorder();
+
+        public:
+
+            bool isEnabled() const;
+
+            static uint64_t now();
+
+            void beginEvent(
+                    _In_ const std::string& op);
+
+            void setObjectType(
+                    _In_ sai_object_type_t objectType);
+
+            void addStageTime(
+                    _In_ stage_t stage,
+                    _In_ uint64_t nanoseconds);
+
+            uint64_t getStageTime(
+                    _In_ stage_t stage) const;
+
+            /**
+             * @brief Records all stages of current event and clears them.
+             */
+            void endEvent(
+                    _In_ sai_status_t status);
+
+            /**
+             * @brief Gets counters of all recorded events.
+             *
+             * @return Map of COUNTERS_DB key (operation:object_type:status) to fields.
+             */
+            std::map<std::string, std::vector<swss::FieldValueTuple>> getCounters() const;
+
+            void exportCounters();
+
+        public:
+
+            static std::string stageToString(
+                    _In_ stage_t stage);
+
+        private:
+
+            typedef struct _entry_t
+            {
+                std::string m_key;
+
+                sairediscommon::LatencyHistogram m_stages[STAGE_MAX];
+
+            } entry_t;
+
+            static size_t getObjectTypeSlot(
+                    _In_ sai_object_type_t objectType);
+
+            entry_t* getEntry(
+                    _In_ size_t opIndex,
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_status_t status);
+
+            void exportThreadFunction();
+
+        private:
+
+            std::string m_dbCounters;
+
+            uint32_t m_exportInterval;
+
+            bool m_enabled;
+
+            std::vector<std::string> m_ops;
+
+            std::map<std::string, size_t> m_opIndex;
+
+            size_t m_slotCount;
+
+            std::unique_ptr<std::atomic<entry_t*>[]> m_entries;
+
+            // current event, accessed only from processing thread
+
+            size_t m_eventOpIndex;
+
+            sai_object_type_t m_eventObjectType;
+
+            uint64_t m_eventStart;
+
+            uint64_t m_eventStages[STAGE_MAX];
+
+            // export thread
+
+            bool m_runThread;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
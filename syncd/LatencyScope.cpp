@@ -0,0 +1,31 @@
+#include "LatencyScope.h"
+
+using namespace syncd;
+
+LatencyScope::LatencyScope(
+        _In_ LatencyRecorder& lr,
+        _In_ const std::string& op):
+    m_lr(lr),
+    m_status(SAI_STATUS_FAILURE)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_lr.beginEvent(op);
+}
+
+LatencyScope::~LatencyScope()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_lr.endEvent(m_status);
+}
+
+sai_status_t LatencyScope::setStatus(
+        _In_ sai_status_t status)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_status = status;
+
+    return status;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "LatencyRecorder.h"
+
+namespace syncd
+{
+    /**
+     * @brief Latency scope.
+     *
+     * Begins event on latency recorder and ends it with status set by
+     * setStatus (or failure if scope was left by exception).
+     */
+    class LatencyScope
+    {
+        public:
+
+            LatencyScope(
+                    _In_ LatencyRecorder& latencyRecorder,
+                    _In_ const std::string& op);
+
+            ~LatencyScope();
+
+        public:
+
+            sai_status_t setStatus(
+                    _In_ sai_status_t status);
+
+        private:
+
+            LatencyRecorder& m_lr;
+
+            sai_status_t m_status;
+    };
+}
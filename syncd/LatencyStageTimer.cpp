@@ -0,0 +1,38 @@
+#include "LatencyStageTimer.h"
+
+using namespace syncd;
+
+LatencyStageTimer::LatencyStageTimer(
+        _In_ LatencyRecorder& lr,
+        _In_ LatencyRecorder::stage_t stage):
+    m_lr(lr),
+    m_stage(stage),
+    m_start(0),
+    m_running(lr.isEnabled())
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (m_running)
+    {
+        m_start = LatencyRecorder::now();
+    }
+}
+
+LatencyStageTimer::~LatencyStageTimer()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    stop();
+}
+
+void LatencyStageTimer::stop()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (m_running)
+    {
+        m_lr.addStageTime(m_stage, LatencyRecorder::now() - m_start);
+
+        m_running = false;
+    }
+}
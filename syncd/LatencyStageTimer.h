@@ -0,0 +1,37 @@
+#pragma once
+
+#include "LatencyRecorder.h"
+
+namespace syncd
+{
+    /**
+     * @brief Latency stage timer.
+     *
+     * Adds time between construction and stop (or destruction) to given
+     * stage of current event. Does not read clock when recorder is disabled.
+     */
+    class LatencyStageTimer
+    {
+        public:
+
+            LatencyStageTimer(
+                    _In_ LatencyRecorder& latencyRecorder,
+                    _In_ LatencyRecorder::stage_t stage);
+
+            ~LatencyStageTimer();
+
+        public:
+
+            void stop();
+
+        private:
+
+            LatencyRecorder& m_lr;
+
+            LatencyRecorder::stage_t m_stage;
+
+            uint64_t m_start;
+
+            bool m_running;
+    };
+}
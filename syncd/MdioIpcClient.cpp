@@ -13,6 +13,8 @@
 #include <time.h>
 #include <pthread.h>
 #include <mutex>
+#include <vector>
+#include <algorithm>
 
 #include "MdioIpcClient.h"
 #include "MdioIpcCommon.h"
@@ -23,26 +25,36 @@ static std::mutex ipcMutex;
 
 /* Global variables */
 
-static int syncd_mdio_ipc_command(char *cmd, char *resp)
+static int sock = 0;
+static char path[128] = { 0 };
+static char cpath[128] = { 0 };
+static time_t timeout = 0;
+static uint32_t seq = 0;
+static bool textOnly = false;   /* server does not speak the binary protocol */
+
+static void syncd_mdio_ipc_disconnect()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (sock > 0)
+    {
+        close(sock);
+        unlink(cpath);
+    }
+    sock = 0;
+}
+
+static int syncd_mdio_ipc_connect()
 {
     // SWSS_LOG_ENTER(); // disabled
 
     int fd;
-    ssize_t ret;
-    size_t len;
     struct sockaddr_un saddr, caddr;
-    static int sock = 0;
-    static char path[128] = { 0 };
-    static time_t timeout = 0;
 
     if (timeout < time(NULL))
     {
         /* It might already be timed out at the server side, reconnect ... */
-        if (sock > 0)
-        {
-            close(sock);
-        }
-        sock = 0;
+        syncd_mdio_ipc_disconnect();
     }
 
     if (strlen(path) == 0)
@@ -73,6 +85,7 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
 
         caddr.sun_family = AF_UNIX;
         snprintf(caddr.sun_path, sizeof(caddr.sun_path), "%s/%s.cli.%d", path, SYNCD_IPC_SOCK_FILE, getpid());
+        snprintf(cpath, sizeof(cpath), "%s", caddr.sun_path);
         unlink(caddr.sun_path);
         if (bind(sock, (struct sockaddr *)&caddr, sizeof(caddr)) < 0)
         {
@@ -94,14 +107,78 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
         }
     }
 
+    return 0;
+}
+
+static int syncd_mdio_ipc_send_all(const void *buf, size_t len)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    const uint8_t *ptr = (const uint8_t *)buf;
+
+    while (len > 0)
+    {
+        ssize_t ret = send(sock, ptr, len, 0);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            SWSS_LOG_ERROR("send failed :%s", strerror(errno));
+            return -EIO;
+        }
+        ptr += ret;
+        len -= (size_t)ret;
+    }
+
+    return 0;
+}
+
+static int syncd_mdio_ipc_recv_all(void *buf, size_t len)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    uint8_t *ptr = (uint8_t *)buf;
+
+    while (len > 0)
+    {
+        ssize_t ret = recv(sock, ptr, len, 0);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0)
+        {
+            SWSS_LOG_ERROR("recv failed, ret=%ld\n", ret);
+            return -EIO;
+        }
+        ptr += ret;
+        len -= (size_t)ret;
+    }
+
+    return 0;
+}
+
+static int syncd_mdio_ipc_command(char *cmd, char *resp)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    ssize_t ret;
+    size_t len;
+
+    ret = syncd_mdio_ipc_connect();
+    if (ret != 0)
+    {
+        return (int)ret;
+    }
+
     len = strlen(cmd);
     ret = send(sock, cmd, len, 0);
     if (ret < (ssize_t)len)
     {
         SWSS_LOG_ERROR("send failed, ret=%ld, expected=%ld\n", ret, len);
-        close(sock);
-        sock = 0;
-        unlink(caddr.sun_path);
+        syncd_mdio_ipc_disconnect();
         return -EIO;
     }
 
@@ -109,143 +186,223 @@ static int syncd_mdio_ipc_command(char *cmd, char *resp)
     if (ret <= 0)
     {
         SWSS_LOG_ERROR("recv failed, ret=%ld\n", ret);
-        close(sock);
-        sock = 0;
-        unlink(caddr.sun_path);
+        syncd_mdio_ipc_disconnect();
         return -EIO;
     }
+    resp[ret] = 0;
 
     timeout = time(NULL) + MDIO_CLIENT_TIMEOUT;
     return (int)strtol(resp, NULL, 0);
 }
 
-
-/* Function to read data from MDIO interface */
-sai_status_t mdio_read(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
-        uint32_t number_of_registers, uint32_t *data)
+/*
+ * Access "count" consecutive registers using the legacy text protocol,
+ * one command per register.
+ */
+static sai_status_t syncd_mdio_ipc_text(uint32_t op, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t count, uint32_t *rdata, const uint32_t *wdata)
 {
     // SWSS_LOG_ENTER(); // disabled
 
-    int rc = SAI_STATUS_FAILURE;
+    int rc;
     char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE];
+    const char *name = ((op == MDIO_IPC_OP_READ_CL22) || (op == MDIO_IPC_OP_WRITE_CL22)) ? "mdio-cl22" : "mdio";
 
-    if (number_of_registers > 1)
+    for (uint32_t i = 0; i < count; ++i)
     {
-        SWSS_LOG_ERROR("Multiple register reads are not supported, num_of_registers: %d\n", number_of_registers);
-        return SAI_STATUS_FAILURE;
-    }
+        if (MDIO_IPC_IS_WRITE_OP(op))
+        {
+            sprintf(cmd, "%s 0x%x 0x%x 0x%x\n", name, mdio_addr, reg_addr + i, wdata[i]);
+        }
+        else
+        {
+            sprintf(cmd, "%s 0x%x 0x%x\n", name, mdio_addr, reg_addr + i);
+        }
 
-    ipcMutex.lock();
+        rc = syncd_mdio_ipc_command(cmd, resp);
+        if (rc != 0)
+        {
+            SWSS_LOG_ERROR("syncd_mdio_ipc_command returns : %d\n", rc);
+            return rc;
+        }
 
-    sprintf(cmd, "mdio 0x%x 0x%x\n", mdio_addr, reg_addr);
-    rc = syncd_mdio_ipc_command(cmd, resp);
-    if (rc == 0)
-    {
-        *data = (uint32_t)strtoul(strchrnul(resp, ' ') + 1, NULL, 0);
-        rc = SAI_STATUS_SUCCESS;
-    }
-    else
-    {
-        SWSS_LOG_ERROR("syncd_mdio_ipc_command returns : %d\n", rc);
+        if (!MDIO_IPC_IS_WRITE_OP(op))
+        {
+            rdata[i] = (uint32_t)strtoul(strchrnul(resp, ' ') + 1, NULL, 0);
+        }
     }
 
-    ipcMutex.unlock();
-    return rc;
+    return SAI_STATUS_SUCCESS;
 }
 
-/* Function to write data to MDIO interface */
-sai_status_t mdio_write(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
-        uint32_t number_of_registers, const uint32_t *data)
+/*
+ * Access "count" consecutive registers using the binary protocol. Bursts
+ * longer than MDIO_IPC_MAX_REGS are split into several frames, and up to
+ * MDIO_IPC_PIPELINE_DEPTH frames are kept in flight.
+ *
+ * Returns -EPROTONOSUPPORT if the server only speaks the text protocol.
+ */
+static int syncd_mdio_ipc_binary(uint32_t op, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t count, uint32_t *rdata, const uint32_t *wdata)
 {
     // SWSS_LOG_ENTER(); // disabled
 
-    int rc = SAI_STATUS_FAILURE;
-    char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE];
+    int rc;
+    uint32_t frames = (count + MDIO_IPC_MAX_REGS - 1) / MDIO_IPC_MAX_REGS;
+    uint32_t sent = 0, done = 0;
+    uint32_t base = seq;
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    std::vector<uint8_t> frame;
 
-    if (number_of_registers > 1)
-    {
-        SWSS_LOG_ERROR("Multiple register reads are not supported, num_of_registers: %d\n", number_of_registers);
-        return SAI_STATUS_FAILURE;
-    }
-
-    ipcMutex.lock();
+    seq += frames;
 
-    sprintf(cmd, "mdio 0x%x 0x%x 0x%x\n", mdio_addr, reg_addr, *data);
-    rc = syncd_mdio_ipc_command(cmd, resp);
-    if (rc == 0)
+    rc = syncd_mdio_ipc_connect();
+    if (rc != 0)
     {
-        rc = SAI_STATUS_SUCCESS;
+        return rc;
     }
-    else
+
+    while (done < frames)
     {
-        SWSS_LOG_ERROR("syncd_mdio_ipc_command returns : %d\n", rc);
+        while ((sent < frames) && (sent - done < MDIO_IPC_PIPELINE_DEPTH))
+        {
+            mdio_ipc_req_t req;
+
+            req.magic = MDIO_IPC_MAGIC;
+            req.seq = base + sent;
+            req.op = op;
+            req.mdio_addr = mdio_addr;
+            req.reg_addr = reg_addr + sent * MDIO_IPC_MAX_REGS;
+            req.count = std::min(count - sent * MDIO_IPC_MAX_REGS, (uint32_t)MDIO_IPC_MAX_REGS);
+
+            frame.assign((uint8_t *)&req, (uint8_t *)&req + sizeof(req));
+
+            if (MDIO_IPC_IS_WRITE_OP(op))
+            {
+                const uint8_t *ptr = (const uint8_t *)(wdata + sent * MDIO_IPC_MAX_REGS);
+                frame.insert(frame.end(), ptr, ptr + req.count * sizeof(uint32_t));
+            }
+
+            if (syncd_mdio_ipc_send_all(frame.data(), frame.size()) < 0)
+            {
+                syncd_mdio_ipc_disconnect();
+                return -EIO;
+            }
+
+            ++sent;
+        }
+
+        mdio_ipc_resp_t resp;
+        uint8_t *ptr = (uint8_t *)&resp;
+
+        /* text server answers "<rc>\n" to the unknown command, check the first byte only */
+        if ((syncd_mdio_ipc_recv_all(ptr, 1) < 0) ||
+            ((ptr[0] == MDIO_IPC_MAGIC_BYTE) && (syncd_mdio_ipc_recv_all(ptr + 1, sizeof(resp) - 1) < 0)))
+        {
+            syncd_mdio_ipc_disconnect();
+            return -EIO;
+        }
+
+        if ((ptr[0] != MDIO_IPC_MAGIC_BYTE) || (resp.magic != MDIO_IPC_MAGIC))
+        {
+            SWSS_LOG_NOTICE("server does not support binary protocol, using text protocol");
+            syncd_mdio_ipc_disconnect();
+            return -EPROTONOSUPPORT;
+        }
+
+        uint32_t expected = std::min(count - done * MDIO_IPC_MAX_REGS, (uint32_t)MDIO_IPC_MAX_REGS);
+
+        if ((resp.seq != base + done) || (resp.count != (MDIO_IPC_IS_WRITE_OP(op) ? 0 : expected)))
+        {
+            SWSS_LOG_ERROR("unexpected response: seq %u, count %u", resp.seq, resp.count);
+            syncd_mdio_ipc_disconnect();
+            return -EIO;
+        }
+
+        if (resp.count && syncd_mdio_ipc_recv_all(rdata + done * MDIO_IPC_MAX_REGS, resp.count * sizeof(uint32_t)) < 0)
+        {
+            syncd_mdio_ipc_disconnect();
+            return -EIO;
+        }
+
+        /* keep draining the pipeline, report the first failure */
+        if ((resp.status != SAI_STATUS_SUCCESS) && (status == SAI_STATUS_SUCCESS))
+        {
+            status = resp.status;
+        }
+
+        ++done;
     }
 
-    ipcMutex.unlock();
-    return rc;
+    timeout = time(NULL) + MDIO_CLIENT_TIMEOUT;
+    return status;
 }
 
-/* Function to read data using clause 22 from MDIO interface */
-sai_status_t mdio_read_cl22(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
-        uint32_t number_of_registers, uint32_t *data)
+static sai_status_t syncd_mdio_ipc_access(uint32_t op, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t number_of_registers, uint32_t *rdata, const uint32_t *wdata)
 {
     // SWSS_LOG_ENTER(); // disabled
 
-    int rc = SAI_STATUS_FAILURE;
-    char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE];
+    int rc;
 
-    if (number_of_registers > 1)
+    if (number_of_registers == 0)
     {
-        SWSS_LOG_ERROR("Multiple register reads are not supported, num_of_registers: %d\n", number_of_registers);
-        return SAI_STATUS_FAILURE;
+        SWSS_LOG_ERROR("Invalid number_of_registers: %d\n", number_of_registers);
+        return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    ipcMutex.lock();
+    std::lock_guard<std::mutex> lock(ipcMutex);
 
-    sprintf(cmd, "mdio-cl22 0x%x 0x%x\n", mdio_addr, reg_addr);
-    rc = syncd_mdio_ipc_command(cmd, resp);
-    if (rc == 0)
+    if (!textOnly)
     {
-        *data = (uint32_t)strtoul(strchrnul(resp, ' ') + 1, NULL, 0);
-        rc = SAI_STATUS_SUCCESS;
-    }
-    else
-    {
-        SWSS_LOG_ERROR("syncd_mdio_ipc_command returns : %d\n", rc);
+        rc = syncd_mdio_ipc_binary(op, mdio_addr, reg_addr, number_of_registers, rdata, wdata);
+        if (rc != -EPROTONOSUPPORT)
+        {
+            if (rc != 0)
+            {
+                SWSS_LOG_ERROR("syncd_mdio_ipc_binary returns : %d\n", rc);
+            }
+            return rc;
+        }
+
+        textOnly = true;
     }
 
-    ipcMutex.unlock();
-    return rc;
+    return syncd_mdio_ipc_text(op, mdio_addr, reg_addr, number_of_registers, rdata, wdata);
 }
 
-/* Function to write data using clause 22 to MDIO interface */
-sai_status_t mdio_write_cl22(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
+/* Function to read data from MDIO interface */
+sai_status_t mdio_read(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t number_of_registers, uint32_t *data)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    return syncd_mdio_ipc_access(MDIO_IPC_OP_READ, mdio_addr, reg_addr, number_of_registers, data, NULL);
+}
+
+/* Function to write data to MDIO interface */
+sai_status_t mdio_write(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
         uint32_t number_of_registers, const uint32_t *data)
 {
     // SWSS_LOG_ENTER(); // disabled
 
-    int rc = SAI_STATUS_FAILURE;
-    char cmd[SYNCD_IPC_BUFF_SIZE], resp[SYNCD_IPC_BUFF_SIZE];
+    return syncd_mdio_ipc_access(MDIO_IPC_OP_WRITE, mdio_addr, reg_addr, number_of_registers, NULL, data);
+}
 
-    if (number_of_registers > 1)
-    {
-        SWSS_LOG_ERROR("Multiple register reads are not supported, num_of_registers: %d\n", number_of_registers);
-        return SAI_STATUS_FAILURE;
-    }
+/* Function to read data using clause 22 from MDIO interface */
+sai_status_t mdio_read_cl22(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t number_of_registers, uint32_t *data)
+{
+    // SWSS_LOG_ENTER(); // disabled
 
-    ipcMutex.lock();
+    return syncd_mdio_ipc_access(MDIO_IPC_OP_READ_CL22, mdio_addr, reg_addr, number_of_registers, data, NULL);
+}
 
-    sprintf(cmd, "mdio-cl22 0x%x 0x%x 0x%x\n", mdio_addr, reg_addr, *data);
-    rc = syncd_mdio_ipc_command(cmd, resp);
-    if (rc == 0)
-    {
-        rc = SAI_STATUS_SUCCESS;
-    }
-    else
-    {
-        SWSS_LOG_ERROR("syncd_mdio_ipc_command returns : %d\n", rc);
-    }
+/* Function to write data using clause 22 to MDIO interface */
+sai_status_t mdio_write_cl22(uint64_t platform_context, uint32_t mdio_addr, uint32_t reg_addr,
+        uint32_t number_of_registers, const uint32_t *data)
+{
+    // SWSS_LOG_ENTER(); // disabled
 
-    ipcMutex.unlock();
-    return rc;
+    return syncd_mdio_ipc_access(MDIO_IPC_OP_WRITE_CL22, mdio_addr, reg_addr, number_of_registers, NULL, data);
 }
@@ -1,3 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
 #define SYNCD_IPC_SOCK_SYNCD  "/var/run/sswsyncd"
 #define SYNCD_IPC_SOCK_HOST   "/var/run/docker-syncd"
 #define SYNCD_IPC_SOCK_FILE   "mdio-ipc"
@@ -7,3 +11,51 @@
 #define MDIO_CLIENT_TIMEOUT   25     /* shorter than 30 sec on server side */
 
 #define MDIO_CONN_MAX         18     /* max. number of connections */
+
+/*
+ * Binary framed protocol
+ *
+ * Each request is a mdio_ipc_req_t header, followed by "count" register
+ * values for write operations. Each response is a mdio_ipc_resp_t header,
+ * followed by "count" register values for read operations. Requests on
+ * one connection are served in order, so a client may send several frames
+ * before reading back the responses.
+ *
+ * Text commands always start with a printable character, while a binary
+ * frame always starts with MDIO_IPC_MAGIC_BYTE (first and last byte of the
+ * magic, regardless of the host byte order), which lets the server keep
+ * serving the legacy text protocol on the same socket.
+ */
+#define MDIO_IPC_MAGIC        0xA54D44A5
+#define MDIO_IPC_MAGIC_BYTE   0xA5
+
+#define MDIO_IPC_OP_READ        1
+#define MDIO_IPC_OP_WRITE       2
+#define MDIO_IPC_OP_READ_CL22   3
+#define MDIO_IPC_OP_WRITE_CL22  4
+
+#define MDIO_IPC_IS_WRITE_OP(op) (((op) == MDIO_IPC_OP_WRITE) || ((op) == MDIO_IPC_OP_WRITE_CL22))
+
+#define MDIO_IPC_MAX_REGS       256  /* max. number of registers per frame */
+#define MDIO_IPC_PIPELINE_DEPTH 4    /* max. number of frames in flight */
+
+typedef struct mdio_ipc_req_s
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t op;
+    uint32_t mdio_addr;
+    uint32_t reg_addr;
+    uint32_t count;
+} mdio_ipc_req_t;
+
+typedef struct mdio_ipc_resp_s
+{
+    uint32_t magic;
+    uint32_t seq;
+    int32_t  status;
+    uint32_t count;
+} mdio_ipc_resp_t;
+
+#define MDIO_IPC_FRAME_MAX    (sizeof(mdio_ipc_req_t) + MDIO_IPC_MAX_REGS * sizeof(uint32_t))
+#define MDIO_IPC_RX_BUFF_SIZE (MDIO_IPC_PIPELINE_DEPTH * MDIO_IPC_FRAME_MAX)
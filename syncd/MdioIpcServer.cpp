@@ -22,6 +22,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <vector>
+#include <algorithm>
 
 
 #ifndef COUNTOF
@@ -34,10 +35,34 @@ bool MdioIpcServer::m_syncdContext = true;
 
 typedef struct syncd_mdio_ipc_conn_s
 {
-    int    fd;
-    time_t timeout;
+    int     fd;
+    time_t  timeout;
+    size_t  len;                           /* pending binary request bytes */
+    uint8_t buf[MDIO_IPC_RX_BUFF_SIZE];
 } syncd_mdio_ipc_conn_t;
 
+static int syncd_ipc_send_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *ptr = (const uint8_t *)buf;
+
+    while (len > 0)
+    {
+        ssize_t ret = send(fd, ptr, len, 0);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -errno;
+        }
+        ptr += ret;
+        len -= (size_t)ret;
+    }
+
+    return 0;
+}
+
 MdioIpcServer::MdioIpcServer(
         _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
         _In_ int globalContext):
@@ -181,6 +206,118 @@ sai_status_t MdioIpcServer::syncd_ipc_cmd_mdio_common_cl22(char *resp, int argc,
 }
 #endif
 
+/*
+ * Binary request: "count" consecutive registers starting at reg_addr,
+ * data holds the values to write or receives the values read.
+ */
+sai_status_t MdioIpcServer::syncd_ipc_cmd_mdio_binary(const mdio_ipc_req_t *req, uint32_t *data)
+{
+    if (m_switchRid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("mdio switch id not initialized");
+        return SAI_STATUS_FAILURE;
+    }
+
+    switch (req->op)
+    {
+        case MDIO_IPC_OP_READ:
+            return m_vendorSai->switchMdioRead(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+
+        case MDIO_IPC_OP_WRITE:
+            return m_vendorSai->switchMdioWrite(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+
+#if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
+        case MDIO_IPC_OP_READ_CL22:
+            return m_vendorSai->switchMdioCl22Read(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+
+        case MDIO_IPC_OP_WRITE_CL22:
+            return m_vendorSai->switchMdioCl22Write(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+#else
+        /* In this case, sai configuration should take care of mdio clause 22 */
+        case MDIO_IPC_OP_READ_CL22:
+            return m_vendorSai->switchMdioRead(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+
+        case MDIO_IPC_OP_WRITE_CL22:
+            return m_vendorSai->switchMdioWrite(m_switchRid, req->mdio_addr, req->reg_addr, req->count, data);
+#endif
+
+        default:
+            return SAI_STATUS_NOT_SUPPORTED;
+    }
+}
+
+/*
+ * Serve all complete binary frames in buf, answer them with a single send
+ * and keep the trailing partial frame (if any) for the next recv.
+ *
+ * Returns negative value on protocol error, the connection should be closed.
+ */
+int MdioIpcServer::syncd_ipc_handle_binary(int sock, uint8_t *buf, size_t *len)
+{
+    size_t offset = 0;
+    std::vector<uint8_t> out;
+
+    while (*len - offset >= sizeof(mdio_ipc_req_t))
+    {
+        mdio_ipc_req_t req;
+        mdio_ipc_resp_t resp;
+
+        memcpy(&req, buf + offset, sizeof(req));
+
+        if ((req.magic != MDIO_IPC_MAGIC) || (req.count == 0) || (req.count > MDIO_IPC_MAX_REGS))
+        {
+            SWSS_LOG_ERROR("invalid frame: magic 0x%x, op %u, count %u", req.magic, req.op, req.count);
+            return -EPROTO;
+        }
+
+        size_t payload = req.count * sizeof(uint32_t);
+        size_t frame = sizeof(req) + (MDIO_IPC_IS_WRITE_OP(req.op) ? payload : 0);
+
+        if (*len - offset < frame)
+        {
+            break;
+        }
+
+        std::vector<uint32_t> data(req.count, 0);
+
+        if (MDIO_IPC_IS_WRITE_OP(req.op))
+        {
+            memcpy(data.data(), buf + offset + sizeof(req), payload);
+        }
+
+        resp.magic = MDIO_IPC_MAGIC;
+        resp.seq = req.seq;
+        resp.status = MdioIpcServer::syncd_ipc_cmd_mdio_binary(&req, data.data());
+        resp.count = MDIO_IPC_IS_WRITE_OP(req.op) ? 0 : req.count;
+
+        if (resp.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("op %u on 0x%x reg 0x%x count %u returns %d",
+                    req.op, req.mdio_addr, req.reg_addr, req.count, resp.status);
+        }
+
+        out.insert(out.end(), (uint8_t *)&resp, (uint8_t *)&resp + sizeof(resp));
+
+        if (resp.count)
+        {
+            out.insert(out.end(), (uint8_t *)data.data(), (uint8_t *)data.data() + payload);
+        }
+
+        offset += frame;
+    }
+
+    memmove(buf, buf + offset, *len - offset);
+    *len -= offset;
+
+    if (out.size() && syncd_ipc_send_all(sock, out.data(), out.size()) < 0)
+    {
+        SWSS_LOG_ERROR("send() returns %d", errno);
+        return -EIO;
+    }
+
+    return 0;
+}
+
 sai_status_t MdioIpcServer::syncd_ipc_cmd_mdio(char *resp, int argc, char *argv[])
 {
     return syncd_ipc_cmd_mdio_common(resp, argc, argv);
@@ -275,6 +412,7 @@ int MdioIpcServer::syncd_ipc_task_main()
                 close(conn[i].fd);
                 conn[i].fd = 0;
                 conn[i].timeout = 0;
+                conn[i].len = 0;
             }
         }
 
@@ -338,6 +476,7 @@ int MdioIpcServer::syncd_ipc_task_main()
             {
                 conn[i].fd = sock_cli;
                 conn[i].timeout = now + MDIO_SERVER_TIMEOUT;
+                conn[i].len = 0;
             }
             else
             {
@@ -358,14 +497,36 @@ int MdioIpcServer::syncd_ipc_task_main()
             }
 
             /* get the command message */
-            len = (int)recv(sock_cli, (void *)cmd, sizeof(cmd) - 1, 0);
+            len = (int)recv(sock_cli, (void *)(conn[i].buf + conn[i].len), sizeof(conn[i].buf) - conn[i].len, 0);
             if (len <= 0)
             {
                 close(sock_cli);
                 conn[i].fd = 0;
                 conn[i].timeout = 0;
+                conn[i].len = 0;
                 continue;
             }
+
+            /* binary framed requests */
+            if ((conn[i].len > 0) || (conn[i].buf[0] == MDIO_IPC_MAGIC_BYTE))
+            {
+                conn[i].len += len;
+                if (MdioIpcServer::syncd_ipc_handle_binary(sock_cli, conn[i].buf, &conn[i].len) < 0)
+                {
+                    close(sock_cli);
+                    conn[i].fd = 0;
+                    conn[i].timeout = 0;
+                    conn[i].len = 0;
+                    continue;
+                }
+
+                conn[i].timeout = time(NULL) + MDIO_SERVER_TIMEOUT;
+                continue;
+            }
+
+            /* legacy text command */
+            len = std::min(len, (int)sizeof(cmd) - 1);
+            memcpy(cmd, conn[i].buf, len);
             cmd[len] = 0;
 
             /* tokenize the command string */
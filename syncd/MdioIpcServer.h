@@ -2,6 +2,7 @@
 
 #include <thread>
 #include "VendorSai.h"
+#include "MdioIpcCommon.h"
 
 extern "C" {
 #include <sai.h>
@@ -49,6 +50,10 @@ namespace syncd
 
             sai_status_t syncd_ipc_cmd_mdio_cl22(char *resp, int argc, char *argv[]);
 
+            sai_status_t syncd_ipc_cmd_mdio_binary(const mdio_ipc_req_t *req, uint32_t *data);
+
+            int syncd_ipc_handle_binary(int sock, uint8_t *buf, size_t *len);
+
             static bool m_syncdContext;
 
             bool m_accessUseNPU;
@@ -19,6 +19,49 @@ using namespace syncd;
 #define HIDDEN                      "HIDDEN"
 #define COLDVIDS                    "COLDVIDS"
 
+// limits number of arguments of single script call, all calls are executed in
+// single MULTI/EXEC transaction
+#define REPLACE_ASIC_VIEW_CHUNK_ARGS    4096
+
+#define REPLACE_ASIC_VIEW_SCAN_COUNT    1000
+
+/*
+ * Script arguments are list of operations:
+ *
+ * D <key>                      - remove key
+ * H <key> <count> [<f> <v>]*   - replace hash with count field/value pairs
+ * S <key> <f> <v>              - set hash field
+ * R <key> <f>                  - remove hash field
+ */
+static const char* REPLACE_ASIC_VIEW_LUA_SCRIPT = R"(
+local i = 1
+local n = #ARGV
+while i <= n do
+    local op = ARGV[i]
+    if op == 'D' then
+        redis.call('DEL', ARGV[i + 1])
+        i = i + 2
+    elseif op == 'H' then
+        local key = ARGV[i + 1]
+        local count = tonumber(ARGV[i + 2])
+        redis.call('DEL', key)
+        for j = 0, count - 1 do
+            redis.call('HSET', key, ARGV[i + 3 + 2 * j], ARGV[i + 4 + 2 * j])
+        end
+        i = i + 3 + 2 * count
+    elseif op == 'S' then
+        redis.call('HSET', ARGV[i + 1], ARGV[i + 2], ARGV[i + 3])
+        i = i + 4
+    elseif op == 'R' then
+        redis.call('HDEL', ARGV[i + 1], ARGV[i + 2])
+        i = i + 3
+    else
+        return redis.error_reply('unknown operation ' .. op)
+    end
+end
+return n
+)";
+
 RedisClient::RedisClient(
         _In_ std::shared_ptr<swss::DBConnector> dbAsic):
     m_dbAsic(dbAsic)
@@ -28,6 +71,8 @@ RedisClient::RedisClient(
     std::string fdbFlushLuaScript = swss::loadLuaScript("fdb_flush.lua"); // TODO script must be updated to version 2
 
     m_fdbFlushSha = swss::loadRedisScript(dbAsic.get(), fdbFlushLuaScript);
+
+    m_replaceAsicViewSha = swss::loadRedisScript(dbAsic.get(), REPLACE_ASIC_VIEW_LUA_SCRIPT);
 }
 
 RedisClient::~RedisClient()
@@ -789,6 +834,261 @@ void RedisClient::removeTempAsicStateTable()
     }
 }
 
+void RedisClient::replaceAsicView(
+        _In_ const std::map<sai_object_id_t, swss::TableDump>& currentView,
+        _In_ const std::map<std::string, std::vector<swss::FieldValueTuple>>& newView,
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& vidToRidMap)
+{
+    SWSS_LOG_ENTER();
+
+    std::unordered_map<std::string, const swss::TableMap*> current;
+
+    for (const auto& sv: currentView)
+    {
+        for (const auto& kvp: sv.second)
+        {
+            current[kvp.first] = &kvp.second;
+        }
+    }
+
+    /*
+     * All reads are done first, since commands sent after MULTI are only
+     * queued. Script calls are then executed in single transaction, so
+     * readers never see mix of old and new view.
+     */
+
+    std::vector<std::vector<std::string>> chunks;
+
+    std::vector<std::string> ops;
+
+    size_t changed = 0;
+
+    for (const auto& kvp: newView)
+    {
+        std::vector<swss::FieldValueTuple> entry = kvp.second;
+
+        if (entry.empty())
+        {
+            entry.emplace_back("NULL", "NULL");
+        }
+
+        auto it = current.find(kvp.first);
+
+        if (it != current.end())
+        {
+            const auto& map = *it->second;
+
+            bool equal = map.size() == entry.size();
+
+            for (size_t idx = 0; equal && idx < entry.size(); idx++)
+            {
+                auto fit = map.find(fvField(entry[idx]));
+
+                equal = (fit != map.end() && fit->second == fvValue(entry[idx]));
+            }
+
+            current.erase(it);
+
+            if (equal)
+            {
+                continue;
+            }
+        }
+
+        changed++;
+
+        ops.push_back("H");
+        ops.push_back((ASIC_STATE_TABLE ":") + kvp.first);
+        ops.push_back(std::to_string(entry.size()));
+
+        for (const auto& fv: entry)
+        {
+            ops.push_back(fvField(fv));
+            ops.push_back(fvValue(fv));
+        }
+
+        addReplaceAsicViewChunk(chunks, ops, false);
+    }
+
+    // objects left in current view don't exist in new view
+
+    for (const auto& kvp: current)
+    {
+        ops.push_back("D");
+        ops.push_back((ASIC_STATE_TABLE ":") + kvp.first);
+
+        addReplaceAsicViewChunk(chunks, ops, false);
+    }
+
+    // KEYS would block redis for whole temporary view
+
+    size_t tempKeys = 0;
+
+    int cursor = 0;
+
+    do
+    {
+        auto reply = m_dbAsic->scan(cursor, TEMP_PREFIX ASIC_STATE_TABLE ":*", REPLACE_ASIC_VIEW_SCAN_COUNT);
+
+        cursor = reply.first;
+
+        for (const auto& key: reply.second)
+        {
+            ops.push_back("D");
+            ops.push_back(key);
+
+            tempKeys++;
+        }
+
+        addReplaceAsicViewChunk(chunks, ops, false);
+    }
+    while (cursor != 0);
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> ridToVidMap;
+
+    for (const auto& kv: vidToRidMap)
+    {
+        ridToVidMap[kv.second] = kv.first;
+    }
+
+    size_t mapChanges = addObjectMapDiff(chunks, ops, VIDTORID, vidToRidMap);
+
+    mapChanges += addObjectMapDiff(chunks, ops, RIDTOVID, ridToVidMap);
+
+    addReplaceAsicViewChunk(chunks, ops, true);
+
+    executeReplaceAsicView(chunks);
+
+    SWSS_LOG_NOTICE("replaced asic view in %zu script calls: %zu objects changed, %zu removed, %zu temporary keys removed, %zu vid/rid map changes",
+            chunks.size(),
+            changed,
+            current.size(),
+            tempKeys,
+            mapChanges);
+}
+
+size_t RedisClient::addObjectMapDiff(
+        _Inout_ std::vector<std::vector<std::string>>& chunks,
+        _Inout_ std::vector<std::string>& ops,
+        _In_ const std::string& key,
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map)
+{
+    SWSS_LOG_ENTER();
+
+    auto current = getObjectMap(key);
+
+    size_t changes = 0;
+
+    for (const auto& kv: current)
+    {
+        if (map.find(kv.first) == map.end())
+        {
+            ops.push_back("R");
+            ops.push_back(key);
+            ops.push_back(sai_serialize_object_id(kv.first));
+
+            changes++;
+
+            addReplaceAsicViewChunk(chunks, ops, false);
+        }
+    }
+
+    for (const auto& kv: map)
+    {
+        auto it = current.find(kv.first);
+
+        if (it != current.end() && it->second == kv.second)
+        {
+            continue;
+        }
+
+        ops.push_back("S");
+        ops.push_back(key);
+        ops.push_back(sai_serialize_object_id(kv.first));
+        ops.push_back(sai_serialize_object_id(kv.second));
+
+        changes++;
+
+        addReplaceAsicViewChunk(chunks, ops, false);
+    }
+
+    return changes;
+}
+
+void RedisClient::addReplaceAsicViewChunk(
+        _Inout_ std::vector<std::vector<std::string>>& chunks,
+        _Inout_ std::vector<std::string>& ops,
+        _In_ bool force)
+{
+    SWSS_LOG_ENTER();
+
+    if (ops.empty() || (!force && ops.size() < REPLACE_ASIC_VIEW_CHUNK_ARGS))
+    {
+        return;
+    }
+
+    chunks.push_back(std::move(ops));
+
+    ops.clear();
+}
+
+void RedisClient::executeReplaceAsicView(
+        _In_ const std::vector<std::vector<std::string>>& chunks)
+{
+    SWSS_LOG_ENTER();
+
+    if (chunks.empty())
+    {
+        return;
+    }
+
+    swss::RedisReply multi(m_dbAsic.get(), "MULTI", REDIS_REPLY_STATUS);
+
+    try
+    {
+        for (const auto& chunk: chunks)
+        {
+            std::vector<std::string> args;
+
+            args.reserve(chunk.size() + 3);
+
+            args.push_back("EVALSHA");
+            args.push_back(m_replaceAsicViewSha);
+            args.push_back("0");
+
+            args.insert(args.end(), chunk.begin(), chunk.end());
+
+            swss::RedisCommand command;
+
+            command.format(args);
+
+            // script is only queued here
+
+            swss::RedisReply r(m_dbAsic.get(), command, REDIS_REPLY_STATUS);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to queue replace asic view script: %s, discarding", e.what());
+
+        swss::RedisReply discard(m_dbAsic.get(), "DISCARD", REDIS_REPLY_STATUS);
+
+        throw;
+    }
+
+    swss::RedisReply exec(m_dbAsic.get(), "EXEC", REDIS_REPLY_ARRAY);
+
+    auto reply = exec.getContext();
+
+    for (size_t idx = 0; idx < reply->elements; idx++)
+    {
+        if (reply->element[idx]->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_THROW("replace asic view script call %zu failed: %s", idx, reply->element[idx]->str);
+        }
+    }
+}
+
 std::map<sai_object_id_t, swss::TableDump> RedisClient::getAsicView()
 {
     SWSS_LOG_ENTER();
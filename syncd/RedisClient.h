@@ -11,6 +11,7 @@ extern "C" {
 #include <set>
 #include <memory>
 #include <vector>
+#include <map>
 
 namespace syncd
 {
@@ -138,6 +139,24 @@ namespace syncd
 
             void removeTempAsicStateTable();
 
+            /**
+             * @brief Replace ASIC view with new view using server side script.
+             *
+             * Only objects which differ from current view are written, all
+             * temporary view objects are removed, and only changed VID/RID
+             * map entries are written. Operations are split into script
+             * calls of limited size, and all calls are executed in single
+             * MULTI/EXEC transaction, so view is replaced atomically.
+             *
+             * @param currentView Current view, as read by getAsicView.
+             * @param newView New view objects, keyed by serialized meta key.
+             * @param vidToRidMap New VID to RID map for all switches.
+             */
+            void replaceAsicView(
+                    _In_ const std::map<sai_object_id_t, swss::TableDump>& currentView,
+                    _In_ const std::map<std::string, std::vector<swss::FieldValueTuple>>& newView,
+                    _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& vidToRidMap);
+
             std::map<sai_object_id_t, swss::TableDump> getAsicView();
 
             std::map<sai_object_id_t, swss::TableDump> getTempAsicView();
@@ -175,11 +194,38 @@ namespace syncd
             std::unordered_map<sai_object_id_t, sai_object_id_t> getObjectMap(
                     _In_ const std::string& key) const;
 
+            /**
+             * @brief Add script operations which turn object map in redis into given map.
+             *
+             * @return Number of changed map entries.
+             */
+            size_t addObjectMapDiff(
+                    _Inout_ std::vector<std::vector<std::string>>& chunks,
+                    _Inout_ std::vector<std::string>& ops,
+                    _In_ const std::string& key,
+                    _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map);
+
+            /**
+             * @brief Move queued script operations to chunks when chunk is full or when forced.
+             */
+            void addReplaceAsicViewChunk(
+                    _Inout_ std::vector<std::vector<std::string>>& chunks,
+                    _Inout_ std::vector<std::string>& ops,
+                    _In_ bool force);
+
+            /**
+             * @brief Execute all script calls in single transaction.
+             */
+            void executeReplaceAsicView(
+                    _In_ const std::vector<std::vector<std::string>>& chunks);
+
         private:
 
             std::shared_ptr<swss::DBConnector> m_dbAsic;
 
             std::string m_fdbFlushSha;
 
+            std::string m_replaceAsicViewSha;
+
     };
 }
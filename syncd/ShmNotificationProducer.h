@@ -0,0 +1,32 @@
+#pragma once
+
+#include "NotificationProducerBase.h"
+
+#include "meta/ShmSelectableChannel.h"
+
+#include <memory>
+
+namespace syncd
+{
+    class ShmNotificationProducer:
+        public NotificationProducerBase
+    {
+        public:
+
+            ShmNotificationProducer(
+                    _In_ std::shared_ptr<sairedis::ShmSelectableChannel> channel);
+
+            virtual ~ShmNotificationProducer() = default;
+
+        public:
+
+            virtual void send(
+                    _In_ const std::string& op,
+                    _In_ const std::string& data,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) override;
+
+        private:
+
+            std::shared_ptr<sairedis::ShmSelectableChannel> m_channel;
+    };
+}
@@ -11,7 +11,10 @@
 #include "BreakConfigParser.h"
 #include "RedisNotificationProducer.h"
 #include "ZeroMQNotificationProducer.h"
+#include "ShmNotificationProducer.h"
 #include "WatchdogScope.h"
+#include "LatencyScope.h"
+#include "LatencyStageTimer.h"
 #include "VendorSaiOptions.h"
 
 #include "sairediscommon.h"
@@ -24,8 +27,8 @@
 
 #include "meta/sai_serialize.h"
 #include "meta/ZeroMQSelectableChannel.h"
+#include "meta/ShmSelectableChannel.h"
 #include "meta/RedisSelectableChannel.h"
-#include "meta/PerformanceIntervalTimer.h"
 #include "meta/Globals.h"
 
 #include "vslib/saivs.h"
@@ -37,10 +40,36 @@
 
 #include <iterator>
 #include <algorithm>
+#include <future>
+#include <chrono>
+#include <cstdlib>
 
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 #define SAI_FAILURE_DUMP_SCRIPT "/usr/bin/sai_failure_dump.sh"
 
+/*
+ * Smaller bulks are deserialized on calling thread, since waking up workers
+ * costs more than deserializing few objects.
+ */
+#define BULK_PARALLEL_DESERIALIZE_MIN_OBJECTS 64
+
+/*
+ * Maximum number of responses sent in single batch.
+ */
+#define RESPONSE_BATCH_MAX_SIZE 128
+
+/*
+ * Maximum time first queued response can wait in batch before processing of
+ * next request.
+ */
+#define RESPONSE_BATCH_MAX_DELAY_MS 10
+
+/*
+ * Bulk requests with at least that many objects are considered long running,
+ * and queued responses are sent before processing them.
+ */
+#define RESPONSE_BATCH_LONG_BULK_MIN_OBJECTS 64
+
 using namespace syncd;
 using namespace saimeta;
 using namespace sairediscommon;
@@ -63,6 +92,9 @@ Syncd::Syncd(
     m_vendorSai(vendorSai),
     m_veryFirstRun(false),
     m_enableSyncMode(false),
+    m_enableResponseBatch(false),
+    m_responseBatchActive(false),
+    m_responseSequence(0),
     m_timerWatchdog(cmd->m_watchdogWarnTimeSpan * WD_DELAY_FACTOR)
 {
     SWSS_LOG_ENTER();
@@ -91,6 +123,15 @@ Syncd::Syncd(
         m_commandLineOptions->m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC;
     }
 
+    if (m_contextConfig->m_shmEnable && m_commandLineOptions->m_enableSyncMode)
+    {
+        SWSS_LOG_NOTICE("disabling command line sync mode, since context shm enabled");
+
+        m_commandLineOptions->m_enableSyncMode = false;
+
+        m_commandLineOptions->m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC;
+    }
+
     if (m_commandLineOptions->m_enableSyncMode)
     {
         SWSS_LOG_WARN("enable sync mode is deprecated, please use communication mode, FORCING redis sync mode");
@@ -99,6 +140,8 @@ Syncd::Syncd(
 
         m_contextConfig->m_zmqEnable = false;
 
+        m_contextConfig->m_shmEnable = false;
+
         m_commandLineOptions->m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
     }
 
@@ -111,14 +154,36 @@ Syncd::Syncd(
         m_enableSyncMode = true;
     }
 
+    if (m_commandLineOptions->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
+    {
+        SWSS_LOG_NOTICE("shm sync mode enabled via cmd line");
+
+        m_contextConfig->m_shmEnable = true;
+
+        m_enableSyncMode = true;
+    }
+
     auto vso = std::make_shared<VendorSaiOptions>();
 
     vso->m_checkAttrVersion = m_commandLineOptions->m_enableAttrVersionCheck;
 
+    vso->m_lockPolicy = m_commandLineOptions->m_vendorSaiLockPolicy;
+
     m_vendorSai->setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
 
     m_manager = std::make_shared<FlexCounterManager>(m_vendorSai, m_contextConfig->m_dbCounters, m_commandLineOptions->m_supportingBulkCounterGroups);
 
+    m_latencyRecorder = std::make_shared<LatencyRecorder>(m_contextConfig->m_dbCounters, m_commandLineOptions->m_latencyStatsInterval);
+
+    m_bulkChunkPolicy = BulkChunkPolicy::parse(m_commandLineOptions->m_bulkChunkSize);
+
+    if (m_commandLineOptions->m_bulkDeserializeThreads)
+    {
+        m_bulkWorkerPool = std::make_shared<WorkerPool>(m_commandLineOptions->m_bulkDeserializeThreads);
+    }
+
+    m_bulkPrefetchWorker = std::make_shared<WorkerPool>(1);
+
     loadProfileMap();
 
     m_profileIter = m_profileMap.begin();
@@ -128,7 +193,21 @@ Syncd::Syncd(
     m_dbAsic = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
     m_mdioIpcServer = std::make_shared<MdioIpcServer>(m_vendorSai, m_commandLineOptions->m_globalContext);
 
-    if (m_contextConfig->m_zmqEnable)
+    if (m_contextConfig->m_shmEnable)
+    {
+        auto channel = std::make_shared<sairedis::ShmSelectableChannel>(m_contextConfig->m_shmEndpoint);
+
+        // notifications are sent through the same shared memory segment
+
+        m_notifications = std::make_shared<ShmNotificationProducer>(channel);
+
+        SWSS_LOG_NOTICE("shm enabled, forcing sync mode");
+
+        m_enableSyncMode = true;
+
+        m_selectableChannel = channel;
+    }
+    else if (m_contextConfig->m_zmqEnable)
     {
         m_notifications = std::make_shared<ZeroMQNotificationProducer>(m_contextConfig->m_zmqNtfEndpoint);
 
@@ -154,6 +233,18 @@ Syncd::Syncd(
                 modifyRedis);
     }
 
+    if (m_commandLineOptions->m_enableResponseBatch)
+    {
+        if (m_selectableChannel->isResponseBatchSupported())
+        {
+            m_enableResponseBatch = true;
+        }
+        else
+        {
+            SWSS_LOG_WARN("response batch is not supported by selected communication mode, disabling");
+        }
+    }
+
     m_client = std::make_shared<RedisClient>(m_dbAsic);
 
     m_processor = std::make_shared<NotificationProcessor>(m_notifications, m_client, std::bind(&Syncd::syncProcessNotification, this, _1));
@@ -332,6 +423,33 @@ void Syncd::processEvent(
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    // responses of all requests processed in this pass are sent together
+
+    m_responseBatchActive = m_enableResponseBatch;
+
+    try
+    {
+        processQueuedEvents(consumer);
+    }
+    catch (...)
+    {
+        flushResponses();
+
+        m_responseBatchActive = false;
+
+        throw;
+    }
+
+    flushResponses();
+
+    m_responseBatchActive = false;
+}
+
+void Syncd::processQueuedEvents(
+        _In_ sairedis::SelectableChannel& consumer)
+{
+    SWSS_LOG_ENTER();
+
     do
     {
         swss::KeyOpFieldsValuesTuple kco;
@@ -342,13 +460,72 @@ void Syncd::processEvent(
          * data to redis db.
          */
 
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_POP);
+
         consumer.pop(kco, isInitViewMode());
 
+        timer.stop();
+
+        if (m_responseBatchActive && (isLongRunningOperation(kco) || isResponseBatchExpired()))
+        {
+            // don't hold already prepared responses while processing request
+
+            flushResponses();
+        }
+
         processSingleEvent(kco);
     }
     while (!consumer.empty());
 }
 
+bool Syncd::isLongRunningOperation(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& op = kfvOp(kco);
+
+    // notify syncd covers init/apply view and inspect asic
+
+    if (op == REDIS_ASIC_STATE_COMMAND_NOTIFY || op == REDIS_ASIC_STATE_COMMAND_FLUSH)
+    {
+        return true;
+    }
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_CREATE ||
+            op == REDIS_ASIC_STATE_COMMAND_BULK_REMOVE ||
+            op == REDIS_ASIC_STATE_COMMAND_BULK_SET ||
+            op == REDIS_ASIC_STATE_COMMAND_BULK_GET)
+    {
+        auto& key = kfvKey(kco); // objectType:count
+
+        auto pos = key.find(':');
+
+        if (pos == std::string::npos)
+        {
+            return false;
+        }
+
+        return std::strtoul(key.c_str() + pos + 1, nullptr, 10) >= RESPONSE_BATCH_LONG_BULK_MIN_OBJECTS;
+    }
+
+    return false;
+}
+
+bool Syncd::isResponseBatchExpired() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_responseBatch.empty())
+    {
+        return false;
+    }
+
+    auto delay = std::chrono::steady_clock::now() - m_responseBatchStart;
+
+    return delay >= std::chrono::milliseconds(RESPONSE_BATCH_MAX_DELAY_MS);
+}
+
 sai_status_t Syncd::processSingleEvent(
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
@@ -368,6 +545,19 @@ sai_status_t Syncd::processSingleEvent(
 
     WatchdogScope ws(m_timerWatchdog, op + ":" + key, &kco);
 
+    LatencyScope ls(*m_latencyRecorder, op);
+
+    return ls.setStatus(dispatchSingleEvent(kco));
+}
+
+sai_status_t Syncd::dispatchSingleEvent(
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    auto& key = kfvKey(kco);
+    auto& op = kfvOp(kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_CREATE)
         return processQuadEvent(SAI_COMMON_API_CREATE, kco);
 
@@ -449,7 +639,7 @@ sai_status_t Syncd::processAttrCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -479,7 +669,7 @@ sai_status_t Syncd::processAttrCapabilityQuery(
             capability.create_implemented, capability.set_implemented, capability.get_implemented);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -502,7 +692,7 @@ sai_status_t Syncd::processAttrEnumValuesCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 3 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -555,7 +745,7 @@ sai_status_t Syncd::processAttrEnumValuesCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %u", enumCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -608,7 +798,7 @@ sai_status_t Syncd::processObjectTypeGetAvailabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %lu", count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_OBJECT_TYPE_GET_AVAILABILITY_RESPONSE);
 
     return status;
 }
@@ -631,7 +821,7 @@ sai_status_t Syncd::processStatsCapabilityQuery(
     {
         SWSS_LOG_ERROR("Invalid input: expected 2 arguments, received %zu", values.size());
 
-        m_selectableChannel->set(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+        sendResponse(sai_serialize_status(SAI_STATUS_INVALID_PARAMETER), {}, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
         return SAI_STATUS_INVALID_PARAMETER;
     }
@@ -688,7 +878,7 @@ sai_status_t Syncd::processStatsCapabilityQuery(
         SWSS_LOG_DEBUG("Sending response: count = %u", statCapList.count);
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_STATS_CAPABILITY_RESPONSE);
 
     return status;
 }
@@ -728,7 +918,7 @@ sai_status_t Syncd::processFdbFlush(
 
     sai_status_t status = m_vendorSai->flushFdbEntries(switchRid, attr_count, attr_list);
 
-    m_selectableChannel->set(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
+    sendResponse(sai_serialize_status(status), {} , REDIS_ASIC_STATE_COMMAND_FLUSHRESPONSE);
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -794,7 +984,7 @@ sai_status_t Syncd::processClearStatsEvent(
 
         sai_status_t status = SAI_STATUS_INVALID_OBJECT_ID;
 
-        m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        sendResponse(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
         return status;
     }
@@ -803,7 +993,7 @@ sai_status_t Syncd::processClearStatsEvent(
     {
         SWSS_LOG_WARN("VID to RID translation failure: %s", key.c_str());
         sai_status_t status = SAI_STATUS_INVALID_OBJECT_ID;
-        m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        sendResponse(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
         return status;
     }
 
@@ -830,7 +1020,7 @@ sai_status_t Syncd::processClearStatsEvent(
             (uint32_t)counter_ids.size(),
             counter_ids.data());
 
-    m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
@@ -845,13 +1035,15 @@ sai_status_t Syncd::processGetStatsEvent(
     sai_object_meta_key_t metaKey;
     sai_deserialize_object_meta_key(key, metaKey);
 
+    m_latencyRecorder->setObjectType(metaKey.objecttype);
+
     if (isInitViewMode() && m_createdInInitView.find(metaKey.objectkey.key.object_id) != m_createdInInitView.end())
     {
         SWSS_LOG_WARN("GET STATS api can't be used on %s since it's created in INIT_VIEW mode", key.c_str());
 
         sai_status_t status = SAI_STATUS_INVALID_OBJECT_ID;
 
-        m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+        sendResponse(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
         return status;
     }
@@ -877,6 +1069,8 @@ sai_status_t Syncd::processGetStatsEvent(
 
     std::vector<uint64_t> result(counter_ids.size());
 
+    LatencyStageTimer vendorTimer(*m_latencyRecorder, LatencyRecorder::STAGE_VENDOR);
+
     auto status = m_vendorSai->getStats(
             metaKey.objecttype,
             metaKey.objectkey.key.object_id,
@@ -884,6 +1078,10 @@ sai_status_t Syncd::processGetStatsEvent(
             counter_ids.data(),
             result.data());
 
+    vendorTimer.stop();
+
+    LatencyStageTimer responseTimer(*m_latencyRecorder, LatencyRecorder::STAGE_RESPONSE);
+
     std::vector<swss::FieldValueTuple> entry;
 
     if (status != SAI_STATUS_SUCCESS)
@@ -900,7 +1098,7 @@ sai_status_t Syncd::processGetStatsEvent(
         }
     }
 
-    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     return status;
 }
@@ -911,6 +1109,8 @@ sai_status_t Syncd::processBulkQuadEvent(
 {
     SWSS_LOG_ENTER();
 
+    LatencyStageTimer deserializeTimer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
+
     const std::string& key = kfvKey(kco); // objectType:count
 
     std::string strObjectType = key.substr(0, key.find(":"));
@@ -918,90 +1118,136 @@ sai_status_t Syncd::processBulkQuadEvent(
     sai_object_type_t objectType;
     sai_deserialize_object_type(strObjectType, objectType);
 
-    const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
+    m_latencyRecorder->setObjectType(objectType);
 
     std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
 
-    // field = objectId
-    // value = attrid=attrvalue|...
-
     std::vector<std::string> objectIds;
 
-    std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+    Globals::parseBulk(key, kfvFieldsValues(kco), objectIds, strAttributes);
 
-    for (const auto &fvt: values)
-    {
-        std::string strObjectId = fvField(fvt);
-        std::string joined = fvValue(fvt);
+    // attribute lists are deserialized per chunk during bulk execution
+
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes(objectIds.size());
 
-        // decode values
+    // all attribute lists of this request are allocated from arenas (one
+    // per deserialize worker), released when last list is destroyed
 
-        auto v = swss::tokenize(joined, '|');
+    size_t fieldCount = 0;
 
-        objectIds.push_back(strObjectId);
+    for (auto& fvs: strAttributes)
+    {
+        fieldCount += fvs.size();
+    }
 
-        std::vector<swss::FieldValueTuple> entries; // attributes per object id
+    m_bulkArenas = createBulkArenas(objectType, objectIds.size(), fieldCount);
 
-        for (size_t i = 0; i < v.size(); ++i)
-        {
-            const std::string item = v.at(i);
+    auto arenas = m_bulkArenas;
 
-            auto start = item.find_first_of("=");
+    deserializeTimer.stop();
 
-            auto field = item.substr(0, start);
-            auto value = item.substr(start + 1);
+    SWSS_LOG_INFO("bulk %s executing with %zu items",
+            strObjectType.c_str(),
+            objectIds.size());
 
-            entries.emplace_back(field, value);
-        }
+    if (isInitViewMode())
+    {
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
 
-        strAttributes.push_back(entries);
+        loadBulkAttributes(objectType, false, strAttributes, attributes, 0, attributes.size());
 
-        // since now we converted this to proper list, we can extract attributes
+        timer.stop();
 
-        auto list = std::make_shared<SaiAttributeList>(objectType, entries, false);
+        m_bulkArenas.clear();
 
-        attributes.push_back(list);
+        return processBulkQuadEventInInitViewMode(objectType, objectIds, api, attributes, strAttributes);
     }
 
-    SWSS_LOG_INFO("bulk %s executing with %zu items",
-            strObjectType.c_str(),
-            objectIds.size());
+    auto info = sai_metadata_get_object_type_info(objectType);
 
-    if (isInitViewMode())
+    // response is sent and attributes are deserialized from inside bulk
+    // processing, so they are excluded from vendor stage time
+
+    uint64_t start = m_latencyRecorder->isEnabled() ? LatencyRecorder::now() : 0;
+    uint64_t response = m_latencyRecorder->getStageTime(LatencyRecorder::STAGE_RESPONSE);
+    uint64_t deserialize = m_latencyRecorder->getStageTime(LatencyRecorder::STAGE_DESERIALIZE);
+
+    sai_status_t status;
+
+    if (info->isobjectid)
     {
-        return processBulkQuadEventInInitViewMode(objectType, objectIds, api, attributes, strAttributes);
+        status = processBulkOid(objectType, objectIds, api, attributes, strAttributes);
+    }
+    else
+    {
+        status = processBulkEntry(objectType, objectIds, api, attributes, strAttributes);
     }
 
-    if (api != SAI_COMMON_API_BULK_GET)
+    if (m_latencyRecorder->isEnabled())
     {
-        // translate attributes for all objects
+        response = m_latencyRecorder->getStageTime(LatencyRecorder::STAGE_RESPONSE) - response;
+        deserialize = m_latencyRecorder->getStageTime(LatencyRecorder::STAGE_DESERIALIZE) - deserialize;
 
-        for (auto &list: attributes)
-        {
-            sai_attribute_t *attr_list = list->get_attr_list();
-            uint32_t attr_count = list->get_attr_count();
+        m_latencyRecorder->addStageTime(LatencyRecorder::STAGE_VENDOR, LatencyRecorder::now() - start - response - deserialize);
+    }
+
+    m_bulkArenas.clear();
 
-            m_translator->translateVidToRid(objectType, attr_count, attr_list);
+    if (objectIds.size())
+    {
+        // learn values size per object, attribute arrays are excluded since
+        // they are reserved from field count
+
+        size_t used = 0;
+
+        for (auto& arena: arenas)
+        {
+            used += arena->getUsedSize();
         }
+
+        used -= std::min(used, fieldCount * sizeof(sai_attribute_t));
+
+        m_bulkArenaObjectSizes[objectType] = used / objectIds.size();
     }
 
-    auto info = sai_metadata_get_object_type_info(objectType);
+    return status;
+}
 
-    if (info->isobjectid)
+std::vector<std::shared_ptr<SaiAttributeArena>> Syncd::createBulkArenas(
+        _In_ sai_object_type_t objectType,
+        _In_ size_t objectCount,
+        _In_ size_t fieldCount)
+{
+    SWSS_LOG_ENTER();
+
+    size_t reserve = fieldCount * sizeof(sai_attribute_t);
+
+    auto it = m_bulkArenaObjectSizes.find(objectType);
+
+    if (it != m_bulkArenaObjectSizes.end())
     {
-        return processBulkOid(objectType, objectIds, api, attributes, strAttributes);
+        reserve += it->second * objectCount;
     }
-    else
+
+    // each worker deserializes equal part of objects
+
+    size_t count = m_bulkWorkerPool ? m_bulkWorkerPool->getWorkerCount() : 1;
+
+    std::vector<std::shared_ptr<SaiAttributeArena>> arenas;
+
+    for (size_t i = 0; i < count; i++)
     {
-        return processBulkEntry(objectType, objectIds, api, attributes, strAttributes);
+        arenas.push_back(std::make_shared<SaiAttributeArena>(reserve / count));
     }
+
+    return arenas;
 }
 
 sai_status_t Syncd::processBulkQuadEventInInitViewMode(
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& objectIds,
         _In_ sai_common_api_t api,
-        _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+        _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
         _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
 {
     SWSS_LOG_ENTER();
@@ -1170,10 +1416,6 @@ sai_status_t Syncd::processBulkCreateEntry(
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
             }
 
-            static PerformanceIntervalTimer timer("Syncd::processBulkCreateEntry(route_entry) CREATE");
-
-            timer.start();
-
             status = m_vendorSai->bulkCreate(
                     object_count,
                     entries.data(),
@@ -1181,10 +1423,6 @@ sai_status_t Syncd::processBulkCreateEntry(
                     attr_lists.data(),
                     mode,
                     statuses.data());
-
-            timer.stop();
-
-            timer.inc(object_count);
         }
         break;
 
@@ -1901,7 +2139,7 @@ sai_status_t Syncd::processBulkEntry(
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& objectIds,
         _In_ sai_common_api_t api,
-        _In_ const std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _Inout_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
         _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
 {
     SWSS_LOG_ENTER();
@@ -1917,28 +2155,13 @@ sai_status_t Syncd::processBulkEntry(
 
     sai_status_t all = SAI_STATUS_SUCCESS;
 
-    if (m_commandLineOptions->m_enableSaiBulkSupport)
-    {
-        switch (api)
-        {
-            case SAI_COMMON_API_BULK_CREATE:
-                all = processBulkCreateEntry(objectType, objectIds, attributes, statuses);
-                break;
-
-            case SAI_COMMON_API_BULK_REMOVE:
-                all = processBulkRemoveEntry(objectType, objectIds, statuses);
-                break;
-
-            case SAI_COMMON_API_BULK_SET:
-                all = processBulkSetEntry(objectType, objectIds, attributes, statuses);
-                break;
+    size_t executed = 0;
 
-            default:
-                SWSS_LOG_ERROR("api %s is not supported in bulk", sai_serialize_common_api(api).c_str());
-                all = SAI_STATUS_NOT_SUPPORTED;
-        }
+    if (m_commandLineOptions->m_enableSaiBulkSupport && m_bulkChunkPolicy->isBulkSupported(objectType, api))
+    {
+        all = processBulkChunks(objectType, objectIds, api, attributes, strAttributes, statuses, executed);
 
-        if (all != SAI_STATUS_NOT_SUPPORTED && all != SAI_STATUS_NOT_IMPLEMENTED)
+        if (executed == objectIds.size())
         {
             sendApiResponse(api, all, (uint32_t)objectIds.size(), statuses.data());
             syncUpdateRedisBulkQuadEvent(api, statuses, objectType, objectIds, strAttributes);
@@ -1947,11 +2170,15 @@ sai_status_t Syncd::processBulkEntry(
         }
     }
 
-    // vendor SAI don't bulk API yet, so execute one by one
+    // vendor SAI don't bulk API yet, so execute remaining objects one by one
 
-    all = SAI_STATUS_SUCCESS;
+    {
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
+
+        loadBulkAttributes(objectType, true, strAttributes, attributes, executed, objectIds.size());
+    }
 
-    for (size_t idx = 0; idx < objectIds.size(); ++idx)
+    for (size_t idx = executed; idx < objectIds.size(); ++idx)
     {
         sai_object_meta_key_t metaKey;
 
@@ -2020,22 +2247,7 @@ sai_status_t Syncd::processBulkEntry(
 
         if (api == SAI_COMMON_API_BULK_CREATE)
         {
-            if (objectType == SAI_OBJECT_TYPE_ROUTE_ENTRY)
-            {
-                static PerformanceIntervalTimer timer("Syncd::processBulkEntry::processEntry(route_entry) CREATE");
-
-                timer.start();
-
-                status = processEntry(metaKey, SAI_COMMON_API_CREATE, attr_count, attr_list);
-
-                timer.stop();
-
-                timer.inc();
-            }
-            else
-            {
-                status = processEntry(metaKey, SAI_COMMON_API_CREATE, attr_count, attr_list);
-            }
+            status = processEntry(metaKey, SAI_COMMON_API_CREATE, attr_count, attr_list);
         }
         else if (api == SAI_COMMON_API_BULK_REMOVE)
         {
@@ -2072,6 +2284,252 @@ sai_status_t Syncd::processBulkEntry(
     return all;
 }
 
+void Syncd::loadBulkAttributes(
+        _In_ sai_object_type_t objectType,
+        _In_ bool translate,
+        _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+        _Inout_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _In_ size_t begin,
+        _In_ size_t end)
+{
+    SWSS_LOG_ENTER();
+
+    auto load = [&](size_t idx, size_t worker)
+    {
+        if (attributes[idx])
+        {
+            return;
+        }
+
+        auto list = (worker < m_bulkArenas.size())
+            ? std::make_shared<SaiAttributeList>(objectType, strAttributes[idx], false, m_bulkArenas[worker])
+            : std::make_shared<SaiAttributeList>(objectType, strAttributes[idx], false);
+
+        if (translate)
+        {
+            m_translator->translateVidToRid(objectType, list->get_attr_count(), list->get_attr_list());
+        }
+
+        attributes[idx] = list;
+    };
+
+    if (!m_bulkWorkerPool || end - begin < BULK_PARALLEL_DESERIALIZE_MIN_OBJECTS)
+    {
+        for (size_t idx = begin; idx < end; idx++)
+        {
+            load(idx, 0);
+        }
+
+        return;
+    }
+
+    // each object is written to its own attributes slot, so output order is
+    // the same as in sequential processing
+
+    auto errors = m_bulkWorkerPool->run(begin, end, load);
+
+    if (errors.empty())
+    {
+        return;
+    }
+
+    for (auto& error: errors)
+    {
+        try
+        {
+            std::rethrow_exception(error.second);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to deserialize bulk object %zu: %s", error.first, e.what());
+        }
+        catch (...)
+        {
+            SWSS_LOG_ERROR("failed to deserialize bulk object %zu: unknown exception", error.first);
+        }
+    }
+
+    // same exception as sequential processing would throw
+
+    std::rethrow_exception(errors.begin()->second);
+}
+
+sai_status_t Syncd::processBulkChunks(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& objectIds,
+        _In_ sai_common_api_t api,
+        _Inout_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+        _Out_ std::vector<sai_status_t>& statuses,
+        _Out_ size_t& executed)
+{
+    SWSS_LOG_ENTER();
+
+    executed = 0;
+
+    const size_t count = objectIds.size();
+
+    if (count == 0)
+    {
+        return processBulkChunk(objectType, objectIds, api, attributes, statuses);
+    }
+
+    const bool translate = (api != SAI_COMMON_API_BULK_GET);
+
+    size_t chunkSize = m_bulkChunkPolicy->getChunkSize(objectType);
+
+    if (chunkSize == 0 || chunkSize > count)
+    {
+        chunkSize = count;
+    }
+
+    {
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
+
+        loadBulkAttributes(objectType, translate, strAttributes, attributes, 0, chunkSize);
+    }
+
+    sai_status_t all = SAI_STATUS_SUCCESS;
+
+    bool prefetching = false;
+
+    try
+    {
+        for (size_t begin = 0; begin < count; begin += chunkSize)
+        {
+            size_t end = std::min(count, begin + chunkSize);
+
+            if (prefetching)
+            {
+                LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
+
+                prefetching = false;
+
+                auto errors = m_bulkPrefetchWorker->wait();
+
+                if (errors.size())
+                {
+                    std::rethrow_exception(errors.begin()->second);
+                }
+            }
+
+            if (end < count)
+            {
+                // deserialize next chunk while current one is executed, chunks
+                // don't overlap, so attributes vector elements are not shared
+
+                size_t nextEnd = std::min(count, end + chunkSize);
+
+                m_bulkPrefetchWorker->start(0, 1, [&, end, nextEnd](size_t, size_t) {
+                        loadBulkAttributes(objectType, translate, strAttributes, attributes, end, nextEnd);
+                        });
+
+                prefetching = true;
+            }
+
+            std::vector<std::string> chunkObjectIds(objectIds.begin() + begin, objectIds.begin() + end);
+            std::vector<std::shared_ptr<SaiAttributeList>> chunkAttributes(attributes.begin() + begin, attributes.begin() + end);
+            std::vector<sai_status_t> chunkStatuses(end - begin);
+
+            auto start = std::chrono::steady_clock::now();
+
+            sai_status_t status = processBulkChunk(objectType, chunkObjectIds, api, chunkAttributes, chunkStatuses);
+
+            if (status == SAI_STATUS_NOT_SUPPORTED || status == SAI_STATUS_NOT_IMPLEMENTED)
+            {
+                m_bulkChunkPolicy->setBulkNotSupported(objectType, api);
+
+                break;
+            }
+
+            m_bulkChunkPolicy->update(objectType, (uint32_t)(end - begin),
+                    (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+            std::copy(chunkStatuses.begin(), chunkStatuses.end(), statuses.begin() + begin);
+
+            if (all == SAI_STATUS_SUCCESS)
+            {
+                all = status;
+            }
+
+            executed = end;
+        }
+    }
+    catch (...)
+    {
+        // prefetch references attributes, it must end before they go away
+
+        if (prefetching)
+        {
+            m_bulkPrefetchWorker->wait();
+        }
+
+        throw;
+    }
+
+    if (prefetching)
+    {
+        // remaining objects will be executed one by one, their attributes
+        // are deserialized again there if prefetch failed
+
+        m_bulkPrefetchWorker->wait();
+    }
+
+    return all;
+}
+
+sai_status_t Syncd::processBulkChunk(
+        _In_ sai_object_type_t objectType,
+        _In_ const std::vector<std::string>& objectIds,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _Out_ std::vector<sai_status_t>& statuses)
+{
+    SWSS_LOG_ENTER();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isobjectid)
+    {
+        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
+
+        switch (api)
+        {
+            case SAI_COMMON_API_BULK_CREATE:
+                return processBulkOidCreate(objectType, mode, objectIds, attributes, statuses);
+
+            case SAI_COMMON_API_BULK_SET:
+                return processBulkOidSet(objectType, mode, objectIds, attributes, statuses);
+
+            case SAI_COMMON_API_BULK_GET:
+                return processBulkOidGet(objectType, mode, objectIds, attributes, statuses);
+
+            case SAI_COMMON_API_BULK_REMOVE:
+                return processBulkOidRemove(objectType, mode, objectIds, statuses);
+
+            default:
+                SWSS_LOG_ERROR("api %s is not supported in bulk mode", sai_serialize_common_api(api).c_str());
+                return SAI_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch (api)
+    {
+        case SAI_COMMON_API_BULK_CREATE:
+            return processBulkCreateEntry(objectType, objectIds, attributes, statuses);
+
+        case SAI_COMMON_API_BULK_REMOVE:
+            return processBulkRemoveEntry(objectType, objectIds, statuses);
+
+        case SAI_COMMON_API_BULK_SET:
+            return processBulkSetEntry(objectType, objectIds, attributes, statuses);
+
+        default:
+            SWSS_LOG_ERROR("api %s is not supported in bulk", sai_serialize_common_api(api).c_str());
+            return SAI_STATUS_NOT_SUPPORTED;
+    }
+}
+
 sai_status_t Syncd::processEntry(
         _In_ sai_object_meta_key_t metaKey,
         _In_ sai_common_api_t api,
@@ -2364,7 +2822,7 @@ sai_status_t Syncd::processBulkOid(
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& objectIds,
         _In_ sai_common_api_t api,
-        _In_ const std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
+        _Inout_ std::vector<std::shared_ptr<SaiAttributeList>>& attributes,
         _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes)
 {
     SWSS_LOG_ENTER();
@@ -2380,34 +2838,13 @@ sai_status_t Syncd::processBulkOid(
 
     sai_status_t all = SAI_STATUS_SUCCESS;
 
-    if (m_commandLineOptions->m_enableSaiBulkSupport)
-    {
-        sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR;
-
-        switch (api)
-        {
-            case SAI_COMMON_API_BULK_CREATE:
-                all = processBulkOidCreate(objectType, mode, objectIds, attributes, statuses);
-                break;
-
-            case SAI_COMMON_API_BULK_SET:
-                all = processBulkOidSet(objectType, mode, objectIds, attributes, statuses);
-                break;
-
-            case SAI_COMMON_API_BULK_GET:
-                all = processBulkOidGet(objectType, mode, objectIds, attributes, statuses);
-                break;
-
-            case SAI_COMMON_API_BULK_REMOVE:
-                all = processBulkOidRemove(objectType, mode, objectIds, statuses);
-                break;
+    size_t executed = 0;
 
-            default:
-                all = SAI_STATUS_NOT_SUPPORTED;
-                SWSS_LOG_ERROR("api %s is not supported in bulk mode", sai_serialize_common_api(api).c_str());
-        }
+    if (m_commandLineOptions->m_enableSaiBulkSupport && m_bulkChunkPolicy->isBulkSupported(objectType, api))
+    {
+        all = processBulkChunks(objectType, objectIds, api, attributes, strAttributes, statuses, executed);
 
-        if (all != SAI_STATUS_NOT_SUPPORTED && all != SAI_STATUS_NOT_IMPLEMENTED)
+        if (executed == objectIds.size())
         {
             switch (api)
             {
@@ -2424,11 +2861,15 @@ sai_status_t Syncd::processBulkOid(
         }
     }
 
-    // vendor SAI don't bulk API yet, so execute one by one
+    // vendor SAI don't bulk API yet, so execute remaining objects one by one
+
+    {
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
 
-    all = SAI_STATUS_SUCCESS;
+        loadBulkAttributes(objectType, api != SAI_COMMON_API_BULK_GET, strAttributes, attributes, executed, objectIds.size());
+    }
 
-    for (size_t idx = 0; idx < objectIds.size(); ++idx)
+    for (size_t idx = executed; idx < objectIds.size(); ++idx)
     {
         sai_status_t status = SAI_STATUS_FAILURE;
 
@@ -2766,6 +3207,8 @@ void Syncd::sendApiResponse(
         return;
     }
 
+    LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_RESPONSE);
+
     switch (api)
     {
         case SAI_COMMON_API_CREATE:
@@ -2803,7 +3246,7 @@ void Syncd::sendApiResponse(
             sai_serialize_common_api(api).c_str(),
             strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for %s api was send",
             sai_serialize_common_api(api).c_str());
@@ -3039,9 +3482,7 @@ void Syncd::syncUpdateRedisQuadEvent(
 
     const bool initView = isInitViewMode();
 
-    static PerformanceIntervalTimer timer("Syncd::syncUpdateRedisQuadEvent");
-
-    timer.start();
+    LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_RESPONSE);
 
     switch (api)
     {
@@ -3090,10 +3531,6 @@ void Syncd::syncUpdateRedisQuadEvent(
 
             SWSS_LOG_THROW("api %d is not supported", api);
     }
-
-    timer.stop();
-
-    timer.inc();
 }
 
 void Syncd::syncUpdateRedisBulkQuadEvent(
@@ -3115,9 +3552,7 @@ void Syncd::syncUpdateRedisBulkQuadEvent(
     // changes and we only want to apply changes when api succeeded. This
     // applies to init view mode and apply view mode.
 
-    static PerformanceIntervalTimer timer("Syncd::syncUpdateRedisBulkQuadEvent");
-
-    timer.start();
+    LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_RESPONSE);
 
     const std::string strObjectType = sai_serialize_object_type(objectType);
 
@@ -3199,10 +3634,6 @@ void Syncd::syncUpdateRedisBulkQuadEvent(
 
             SWSS_LOG_THROW("api %d is not supported", api);
     }
-
-    timer.stop();
-
-    timer.inc(statuses.size());
 }
 
 sai_status_t Syncd::processQuadEvent(
@@ -3214,6 +3645,8 @@ sai_status_t Syncd::processQuadEvent(
     const std::string& key = kfvKey(kco);
     const std::string& op = kfvOp(kco);
 
+    LatencyStageTimer deserializeTimer(*m_latencyRecorder, LatencyRecorder::STAGE_DESERIALIZE);
+
     const std::string& strObjectId = key.substr(key.find(":") + 1);
 
     sai_object_meta_key_t metaKey;
@@ -3224,6 +3657,8 @@ sai_status_t Syncd::processQuadEvent(
         SWSS_LOG_THROW("invalid object type %s", key.c_str());
     }
 
+    m_latencyRecorder->setObjectType(metaKey.objecttype);
+
     auto& values = kfvFieldsValues(kco);
 
     for (auto& v: values)
@@ -3233,6 +3668,8 @@ sai_status_t Syncd::processQuadEvent(
 
     SaiAttributeList list(metaKey.objecttype, values, false);
 
+    deserializeTimer.stop();
+
     /*
      * Attribute list can't be const since we will use it to translate VID to
      * RID in place.
@@ -3280,6 +3717,8 @@ sai_status_t Syncd::processQuadEvent(
 
         SWSS_LOG_DEBUG("translating VID to RIDs on all attributes");
 
+        LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_TRANSLATE);
+
         m_translator->translateVidToRid(metaKey.objecttype, attr_count, attr_list);
     }
 
@@ -3287,30 +3726,19 @@ sai_status_t Syncd::processQuadEvent(
 
     sai_status_t status;
 
+    LatencyStageTimer vendorTimer(*m_latencyRecorder, LatencyRecorder::STAGE_VENDOR);
+
     if (info->isnonobjectid)
     {
-        if (info->objecttype == SAI_OBJECT_TYPE_ROUTE_ENTRY)
-        {
-            static PerformanceIntervalTimer timer("Syncd::processQuadEvent::processEntry(route_entry)");
-
-            timer.start();
-
-            status = processEntry(metaKey, api, attr_count, attr_list);
-
-            timer.stop();
-
-            timer.inc();
-        }
-        else
-        {
-            status = processEntry(metaKey, api, attr_count, attr_list);
-        }
+        status = processEntry(metaKey, api, attr_count, attr_list);
     }
     else
     {
         status = processOid(metaKey.objecttype, strObjectId, api, attr_count, attr_list);
     }
 
+    vendorTimer.stop();
+
     if (api == SAI_COMMON_API_GET)
     {
         if (status != SAI_STATUS_SUCCESS)
@@ -3738,6 +4166,8 @@ void Syncd::sendGetResponse(
 {
     SWSS_LOG_ENTER();
 
+    LatencyStageTimer timer(*m_latencyRecorder, LatencyRecorder::STAGE_RESPONSE);
+
     std::vector<swss::FieldValueTuple> entry;
 
     if (status == SAI_STATUS_SUCCESS)
@@ -3800,7 +4230,7 @@ void Syncd::sendGetResponse(
      * response will not put any data to table, only queue is used.
      */
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for GET api was send");
 }
@@ -3870,7 +4300,7 @@ void Syncd::sendBulkGetResponse(
 
     SWSS_LOG_INFO("sending response for bulk GET api with status: %s", strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entries, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    sendResponse(strStatus, entries, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
 
     SWSS_LOG_INFO("response for bulk GET api was send");
 }
@@ -4185,6 +4615,9 @@ sai_status_t Syncd::processNotifySyncd(
     if (redisNotifySyncd == SAI_REDIS_NOTIFY_SYNCD_INVOKE_DUMP)
     {
         SWSS_LOG_NOTICE("Invoking SAI failure dump");
+
+        dumpVendorSaiDiagnostics("SAI failure dump");
+
         std::string ret_str;
         int ret = swss::exec(SAI_FAILURE_DUMP_SCRIPT, ret_str);
         if (ret != 0)
@@ -4390,7 +4823,72 @@ void Syncd::sendNotifyResponse(
 
     SWSS_LOG_INFO("sending response: %s", strStatus.c_str());
 
-    m_selectableChannel->set(strStatus, entry, REDIS_ASIC_STATE_COMMAND_NOTIFY);
+    sendResponse(strStatus, entry, REDIS_ASIC_STATE_COMMAND_NOTIFY);
+}
+
+void Syncd::sendResponse(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_responseBatchActive)
+    {
+        m_selectableChannel->set(key, values, op);
+        return;
+    }
+
+    if (m_responseBatch.empty())
+    {
+        m_responseBatchStart = std::chrono::steady_clock::now();
+    }
+
+    m_responseBatch.emplace_back(key, op, values);
+
+    if (m_responseBatch.size() >= RESPONSE_BATCH_MAX_SIZE)
+    {
+        // don't delay responses of long request queue too much
+
+        flushResponses();
+    }
+}
+
+void Syncd::flushResponses()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_responseBatch.empty())
+    {
+        return;
+    }
+
+    if (m_responseBatch.size() == 1)
+    {
+        // single response is sent as is, so no sequence number is consumed
+
+        auto& kco = m_responseBatch.front();
+
+        m_selectableChannel->set(kfvKey(kco), kfvFieldsValues(kco), kfvOp(kco));
+
+        m_responseBatch.clear();
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (auto& kco: m_responseBatch)
+    {
+        Globals::appendBatchResponse(entries, ++m_responseSequence, kco);
+    }
+
+    SWSS_LOG_INFO("sending %zu responses in batch, last sequence %" PRIu64,
+            m_responseBatch.size(),
+            m_responseSequence);
+
+    m_selectableChannel->set(std::to_string(m_responseBatch.size()), entries, REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE);
+
+    m_responseBatch.clear();
 }
 
 void Syncd::clearTempView()
@@ -4535,8 +5033,6 @@ sai_status_t Syncd::applyView()
 
             auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig);
 
-            cl->compareViews();
-
             currentViews.push_back(current);
             tempViews.push_back(temp);
             cls.push_back(cl);
@@ -4554,6 +5050,11 @@ sai_status_t Syncd::applyView()
         return SAI_STATUS_FAILURE;
     }
 
+    if (!compareViews(cls))
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
     /*
      * This is second stage. Those operations are destructive, if any of them
      * fail, then we will have inconsistent state in ASIC.
@@ -4569,7 +5070,7 @@ sai_status_t Syncd::applyView()
         cl->executeOperationsOnAsic(); // can throw, if so asic will be in inconsistent state
     }
 
-    updateRedisDatabase(tempViews);
+    updateRedisDatabase(currentMap, tempViews);
 
     for (auto& cl: cls)
     {
@@ -4587,6 +5088,62 @@ sai_status_t Syncd::applyView()
     return SAI_STATUS_SUCCESS;
 }
 
+bool Syncd::compareViews(
+        _In_ const std::vector<std::shared_ptr<ComparisonLogic>>& cls)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Views of different switches are independent, each comparison logic
+     * has its own current and temporary view, so they can be compared
+     * concurrently. Results are kept in switch order, so execute stage is
+     * the same as when comparing sequentially.
+     */
+
+    std::vector<std::future<void>> futures;
+
+    for (size_t idx = 1; idx < cls.size(); idx++)
+    {
+        auto cl = cls.at(idx);
+
+        futures.push_back(std::async(std::launch::async, [cl]() { cl->compareViews(); }));
+    }
+
+    bool success = true;
+
+    try
+    {
+        if (cls.size())
+        {
+            cls.at(0)->compareViews(); // first switch on this thread
+        }
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_ERROR("Exception: %s", e.what());
+
+        success = false;
+    }
+
+    // wait for all switches, even if some of them failed
+
+    for (auto& f: futures)
+    {
+        try
+        {
+            f.get();
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Exception: %s", e.what());
+
+            success = false;
+        }
+    }
+
+    return success;
+}
+
 void Syncd::dumpComparisonLogicOutput(
     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews)
 {
@@ -4642,23 +5199,20 @@ void Syncd::dumpComparisonLogicOutput(
 }
 
 void Syncd::updateRedisDatabase(
+    _In_ const std::map<sai_object_id_t, swss::TableDump>& currentMap,
     _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews)
 {
     SWSS_LOG_ENTER();
 
-    // TODO: We can make LUA script for this which will be much faster.
-    //
     // TODO: Needs to be revisited if ASIC views will be across multiple redis
     // database indexes.
 
     SWSS_LOG_TIMER("redis update");
 
-    m_client->removeAsicStateTable();
-
-    m_client->removeTempAsicStateTable();
-
     // Save temporary views as current view in redis database.
 
+    std::map<std::string, std::vector<swss::FieldValueTuple>> newView;
+
     for (auto& tv: temporaryViews)
     {
         for (const auto &pair: tv->m_soAll)
@@ -4667,7 +5221,7 @@ void Syncd::updateRedisDatabase(
 
             const auto &attr = obj->getAllAttributes();
 
-            std::vector<swss::FieldValueTuple> entry;
+            auto& entry = newView[sai_serialize_object_meta_key(obj->m_meta_key)];
 
             for (const auto &ap: attr)
             {
@@ -4675,8 +5229,6 @@ void Syncd::updateRedisDatabase(
 
                 entry.emplace_back(saiAttr->getStrAttrId(), saiAttr->getStrAttrValue());
             }
-
-            m_client->createAsicObject(obj->m_meta_key, entry);
         }
     }
 
@@ -4698,7 +5250,13 @@ void Syncd::updateRedisDatabase(
         }
     }
 
-    m_client->setVidAndRidMap(allVid2Rid);
+    /*
+     * Only differences against current view are written, both for objects
+     * and VID/RID maps, by redis side script calls executed in single
+     * transaction.
+     */
+
+    m_client->replaceAsicView(currentMap, newView, allVid2Rid);
 
     SWSS_LOG_NOTICE("updated redis database");
 }
@@ -5458,6 +6016,21 @@ bool Syncd::isVeryFirstRun()
     return firstRun;
 }
 
+void Syncd::dumpVendorSaiDiagnostics(
+        _In_ const std::string& reason)
+{
+    SWSS_LOG_ENTER();
+
+    auto vendorSai = std::dynamic_pointer_cast<VendorSai>(m_vendorSai);
+
+    if (vendorSai)
+    {
+        vendorSai->getCallTrace()->dump(reason);
+
+        vendorSai->logLockStats();
+    }
+}
+
 static void timerWatchdogCallback(
         _In_ int64_t span)
 {
@@ -5508,6 +6081,8 @@ void Syncd::run()
     {
         SWSS_LOG_ERROR("Runtime error during syncd init: %s", e.what());
 
+        dumpVendorSaiDiagnostics("exception during init");
+
         sendShutdownRequestAfterException();
 
         s = std::make_shared<swss::Select>();
@@ -5520,7 +6095,12 @@ void Syncd::run()
             runMainLoop = false;
     }
 
-    m_timerWatchdog.setCallback(timerWatchdogCallback);
+    m_timerWatchdog.setCallback([this](uint64_t span)
+            {
+                timerWatchdogCallback(span);
+
+                dumpVendorSaiDiagnostics("watchdog timeout");
+            });
 
     while (runMainLoop)
     {
@@ -5642,6 +6222,8 @@ void Syncd::run()
         {
             SWSS_LOG_ERROR("Runtime error: %s", e.what());
 
+            dumpVendorSaiDiagnostics("exception in main loop");
+
             sendShutdownRequestAfterException();
 
             s = std::make_shared<swss::Select>();
@@ -4,6 +4,7 @@
 #include "FlexCounterManager.h"
 #include "VendorSai.h"
 #include "AsicView.h"
+#include "ComparisonLogic.h"
 #include "SaiSwitch.h"
 #include "VirtualOidTranslator.h"
 #include "RedisClient.h"
@@ -17,6 +18,9 @@
 #include "BreakConfig.h"
 #include "NotificationProducerBase.h"
 #include "TimerWatchdog.h"
+#include "LatencyRecorder.h"
+#include "BulkChunkPolicy.h"
+#include "WorkerPool.h"
 #include "MdioIpcServer.h"
 
 #include "meta/SaiAttributeList.h"
@@ -27,6 +31,7 @@
 #include "swss/notificationconsumer.h"
 
 #include <memory>
+#include <chrono>
 
 namespace syncd
 {
@@ -67,6 +72,12 @@ namespace syncd
             void processEvent(
                     _In_ sairedis::SelectableChannel& consumer);
 
+            /**
+             * @brief Pop and process events until consumer is empty.
+             */
+            void processQueuedEvents(
+                    _In_ sairedis::SelectableChannel& consumer);
+
             sai_status_t processQuadEventInInitViewMode(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::string& strObjectId,
@@ -96,6 +107,14 @@ namespace syncd
 
             void sendShutdownRequestAfterException();
 
+            /**
+             * @brief Dump last vendor SAI calls and lock stats to syslog.
+             *
+             * Safe to call from any thread, also when vendor call hanged.
+             */
+            void dumpVendorSaiDiagnostics(
+                    _In_ const std::string& reason);
+
         public: // shutdown actions for all switches
 
             sai_status_t removeAllSwitches();
@@ -127,6 +146,9 @@ namespace syncd
             sai_status_t processSingleEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            sai_status_t dispatchSingleEvent(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
             sai_status_t processAttrCapabilityQuery(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
@@ -160,16 +182,57 @@ namespace syncd
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
-                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
                     _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
 
             sai_status_t processBulkEntry(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
-                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
                     _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
 
+            /**
+             * @brief Deserialize (and translate) attributes of objects in
+             * range [begin, end) which are not deserialized yet.
+             *
+             * Attribute lists are allocated from current bulk arenas. When
+             * worker pool is enabled, objects are deserialized in parallel
+             * and exception of first failed object is thrown.
+             */
+            void loadBulkAttributes(
+                    _In_ sai_object_type_t objectType,
+                    _In_ bool translate,
+                    _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+                    _In_ size_t begin,
+                    _In_ size_t end);
+
+            /**
+             * @brief Execute bulk in vendor SAI in chunks.
+             *
+             * Chunk size is taken from bulk chunk policy, attributes of next
+             * chunk are deserialized while current chunk is executed. When
+             * vendor SAI don't support bulk, execution stops and number of
+             * objects already executed is returned, remaining objects must
+             * be executed one by one.
+             */
+            sai_status_t processBulkChunks(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& objectIds,
+                    _In_ sai_common_api_t api,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+                    _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes,
+                    _Out_ std::vector<sai_status_t>& statuses,
+                    _Out_ size_t& executed);
+
+            sai_status_t processBulkChunk(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const std::vector<std::string>& objectIds,
+                    _In_ sai_common_api_t api,
+                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
+                    _Out_ std::vector<sai_status_t>& statuses);
+
             sai_status_t processBulkCreateEntry(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string>& objectIds,
@@ -187,11 +250,20 @@ namespace syncd
                     _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& attributes,
                     _Out_ std::vector<sai_status_t>& statuses);
 
+            /**
+             * @brief Create arenas for bulk request, reserved from field
+             * count and values size learned for object type.
+             */
+            std::vector<std::shared_ptr<saimeta::SaiAttributeArena>> createBulkArenas(
+                    _In_ sai_object_type_t objectType,
+                    _In_ size_t objectCount,
+                    _In_ size_t fieldCount);
+
             sai_status_t processBulkQuadEventInInitViewMode(
                     _In_ sai_object_type_t objectType,
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
-                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
+                    _Inout_ std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes,
                     _In_ const std::vector<std::vector<swss::FieldValueTuple>>& strAttributes);
 
             sai_status_t processOid(
@@ -323,10 +395,21 @@ namespace syncd
 
             sai_status_t applyView();
 
+            /**
+             * @brief Compare views of all switches.
+             *
+             * Each switch is compared on separate thread.
+             *
+             * @return True if all switches were compared successfully.
+             */
+            bool compareViews(
+                    _In_ const std::vector<std::shared_ptr<ComparisonLogic>>& cls);
+
             void dumpComparisonLogicOutput(
                     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews);
 
             void updateRedisDatabase(
+                    _In_ const std::map<sai_object_id_t, swss::TableDump>& currentMap,
                     _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews);
 
             std::map<sai_object_id_t, swss::TableDump> redisGetAsicView(
@@ -385,6 +468,36 @@ namespace syncd
             void sendNotifyResponse(
                     _In_ sai_status_t status);
 
+            /**
+             * @brief Send response to client.
+             *
+             * When response batch is active, response is queued and sent
+             * together with responses of other requests processed in the
+             * same event pass.
+             */
+            void sendResponse(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& values,
+                    _In_ const std::string& op);
+
+            /**
+             * @brief Send all queued responses in single message.
+             */
+            void flushResponses();
+
+            /**
+             * @brief Request which can take long time to process, like
+             * apply view or large bulk, queued responses should be sent
+             * before processing it.
+             */
+            static bool isLongRunningOperation(
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
+            /**
+             * @brief First queued response is waiting longer than allowed.
+             */
+            bool isResponseBatchExpired() const;
+
         private: // snoop get response oids
 
             void snoopGetResponse(
@@ -486,6 +599,29 @@ namespace syncd
 
             bool m_enableSyncMode;
 
+            /**
+             * @brief Responses of consecutively processed requests are sent
+             * in single message.
+             */
+            bool m_enableResponseBatch;
+
+            /**
+             * @brief Responses are queued during processing of events.
+             */
+            bool m_responseBatchActive;
+
+            std::vector<swss::KeyOpFieldsValuesTuple> m_responseBatch;
+
+            /**
+             * @brief Time when first response was queued in current batch.
+             */
+            std::chrono::steady_clock::time_point m_responseBatchStart;
+
+            /**
+             * @brief Sequence number of last batched response.
+             */
+            uint64_t m_responseSequence;
+
         private:
 
             /**
@@ -536,6 +672,35 @@ namespace syncd
 
             TimerWatchdog m_timerWatchdog;
 
+            std::shared_ptr<LatencyRecorder> m_latencyRecorder;
+
+            std::shared_ptr<BulkChunkPolicy> m_bulkChunkPolicy;
+
+            /**
+             * @brief Worker pool used to deserialize bulk objects in
+             * parallel, nullptr when disabled.
+             */
+            std::shared_ptr<WorkerPool> m_bulkWorkerPool;
+
+            /**
+             * @brief Single worker deserializing next bulk chunk while
+             * current chunk is executed by vendor SAI.
+             */
+            std::shared_ptr<WorkerPool> m_bulkPrefetchWorker;
+
+            /**
+             * @brief Arenas (one per deserialize worker) holding attribute
+             * lists of currently processed bulk request, empty outside bulk
+             * processing.
+             */
+            std::vector<std::shared_ptr<saimeta::SaiAttributeArena>> m_bulkArenas;
+
+            /**
+             * @brief Attribute values size per object learned from previous
+             * bulk requests, used to reserve arena for next request.
+             */
+            std::map<sai_object_type_t, size_t> m_bulkArenaObjectSizes;
+
             std::set<sai_object_id_t> m_createdInInitView;
     };
 }
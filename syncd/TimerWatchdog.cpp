@@ -127,51 +127,79 @@ void TimerWatchdog::threadFunction()
     {
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
-        MUTEX; // to protect event name
+        int64_t span = 0;
 
-        // we make local copies, since executing functions can be so fast that
-        // when we will read second time start timestamp it can be different
-        // than previous one
+        std::function<void(uint64_t)> callback;
 
-        int64_t start = m_startTimestamp;
-        int64_t end = m_endTimestamp;
-        int64_t now = getTimeSinceEpoch(); // now needs to be obtained after obtaining start
+        {
+            MUTEX; // to protect event name
+
+            callback = checkTimespan(span);
+        }
 
-        int64_t span = end - start;
+        // callback is executed outside mutex, since it can take long time
+        // and it would block setStartTime/setEndTime on main thread
 
-        if (span < 0 && start > m_lastCheckTimestamp)
+        if (callback)
         {
-            // this means start > end, so new function is currently executing,
-            // or that function hanged, so see how long that function is
-            // executing, this negative span can be arbitrary long even hours,
-            // and that is fine, since we don't know when OA makes next
-            // function call
+            callback(span);
+        }
+    }
+
+    SWSS_LOG_NOTICE("ending timer watchdog thread");
+}
+
+std::function<void(uint64_t)> TimerWatchdog::checkTimespan(
+        _Out_ int64_t& span)
+{
+    SWSS_LOG_ENTER();
 
-            span = now - start; // this must be always non negative
+    // this api must be executed under mutex
+
+    // we make local copies, since executing functions can be so fast that
+    // when we will read second time start timestamp it can be different
+    // than previous one
+
+    int64_t start = m_startTimestamp;
+    int64_t end = m_endTimestamp;
+    int64_t now = getTimeSinceEpoch(); // now needs to be obtained after obtaining start
 
-            SWSS_LOG_NOTICE("time span %ld ms for '%s'", span/1000, m_eventName.c_str()); // TODO remove this
+    span = end - start;
 
-            if (span < 0)
-                SWSS_LOG_THROW("negative span 'now - start': %ld - %ld", now, start);
+    if (span < 0 && start > m_lastCheckTimestamp)
+    {
+        // this means start > end, so new function is currently executing,
+        // or that function hanged, so see how long that function is
+        // executing, this negative span can be arbitrary long even hours,
+        // and that is fine, since we don't know when OA makes next
+        // function call
+
+        span = now - start; // this must be always non negative
 
-            if (span > m_warnTimespan)
-            {
-                m_lastCheckTimestamp = start;
+        SWSS_LOG_NOTICE("time span %ld ms for '%s'", span/1000, m_eventName.c_str()); // TODO remove this
 
-                // function probably hanged
+        if (span < 0)
+            SWSS_LOG_THROW("negative span 'now - start': %ld - %ld", now, start);
 
-                SWSS_LOG_ERROR("time span WD exceeded %ld ms for %s", span/1000, m_eventName.c_str());
+        if (span > m_warnTimespan)
+        {
+            m_lastCheckTimestamp = start;
 
-                logEventData();
-            }
+            // function probably hanged
 
-            continue;
+            SWSS_LOG_ERROR("time span WD exceeded %ld ms for %s", span/1000, m_eventName.c_str());
+
+            logEventData();
+
+            return m_callback;
         }
 
-        m_lastCheckTimestamp = start;
+        return nullptr;
     }
 
-    SWSS_LOG_NOTICE("ending timer watchdog thread");
+    m_lastCheckTimestamp = start;
+
+    return nullptr;
 }
 
 int64_t TimerWatchdog::getTimeSinceEpoch()
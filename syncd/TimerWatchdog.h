@@ -43,6 +43,19 @@ namespace syncd
 
             void threadFunction();
 
+            /**
+             * @brief Checks whether current event exceeded warn timespan.
+             *
+             * Must be executed under mutex. Returns callback which should be
+             * executed after mutex is released, or nullptr.
+             *
+             * @param[out] span Time span of current event in microseconds.
+             *
+             * @return Callback to execute or nullptr.
+             */
+            std::function<void(uint64_t)> checkTimespan(
+                    _Out_ int64_t& span);
+
             void logEventData();
 
         private:
@@ -1,5 +1,7 @@
 #include "config.h"
 #include "VendorSai.h"
+#include "VendorSaiCallScope.h"
+#include "VendorSaiLockGuard.h"
 
 #include "meta/sai_serialize.h"
 
@@ -10,19 +12,30 @@
 
 using namespace syncd;
 
-#define MUTEX() std::lock_guard<std::mutex> _lock(m_apimutex)
+#define MUTEX() VendorSaiLockGuard _lock(getConfigLock())
+
+#define STATS_MUTEX() VendorSaiLockGuard _lock(getStatsLock())
 
 #define VENDOR_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return SAI_STATUS_FAILURE; }
 
-VendorSai::VendorSai()
+#define VENDOR_CALL_TRACE(ot,key,count)                                       \
+    VendorSaiCallScope _trace(*m_callTrace, __func__,                        \
+            (sai_object_type_t)(ot), (uint64_t)(key), (uint32_t)(count))
+
+VendorSai::VendorSai():
+    m_lockPolicy(VENDOR_SAI_LOCK_POLICY_GLOBAL),
+    m_configLock("config"),
+    m_statsLock("stats")
 {
     SWSS_LOG_ENTER();
 
     m_apiInitialized = false;
 
+    m_callTrace = std::make_shared<VendorSaiCallTrace>();
+
     memset(&m_apis, 0, sizeof(m_apis));
 
     sai_global_apis_t ga =
@@ -76,7 +89,10 @@ sai_status_t VendorSai::apiInitialize(
         _In_ uint64_t flags,
         _In_ const sai_service_method_table_t *service_method_table)
 {
-    MUTEX();
+    // lock policy can change here, so take all locks regardless of it
+
+    VendorSaiLockGuard _lock(&m_configLock);
+    VendorSaiLockGuard _statsLock(&m_statsLock);
     SWSS_LOG_ENTER();
 
     if (m_apiInitialized)
@@ -86,6 +102,12 @@ sai_status_t VendorSai::apiInitialize(
         return SAI_STATUS_FAILURE;
     }
 
+    auto vso = std::dynamic_pointer_cast<VendorSaiOptions>(getOptions(VendorSaiOptions::OPTIONS_KEY));
+
+    m_lockPolicy = vso ? vso->m_lockPolicy : VENDOR_SAI_LOCK_POLICY_GLOBAL;
+
+    SWSS_LOG_NOTICE("vendor SAI lock policy: %s", VendorSaiOptions::lockPolicyToString(m_lockPolicy).c_str());
+
     if ((service_method_table == NULL))
     {
         SWSS_LOG_ERROR("invalid service_method_table handle passed to SAI API initialize");
@@ -147,6 +169,8 @@ sai_status_t VendorSai::apiUninitialize(void)
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
+    logLockStats();
+
     auto status = m_globalApis.api_uninitialize();
 
     if (status == SAI_STATUS_SUCCESS)
@@ -174,7 +198,9 @@ sai_status_t VendorSai::create(
 
     sai_object_meta_key_t mk = { .objecttype = objectType, .objectkey = { .key = { .object_id = 0 } } };
 
-    auto status = sai_metadata_generic_create(&m_apis, &mk, switchId, attr_count, attr_list);
+    VENDOR_CALL_TRACE(objectType, switchId, 1);
+
+    auto status = _trace.end(sai_metadata_generic_create(&m_apis, &mk, switchId, attr_count, attr_list));
 
     if (status == SAI_STATUS_SUCCESS)
     {
@@ -194,7 +220,9 @@ sai_status_t VendorSai::remove(
 
     sai_object_meta_key_t mk = { .objecttype = objectType, .objectkey = { .key = { .object_id = objectId } } };
 
-    return sai_metadata_generic_remove(&m_apis, &mk);
+    VENDOR_CALL_TRACE(objectType, objectId, 1);
+
+    return _trace.end(sai_metadata_generic_remove(&m_apis, &mk));
 }
 
 sai_status_t VendorSai::set(
@@ -202,7 +230,7 @@ sai_status_t VendorSai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    std::unique_lock<std::mutex> _lock(m_apimutex);
+    MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -215,7 +243,9 @@ sai_status_t VendorSai::set(
         _lock.unlock();
     }
 
-    return sai_metadata_generic_set(&m_apis, &mk, attr);
+    VENDOR_CALL_TRACE(objectType, objectId, 1);
+
+    return _trace.end(sai_metadata_generic_set(&m_apis, &mk, attr));
 }
 
 sai_status_t VendorSai::get(
@@ -230,7 +260,9 @@ sai_status_t VendorSai::get(
 
     sai_object_meta_key_t mk = { .objecttype = objectType, .objectkey = { .key = { .object_id = objectId } } };
 
-    return sai_metadata_generic_get(&m_apis, &mk, attr_count, attr_list);
+    VENDOR_CALL_TRACE(objectType, objectId, 1);
+
+    return _trace.end(sai_metadata_generic_get(&m_apis, &mk, attr_count, attr_list));
 }
 
 // QUAD ENTRY
@@ -248,7 +280,9 @@ sai_status_t VendorSai::create(                                             \
         (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT);                         \
     sai_object_meta_key_t mk = { .objecttype = info->objecttype,            \
         .objectkey = { .key = { .ot = *entry } } };                         \
-    return info->create(&mk, 0, attr_count, attr_list);                     \
+    VENDOR_CALL_TRACE(info->objecttype,                                     \
+            VendorSaiCallTrace::hashMetaKey(mk), 1);                        \
+    return _trace.end(info->create(&mk, 0, attr_count, attr_list));         \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_CREATE_ENTRY);
@@ -264,7 +298,9 @@ sai_status_t VendorSai::remove(                                             \
         (sai_object_type_t)SAI_OBJECT_TYPE_ ## OT);                         \
     sai_object_meta_key_t mk = { .objecttype = info->objecttype,            \
         .objectkey = { .key = { .ot = *entry } } };                         \
-    return info->remove(&mk);                                               \
+    VENDOR_CALL_TRACE(info->objecttype,                                     \
+            VendorSaiCallTrace::hashMetaKey(mk), 1);                        \
+    return _trace.end(info->remove(&mk));                                   \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_REMOVE_ENTRY);
@@ -281,7 +317,9 @@ sai_status_t VendorSai::set(                                                \
         (sai_object_type_t) SAI_OBJECT_TYPE_ ## OT);                        \
     sai_object_meta_key_t mk = { .objecttype = info->objecttype,            \
         .objectkey = { .key = { .ot = *entry } } };                         \
-    return info->set(&mk, attr);                                            \
+    VENDOR_CALL_TRACE(info->objecttype,                                     \
+            VendorSaiCallTrace::hashMetaKey(mk), 1);                        \
+    return _trace.end(info->set(&mk, attr));                                \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_SET_ENTRY);
@@ -299,7 +337,9 @@ sai_status_t VendorSai::get(                                                \
         (sai_object_type_t) SAI_OBJECT_TYPE_ ## OT);                        \
     sai_object_meta_key_t mk = { .objecttype = info->objecttype,            \
         .objectkey = { .key = { .ot = *entry } } };                         \
-    return info->get(&mk, attr_count, attr_list);                           \
+    VENDOR_CALL_TRACE(info->objecttype,                                     \
+            VendorSaiCallTrace::hashMetaKey(mk), 1);                        \
+    return _trace.end(info->get(&mk, attr_count, attr_list));               \
 }
 
 SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_GET_ENTRY);
@@ -313,7 +353,7 @@ sai_status_t VendorSai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -325,7 +365,9 @@ sai_status_t VendorSai::getStats(
 
     sai_object_meta_key_t mk = { .objecttype = object_type, .objectkey = { .key = { .object_id = object_id} } };
 
-    return sai_metadata_generic_get_stats(&m_apis, &mk, number_of_counters, counter_ids, counters);
+    VENDOR_CALL_TRACE(object_type, object_id, number_of_counters);
+
+    return _trace.end(sai_metadata_generic_get_stats(&m_apis, &mk, number_of_counters, counter_ids, counters));
 }
 
 sai_status_t VendorSai::queryStatsCapability(
@@ -333,14 +375,16 @@ sai_status_t VendorSai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_globalApis.query_stats_capability(
+    VENDOR_CALL_TRACE(objectType, switchId, 0);
+
+    return _trace.end(m_globalApis.query_stats_capability(
             switchId,
             objectType,
-            stats_capability);
+            stats_capability));
 }
 
 sai_status_t VendorSai::getStatsExt(
@@ -351,13 +395,15 @@ sai_status_t VendorSai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
     sai_object_meta_key_t mk = { .objecttype = object_type, .objectkey = { .key = { .object_id = object_id} } };
 
-    return sai_metadata_generic_get_stats_ext(&m_apis, &mk, number_of_counters, counter_ids, mode, counters);
+    VENDOR_CALL_TRACE(object_type, object_id, number_of_counters);
+
+    return _trace.end(sai_metadata_generic_get_stats_ext(&m_apis, &mk, number_of_counters, counter_ids, mode, counters));
 }
 
 sai_status_t VendorSai::clearStats(
@@ -366,13 +412,15 @@ sai_status_t VendorSai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
     sai_object_meta_key_t mk = { .objecttype = object_type, .objectkey = { .key = { .object_id = object_id} } };
 
-    return sai_metadata_generic_clear_stats(&m_apis, &mk, number_of_counters, counter_ids);
+    VENDOR_CALL_TRACE(object_type, object_id, number_of_counters);
+
+    return _trace.end(sai_metadata_generic_clear_stats(&m_apis, &mk, number_of_counters, counter_ids));
 }
 
 sai_status_t VendorSai::bulkGetStats(
@@ -386,11 +434,13 @@ sai_status_t VendorSai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return (m_globalApis.bulk_object_get_stats == nullptr)
+    VENDOR_CALL_TRACE(object_type, switchId, object_count);
+
+    return _trace.end((m_globalApis.bulk_object_get_stats == nullptr)
         ? SAI_STATUS_NOT_IMPLEMENTED
         : m_globalApis.bulk_object_get_stats(
                 switchId,
@@ -401,7 +451,7 @@ sai_status_t VendorSai::bulkGetStats(
                 counter_ids,
                 mode,
                 object_statuses,
-                counters);
+                counters));
 }
 
 sai_status_t VendorSai::bulkClearStats(
@@ -414,11 +464,13 @@ sai_status_t VendorSai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return (m_globalApis.bulk_object_clear_stats == nullptr)
+    VENDOR_CALL_TRACE(object_type, switchId, object_count);
+
+    return _trace.end((m_globalApis.bulk_object_clear_stats == nullptr)
         ? SAI_STATUS_NOT_IMPLEMENTED
         : m_globalApis.bulk_object_clear_stats(
                 switchId,
@@ -428,7 +480,7 @@ sai_status_t VendorSai::bulkClearStats(
                 number_of_counters,
                 counter_ids,
                 mode,
-                object_statuses);
+                object_statuses));
 }
 
 // BULK QUAD OID
@@ -517,13 +569,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return ptr(switch_id,
+    VENDOR_CALL_TRACE(object_type, switch_id, object_count);
+
+    return _trace.end(ptr(switch_id,
             object_count,
             attr_count,
             attr_list,
             mode,
             object_id,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -604,7 +658,9 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return ptr(object_count, object_id, mode, object_statuses);
+    VENDOR_CALL_TRACE(object_type, (object_count && object_id) ? object_id[0] : SAI_NULL_OBJECT_ID, object_count);
+
+    return _trace.end(ptr(object_count, object_id, mode, object_statuses));
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -646,11 +702,13 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return ptr(object_count,
+    VENDOR_CALL_TRACE(object_type, (object_count && object_id) ? object_id[0] : SAI_NULL_OBJECT_ID, object_count);
+
+    return _trace.end(ptr(object_count,
             object_id,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkGet(
@@ -685,12 +743,14 @@ sai_status_t VendorSai::bulkGet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return ptr(object_count,
+    VENDOR_CALL_TRACE(object_type, (object_count && object_id) ? object_id[0] : SAI_NULL_OBJECT_ID, object_count);
+
+    return _trace.end(ptr(object_count,
             object_id,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 // BULK GET
@@ -734,13 +794,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.route_api->create_route_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_ROUTE_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_ROUTE_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.route_api->create_route_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -761,13 +823,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.fdb_api->create_fdb_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FDB_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_FDB_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.fdb_api->create_fdb_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -788,13 +852,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.mpls_api->create_inseg_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_INSEG_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_INSEG_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.mpls_api->create_inseg_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -815,13 +881,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.nat_api->create_nat_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NAT_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NAT_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.nat_api->create_nat_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -842,13 +910,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.srv6_api->create_my_sid_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_MY_SID_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_MY_SID_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.srv6_api->create_my_sid_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -869,13 +939,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.neighbor_api->create_neighbor_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.neighbor_api->create_neighbor_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -896,13 +968,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_direction_lookup_api->create_direction_lookup_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_direction_lookup_api->create_direction_lookup_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -923,13 +997,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_eni_api->create_eni_ether_address_map_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_eni_api->create_eni_ether_address_map_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -950,13 +1026,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_vip_api->create_vip_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_VIP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_VIP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_vip_api->create_vip_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -977,13 +1055,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_inbound_routing_api->create_inbound_routing_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_inbound_routing_api->create_inbound_routing_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1004,13 +1084,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_pa_validation_api->create_pa_validation_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_pa_validation_api->create_pa_validation_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1031,13 +1113,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_outbound_routing_api->create_outbound_routing_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_outbound_routing_api->create_outbound_routing_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1058,13 +1142,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_outbound_ca_to_pa_api->create_outbound_ca_to_pa_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_outbound_ca_to_pa_api->create_outbound_ca_to_pa_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1085,13 +1171,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_flow_api->create_flow_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FLOW_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_FLOW_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_flow_api->create_flow_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1112,13 +1200,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_meter_api->create_meter_bucket_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_METER_BUCKET_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_METER_BUCKET_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_meter_api->create_meter_bucket_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkCreate(
@@ -1139,13 +1229,15 @@ sai_status_t VendorSai::bulkCreate(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.prefix_compression_api->create_prefix_compression_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_PREFIX_COMPRESSION_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_PREFIX_COMPRESSION_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.prefix_compression_api->create_prefix_compression_entries(
             object_count,
             entries,
             attr_count,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 // BULK REMOVE
@@ -1166,11 +1258,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.route_api->remove_route_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_ROUTE_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_ROUTE_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.route_api->remove_route_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 
@@ -1190,11 +1284,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.fdb_api->remove_fdb_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FDB_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_FDB_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.fdb_api->remove_fdb_entries(
             object_count,
             entries,
             mode,
-            object_statuses);;
+            object_statuses););
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1213,11 +1309,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.mpls_api->remove_inseg_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_INSEG_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_INSEG_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.mpls_api->remove_inseg_entries(
             object_count,
             entries,
             mode,
-            object_statuses);;
+            object_statuses););
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1236,11 +1334,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.nat_api->remove_nat_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NAT_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NAT_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.nat_api->remove_nat_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1259,11 +1359,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.srv6_api->remove_my_sid_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_MY_SID_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_MY_SID_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.srv6_api->remove_my_sid_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1282,11 +1384,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.neighbor_api->remove_neighbor_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.neighbor_api->remove_neighbor_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1305,11 +1409,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_direction_lookup_api->remove_direction_lookup_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_DIRECTION_LOOKUP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_direction_lookup_api->remove_direction_lookup_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1328,11 +1434,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_eni_api->remove_eni_ether_address_map_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_ENI_ETHER_ADDRESS_MAP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_eni_api->remove_eni_ether_address_map_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1351,11 +1459,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_vip_api->remove_vip_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_VIP_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_VIP_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_vip_api->remove_vip_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1374,11 +1484,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_inbound_routing_api->remove_inbound_routing_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_INBOUND_ROUTING_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_inbound_routing_api->remove_inbound_routing_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1397,11 +1509,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_pa_validation_api->remove_pa_validation_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_PA_VALIDATION_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_pa_validation_api->remove_pa_validation_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1420,11 +1534,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_outbound_routing_api->remove_outbound_routing_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_OUTBOUND_ROUTING_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_outbound_routing_api->remove_outbound_routing_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1443,11 +1559,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_outbound_ca_to_pa_api->remove_outbound_ca_to_pa_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_OUTBOUND_CA_TO_PA_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_outbound_ca_to_pa_api->remove_outbound_ca_to_pa_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1466,11 +1584,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_flow_api->remove_flow_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FLOW_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_FLOW_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_flow_api->remove_flow_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1489,11 +1609,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.dash_meter_api->remove_meter_bucket_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_METER_BUCKET_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_METER_BUCKET_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.dash_meter_api->remove_meter_bucket_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkRemove(
@@ -1512,11 +1634,13 @@ sai_status_t VendorSai::bulkRemove(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.prefix_compression_api->remove_prefix_compression_entries(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_PREFIX_COMPRESSION_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_PREFIX_COMPRESSION_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.prefix_compression_api->remove_prefix_compression_entries(
             object_count,
             entries,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 // BULK SET
@@ -1538,12 +1662,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.route_api->set_route_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_ROUTE_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_ROUTE_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.route_api->set_route_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1563,12 +1689,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.fdb_api->set_fdb_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FDB_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_FDB_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.fdb_api->set_fdb_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);;
+            object_statuses););
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1588,12 +1716,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.mpls_api->set_inseg_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_INSEG_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_INSEG_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.mpls_api->set_inseg_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);;
+            object_statuses););
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1613,12 +1743,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.nat_api->set_nat_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NAT_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NAT_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.nat_api->set_nat_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1638,12 +1770,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.srv6_api->set_my_sid_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_MY_SID_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_MY_SID_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.srv6_api->set_my_sid_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1663,12 +1797,14 @@ sai_status_t VendorSai::bulkSet(
         return SAI_STATUS_NOT_SUPPORTED;
     }
 
-    return m_apis.neighbor_api->set_neighbor_entries_attribute(
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, VendorSaiCallTrace::hashEntry(SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, entries), object_count);
+
+    return _trace.end(m_apis.neighbor_api->set_neighbor_entries_attribute(
             object_count,
             entries,
             attr_list,
             mode,
-            object_statuses);
+            object_statuses));
 }
 
 sai_status_t VendorSai::bulkSet(
@@ -1822,7 +1958,9 @@ sai_status_t VendorSai::flushFdbEntries(
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_apis.fdb_api->flush_fdb_entries(switch_id, attr_count, attr_list);
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_FDB_FLUSH, switch_id, attr_count);
+
+    return _trace.end(m_apis.fdb_api->flush_fdb_entries(switch_id, attr_count, attr_list));
 }
 
 sai_status_t VendorSai::switchMdioRead(
@@ -1836,7 +1974,9 @@ sai_status_t VendorSai::switchMdioRead(
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_apis.switch_api->switch_mdio_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_SWITCH, ((uint64_t)device_addr << 32) | start_reg_addr, number_of_registers);
+
+    return _trace.end(m_apis.switch_api->switch_mdio_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 }
 
 sai_status_t VendorSai::switchMdioWrite(
@@ -1850,7 +1990,9 @@ sai_status_t VendorSai::switchMdioWrite(
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_apis.switch_api->switch_mdio_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_SWITCH, ((uint64_t)device_addr << 32) | start_reg_addr, number_of_registers);
+
+    return _trace.end(m_apis.switch_api->switch_mdio_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 }
 
 sai_status_t VendorSai::switchMdioCl22Read(
@@ -1864,10 +2006,12 @@ sai_status_t VendorSai::switchMdioCl22Read(
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_SWITCH, ((uint64_t)device_addr << 32) | start_reg_addr, number_of_registers);
+
 #if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
-    return m_apis.switch_api->switch_mdio_cl22_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    return _trace.end(m_apis.switch_api->switch_mdio_cl22_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 #else
-    return m_apis.switch_api->switch_mdio_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    return _trace.end(m_apis.switch_api->switch_mdio_read(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 #endif
 }
 
@@ -1882,10 +2026,12 @@ sai_status_t VendorSai::switchMdioCl22Write(
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
+    VENDOR_CALL_TRACE(SAI_OBJECT_TYPE_SWITCH, ((uint64_t)device_addr << 32) | start_reg_addr, number_of_registers);
+
 #if (SAI_API_VERSION >= SAI_VERSION(1, 11, 0))
-    return m_apis.switch_api->switch_mdio_cl22_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    return _trace.end(m_apis.switch_api->switch_mdio_cl22_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 #else
-    return m_apis.switch_api->switch_mdio_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val);
+    return _trace.end(m_apis.switch_api->switch_mdio_write(switch_id, device_addr, start_reg_addr, number_of_registers, reg_val));
 #endif
 }
 
@@ -1898,16 +2044,18 @@ sai_status_t VendorSai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_globalApis.object_type_get_availability(
+    VENDOR_CALL_TRACE(objectType, switchId, attrCount);
+
+    return _trace.end(m_globalApis.object_type_get_availability(
             switchId,
             objectType,
             attrCount,
             attrList,
-            count);
+            count));
 }
 
 sai_status_t VendorSai::queryAttributeCapability(
@@ -1916,15 +2064,17 @@ sai_status_t VendorSai::queryAttributeCapability(
         _In_ sai_attr_id_t attrId,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_globalApis.query_attribute_capability(
+    VENDOR_CALL_TRACE(objectType, attrId, 1);
+
+    return _trace.end(m_globalApis.query_attribute_capability(
             switchId,
             objectType,
             attrId,
-            capability);
+            capability));
 }
 
 sai_status_t VendorSai::queryAttributeEnumValuesCapability(
@@ -1933,15 +2083,17 @@ sai_status_t VendorSai::queryAttributeEnumValuesCapability(
         _In_ sai_attr_id_t attrId,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
-    return m_globalApis.query_attribute_enum_values_capability(
+    VENDOR_CALL_TRACE(objectType, attrId, 1);
+
+    return _trace.end(m_globalApis.query_attribute_enum_values_capability(
             switchId,
             objectType,
             attrId,
-            enum_values_capability);
+            enum_values_capability));
 }
 
 sai_object_type_t VendorSai::objectTypeQuery(
@@ -1978,7 +2130,7 @@ sai_status_t VendorSai::logSet(
         _In_ sai_api_t api,
         _In_ sai_log_level_t log_level)
 {
-    MUTEX();
+    VendorSaiLockGuard _lock(&m_configLock);
     SWSS_LOG_ENTER();
 
     m_logLevelMap[api] = log_level;
@@ -1997,7 +2149,7 @@ sai_status_t VendorSai::queryApiVersion(
 sai_log_level_t VendorSai::logGet(
         _In_ sai_api_t api)
 {
-    MUTEX();
+    VendorSaiLockGuard _lock(&m_configLock);
     SWSS_LOG_ENTER();
 
     auto it = m_logLevelMap.find(api);
@@ -2011,3 +2163,75 @@ sai_log_level_t VendorSai::logGet(
 
     return SAI_LOG_LEVEL_NOTICE;
 }
+
+std::shared_ptr<VendorSaiCallTrace> VendorSai::getCallTrace() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_callTrace;
+}
+
+std::vector<vendor_sai_lock_stats_t> VendorSai::getLockStats() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<vendor_sai_lock_stats_t> stats;
+
+    switch (m_lockPolicy)
+    {
+        case VENDOR_SAI_LOCK_POLICY_DOMAIN:
+            stats.push_back(m_configLock.getStats());
+            stats.push_back(m_statsLock.getStats());
+            break;
+
+        case VENDOR_SAI_LOCK_POLICY_GLOBAL:
+            stats.push_back(m_configLock.getStats());
+            break;
+
+        default:
+            break;
+    }
+
+    return stats;
+}
+
+void VendorSai::logLockStats() const
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("vendor SAI lock policy: %s", VendorSaiOptions::lockPolicyToString(m_lockPolicy).c_str());
+
+    for (auto& st: getLockStats())
+    {
+        SWSS_LOG_NOTICE("vendor SAI lock %s: acquisitions %" PRIu64 ", contentions %" PRIu64 ", wait %" PRIu64 " us, max wait %" PRIu64 " us",
+                st.name.c_str(),
+                st.acquisitions,
+                st.contentions,
+                st.waitTime / 1000,
+                st.maxWaitTime / 1000);
+    }
+}
+
+VendorSaiLock* VendorSai::getConfigLock()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    return (m_lockPolicy == VENDOR_SAI_LOCK_POLICY_NONE) ? nullptr : &m_configLock;
+}
+
+VendorSaiLock* VendorSai::getStatsLock()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    switch (m_lockPolicy)
+    {
+        case VENDOR_SAI_LOCK_POLICY_NONE:
+            return nullptr;
+
+        case VENDOR_SAI_LOCK_POLICY_DOMAIN:
+            return &m_statsLock;
+
+        default:
+            return &m_configLock;
+    }
+}
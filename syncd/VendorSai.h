@@ -6,10 +6,13 @@ extern "C" {
 
 #include "meta/SaiInterface.h"
 
+#include "VendorSaiCallTrace.h"
+#include "VendorSaiLock.h"
+#include "VendorSaiOptions.h"
+
 #include <string>
 #include <vector>
 #include <memory>
-#include <mutex>
 #include <map>
 
 namespace syncd
@@ -219,11 +222,41 @@ namespace syncd
             virtual sai_log_level_t logGet(
                     _In_ sai_api_t api) override;
 
+        public:
+
+            /**
+             * @brief Get trace of last vendor SAI calls.
+             *
+             * Trace is always on and can be dumped from any thread, also
+             * when vendor call is hanging and API mutex is held.
+             */
+            std::shared_ptr<VendorSaiCallTrace> getCallTrace() const;
+
+            /**
+             * @brief Get contention metrics of vendor SAI locks.
+             *
+             * Depending on lock policy there are zero (none), one (global)
+             * or two (domain) locks in use.
+             */
+            std::vector<vendor_sai_lock_stats_t> getLockStats() const;
+
+            void logLockStats() const;
+
+        private:
+
+            VendorSaiLock* getConfigLock();
+
+            VendorSaiLock* getStatsLock();
+
         private:
 
             bool m_apiInitialized;
 
-            std::mutex m_apimutex;
+            vendor_sai_lock_policy_t m_lockPolicy;
+
+            VendorSaiLock m_configLock;
+
+            VendorSaiLock m_statsLock;
 
             sai_service_method_table_t m_service_method_table;
 
@@ -232,5 +265,7 @@ namespace syncd
             sai_global_apis_t m_globalApis;
 
             std::map<sai_api_t, sai_log_level_t> m_logLevelMap;
+
+            std::shared_ptr<VendorSaiCallTrace> m_callTrace;
     };
 }
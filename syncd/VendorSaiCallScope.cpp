@@ -0,0 +1,39 @@
+#include "VendorSaiCallScope.h"
+
+using namespace syncd;
+
+VendorSaiCallScope::VendorSaiCallScope(
+        _In_ VendorSaiCallTrace& trace,
+        _In_ const char* api,
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t keyHash,
+        _In_ uint32_t objectCount):
+    m_trace(trace),
+    m_ended(false)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_seq = m_trace.begin(api, objectType, keyHash, objectCount);
+}
+
+VendorSaiCallScope::~VendorSaiCallScope()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (!m_ended)
+    {
+        m_trace.end(m_seq, SAI_STATUS_FAILURE);
+    }
+}
+
+sai_status_t VendorSaiCallScope::end(
+        _In_ sai_status_t status)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_trace.end(m_seq, status);
+
+    m_ended = true;
+
+    return status;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "VendorSaiCallTrace.h"
+
+namespace syncd
+{
+    /**
+     * @brief Vendor SAI call scope.
+     *
+     * Begins call on vendor call trace and ends it with status passed to end
+     * (or failure if scope was left by exception).
+     */
+    class VendorSaiCallScope
+    {
+        public:
+
+            VendorSaiCallScope(
+                    _In_ VendorSaiCallTrace& trace,
+                    _In_ const char* api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint64_t keyHash,
+                    _In_ uint32_t objectCount);
+
+            ~VendorSaiCallScope();
+
+        public:
+
+            sai_status_t end(
+                    _In_ sai_status_t status);
+
+        private:
+
+            VendorSaiCallTrace& m_trace;
+
+            uint64_t m_seq;
+
+            bool m_ended;
+    };
+}
@@ -0,0 +1,287 @@
+#include "VendorSaiCallTrace.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/MetaKeyHasher.h"
+
+#include "swss/logger.h"
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include <chrono>
+#include <cinttypes>
+
+using namespace syncd;
+
+constexpr size_t VendorSaiCallTrace::DEFAULT_SIZE;
+
+static uint32_t getThreadId()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    static thread_local uint32_t tid = (uint32_t)syscall(SYS_gettid);
+
+    return tid;
+}
+
+VendorSaiCallTrace::VendorSaiCallTrace(
+        _In_ size_t size):
+    m_size(size ? size : DEFAULT_SIZE),
+    m_slots(new slot_t[m_size]),
+    m_next(0)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < m_size; idx++)
+    {
+        auto& slot = m_slots[idx];
+
+        slot.seq = 0;
+        slot.api = nullptr;
+        slot.objectType = SAI_OBJECT_TYPE_NULL;
+        slot.keyHash = 0;
+        slot.objectCount = 0;
+        slot.threadId = 0;
+        slot.start = 0;
+        slot.duration = 0;
+        slot.status = SAI_STATUS_SUCCESS;
+        slot.inProgress = false;
+    }
+}
+
+uint64_t VendorSaiCallTrace::begin(
+        _In_ const char* api,
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t keyHash,
+        _In_ uint32_t objectCount)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    // sequence numbers start from 1, zero marks slot that is empty or being
+    // written right now
+
+    uint64_t seq = m_next.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    auto& slot = m_slots[seq % m_size];
+
+    slot.seq.store(0, std::memory_order_relaxed);
+
+    // seqlock writer, zero sequence must be visible before any field store,
+    // pairs with acquire fence in getRecords
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.api.store(api, std::memory_order_relaxed);
+    slot.objectType.store(objectType, std::memory_order_relaxed);
+    slot.keyHash.store(keyHash, std::memory_order_relaxed);
+    slot.objectCount.store(objectCount, std::memory_order_relaxed);
+    slot.threadId.store(getThreadId(), std::memory_order_relaxed);
+    slot.duration.store(0, std::memory_order_relaxed);
+    slot.status.store(SAI_STATUS_SUCCESS, std::memory_order_relaxed);
+    slot.inProgress.store(true, std::memory_order_relaxed);
+    slot.start.store(now(), std::memory_order_relaxed);
+
+    slot.seq.store(seq, std::memory_order_release);
+
+    return seq;
+}
+
+void VendorSaiCallTrace::end(
+        _In_ uint64_t seq,
+        _In_ sai_status_t status)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    auto& slot = m_slots[seq % m_size];
+
+    if (slot.seq.load(std::memory_order_relaxed) != seq)
+    {
+        // slot was already reused by newer call
+
+        return;
+    }
+
+    slot.duration.store(now() - slot.start.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    slot.status.store(status, std::memory_order_relaxed);
+    slot.inProgress.store(false, std::memory_order_release);
+}
+
+size_t VendorSaiCallTrace::getSize() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size;
+}
+
+std::vector<vendor_sai_call_record_t> VendorSaiCallTrace::getRecords() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<vendor_sai_call_record_t> records;
+
+    uint64_t last = m_next.load(std::memory_order_acquire);
+
+    uint64_t first = (last > m_size) ? (last - m_size + 1) : 1;
+
+    uint64_t current = now();
+
+    for (uint64_t seq = first; seq <= last; seq++)
+    {
+        auto& slot = m_slots[seq % m_size];
+
+        if (slot.seq.load(std::memory_order_acquire) != seq)
+        {
+            // slot is being written or was already overwritten
+
+            continue;
+        }
+
+        vendor_sai_call_record_t record;
+
+        record.seq = seq;
+        record.api = slot.api.load(std::memory_order_relaxed);
+        record.objectType = (sai_object_type_t)slot.objectType.load(std::memory_order_relaxed);
+        record.keyHash = slot.keyHash.load(std::memory_order_relaxed);
+        record.objectCount = slot.objectCount.load(std::memory_order_relaxed);
+        record.threadId = slot.threadId.load(std::memory_order_relaxed);
+        record.start = slot.start.load(std::memory_order_relaxed);
+        record.inProgress = slot.inProgress.load(std::memory_order_acquire);
+        record.duration = slot.duration.load(std::memory_order_relaxed);
+        record.status = slot.status.load(std::memory_order_relaxed);
+
+        // make sure relaxed loads above are not reordered after second
+        // sequence check, otherwise torn record could be accepted
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.seq.load(std::memory_order_relaxed) != seq)
+        {
+            continue;
+        }
+
+        if (record.inProgress)
+        {
+            record.duration = (current > record.start) ? (current - record.start) : 0;
+        }
+
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+void VendorSaiCallTrace::dump(
+        _In_ const std::string& reason) const
+{
+    SWSS_LOG_ENTER();
+
+    auto records = getRecords();
+
+    SWSS_LOG_NOTICE("vendor SAI call trace (%s): last %zu calls, oldest first", reason.c_str(), records.size());
+
+    uint64_t current = now();
+
+    for (auto& r: records)
+    {
+        auto ot = sai_metadata_get_object_type_name(r.objectType);
+
+        uint64_t ago = (current > r.start) ? (current - r.start) : 0;
+
+        if (r.inProgress)
+        {
+            SWSS_LOG_ERROR("#%" PRIu64 " tid %u %s %s key 0x%" PRIx64 " count %u started %" PRIu64 " us ago, IN PROGRESS for %" PRIu64 " us",
+                    r.seq,
+                    r.threadId,
+                    r.api ? r.api : "?",
+                    ot ? ot : "UNKNOWN",
+                    r.keyHash,
+                    r.objectCount,
+                    ago / 1000,
+                    r.duration / 1000);
+
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("#%" PRIu64 " tid %u %s %s key 0x%" PRIx64 " count %u started %" PRIu64 " us ago, took %" PRIu64 " us, %s",
+                r.seq,
+                r.threadId,
+                r.api ? r.api : "?",
+                ot ? ot : "UNKNOWN",
+                r.keyHash,
+                r.objectCount,
+                ago / 1000,
+                r.duration / 1000,
+                sai_serialize_status(r.status).c_str());
+    }
+}
+
+uint64_t VendorSaiCallTrace::now()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t VendorSaiCallTrace::hash(
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    // FNV-1a, entries are small and we only need to correlate calls on the
+    // same key, not cryptographic strength
+
+    auto ptr = (const uint8_t*)data;
+
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        h ^= ptr[i];
+        h *= 0x100000001b3ULL;
+    }
+
+    return h;
+}
+
+uint64_t VendorSaiCallTrace::hashMetaKey(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    auto info = sai_metadata_get_object_type_info(metaKey.objecttype);
+
+    if (info == nullptr)
+    {
+        return 0;
+    }
+
+    if (!info->isobjectid)
+    {
+        // entries not handled by MetaKeyHasher would throw and log error on
+        // every call, they are traced without key
+
+        switch ((int)metaKey.objecttype)
+        {
+            case SAI_OBJECT_TYPE_FLOW_ENTRY:
+            case SAI_OBJECT_TYPE_METER_BUCKET_ENTRY:
+            case SAI_OBJECT_TYPE_PREFIX_COMPRESSION_ENTRY:
+                return 0;
+
+            default:
+                break;
+        }
+    }
+
+    try
+    {
+        return (uint64_t)saimeta::MetaKeyHasher()(metaKey);
+    }
+    catch (const std::exception&)
+    {
+        // invalid entry, call itself will fail, tracing must not
+
+        return 0;
+    }
+}
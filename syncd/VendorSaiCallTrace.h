@@ -0,0 +1,175 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+#include "saimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Vendor SAI call record.
+     *
+     * Plain copy of single ring buffer slot returned by
+     * VendorSaiCallTrace::getRecords.
+     */
+    typedef struct _vendor_sai_call_record_t
+    {
+        uint64_t seq;
+
+        const char* api;
+
+        sai_object_type_t objectType;
+
+        uint64_t keyHash;
+
+        uint32_t objectCount;
+
+        uint32_t threadId;
+
+        /**
+         * @brief Start time in nanoseconds (steady clock).
+         */
+        uint64_t start;
+
+        /**
+         * @brief Duration in nanoseconds, for call in progress time elapsed
+         * until records were obtained.
+         */
+        uint64_t duration;
+
+        sai_status_t status;
+
+        bool inProgress;
+
+    } vendor_sai_call_record_t;
+
+    /**
+     * @brief Vendor SAI call trace.
+     *
+     * Fixed size ring buffer of last vendor SAI calls. It's always on, each
+     * call is written to preallocated slot using relaxed atomics, so there is
+     * no allocation and no lock. Buffer can be dumped to syslog from any
+     * thread, for example from timer watchdog thread when vendor call hanged,
+     * and call that is still executing will be reported as in progress.
+     */
+    class VendorSaiCallTrace
+    {
+        public:
+
+            static constexpr size_t DEFAULT_SIZE = 1024;
+
+        public:
+
+            VendorSaiCallTrace(
+                    _In_ size_t size = DEFAULT_SIZE);
+
+            virtual ~VendorSaiCallTrace() = default;
+
+        public:
+
+            /**
+             * @brief Begin vendor call.
+             *
+             * Api name must point to static storage, like __func__.
+             *
+             * @return Call sequence number which must be passed to end.
+             */
+            uint64_t begin(
+                    _In_ const char* api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint64_t keyHash,
+                    _In_ uint32_t objectCount);
+
+            void end(
+                    _In_ uint64_t seq,
+                    _In_ sai_status_t status);
+
+            size_t getSize() const;
+
+            /**
+             * @brief Get records in chronological order, oldest first.
+             */
+            std::vector<vendor_sai_call_record_t> getRecords() const;
+
+            /**
+             * @brief Dump records to syslog.
+             */
+            void dump(
+                    _In_ const std::string& reason) const;
+
+        public:
+
+            static uint64_t now();
+
+            static uint64_t hash(
+                    _In_ const void* data,
+                    _In_ size_t size);
+
+            /**
+             * @brief Hash of meta key.
+             *
+             * Entry structures contain padding and unions (IPv4 address in
+             * IP prefix), so their raw bytes can't be hashed, entry fields
+             * are hashed by saimeta::MetaKeyHasher without serialization.
+             */
+            static uint64_t hashMetaKey(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            template <typename T>
+            static uint64_t hashEntry(
+                    _In_ sai_object_type_t objectType,
+                    _In_ const T* entry)
+            {
+                // SWSS_LOG_ENTER(); // disabled
+
+                static_assert(sizeof(T) <= sizeof(sai_object_key_entry_t), "entry must fit into object key");
+
+                if (entry == nullptr)
+                {
+                    return 0;
+                }
+
+                sai_object_meta_key_t mk;
+
+                memset(&mk, 0, sizeof(mk));
+
+                mk.objecttype = objectType;
+
+                memcpy(&mk.objectkey.key, entry, sizeof(T));
+
+                return hashMetaKey(mk);
+            }
+
+        private:
+
+            typedef struct _slot_t
+            {
+                std::atomic<uint64_t> seq;
+                std::atomic<const char*> api;
+                std::atomic<int32_t> objectType;
+                std::atomic<uint64_t> keyHash;
+                std::atomic<uint32_t> objectCount;
+                std::atomic<uint32_t> threadId;
+                std::atomic<uint64_t> start;
+                std::atomic<uint64_t> duration;
+                std::atomic<int32_t> status;
+                std::atomic<bool> inProgress;
+
+            } slot_t;
+
+            size_t m_size;
+
+            std::unique_ptr<slot_t[]> m_slots;
+
+            std::atomic<uint64_t> m_next;
+    };
+}
@@ -0,0 +1,71 @@
+#include "VendorSaiLock.h"
+
+#include "swss/logger.h"
+
+#include <chrono>
+
+using namespace syncd;
+
+VendorSaiLock::VendorSaiLock(
+        _In_ const std::string& name):
+    m_name(name),
+    m_acquisitions(0),
+    m_contentions(0),
+    m_waitTime(0),
+    m_maxWaitTime(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void VendorSaiLock::lock()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+    if (m_mutex.try_lock())
+    {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    m_mutex.lock();
+
+    uint64_t wait = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+    // counters are updated under mutex, so max does not need compare exchange
+
+    m_contentions.fetch_add(1, std::memory_order_relaxed);
+    m_waitTime.fetch_add(wait, std::memory_order_relaxed);
+
+    if (wait > m_maxWaitTime.load(std::memory_order_relaxed))
+    {
+        m_maxWaitTime.store(wait, std::memory_order_relaxed);
+    }
+}
+
+void VendorSaiLock::unlock()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    m_mutex.unlock();
+}
+
+vendor_sai_lock_stats_t VendorSaiLock::getStats() const
+{
+    SWSS_LOG_ENTER();
+
+    vendor_sai_lock_stats_t stats;
+
+    stats.name = m_name;
+    stats.acquisitions = m_acquisitions.load(std::memory_order_relaxed);
+    stats.contentions = m_contentions.load(std::memory_order_relaxed);
+    stats.waitTime = m_waitTime.load(std::memory_order_relaxed);
+    stats.maxWaitTime = m_maxWaitTime.load(std::memory_order_relaxed);
+
+    return stats;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace syncd
+{
+    typedef struct _vendor_sai_lock_stats_t
+    {
+        std::string name;
+
+        uint64_t acquisitions;
+
+        /**
+         * @brief Number of acquisitions which had to wait for lock.
+         */
+        uint64_t contentions;
+
+        /**
+         * @brief Total and max time spent waiting for lock in nanoseconds.
+         */
+        uint64_t waitTime;
+
+        uint64_t maxWaitTime;
+
+    } vendor_sai_lock_stats_t;
+
+    /**
+     * @brief Vendor SAI lock.
+     *
+     * Mutex protecting group of vendor SAI apis with contention metrics.
+     * Uncontended lock costs single try_lock and relaxed counter increment,
+     * time is measured only when lock must be waited for.
+     */
+    class VendorSaiLock
+    {
+        public:
+
+            VendorSaiLock(
+                    _In_ const std::string& name);
+
+            virtual ~VendorSaiLock() = default;
+
+        public:
+
+            void lock();
+
+            void unlock();
+
+            vendor_sai_lock_stats_t getStats() const;
+
+        private:
+
+            std::string m_name;
+
+            std::mutex m_mutex;
+
+            std::atomic<uint64_t> m_acquisitions;
+
+            std::atomic<uint64_t> m_contentions;
+
+            std::atomic<uint64_t> m_waitTime;
+
+            std::atomic<uint64_t> m_maxWaitTime;
+    };
+}
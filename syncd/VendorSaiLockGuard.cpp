@@ -0,0 +1,34 @@
+#include "VendorSaiLockGuard.h"
+
+using namespace syncd;
+
+VendorSaiLockGuard::VendorSaiLockGuard(
+        _In_ VendorSaiLock* lock):
+    m_lock(lock)
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (m_lock)
+    {
+        m_lock->lock();
+    }
+}
+
+VendorSaiLockGuard::~VendorSaiLockGuard()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    unlock();
+}
+
+void VendorSaiLockGuard::unlock()
+{
+    // SWSS_LOG_ENTER(); // disabled
+
+    if (m_lock)
+    {
+        m_lock->unlock();
+
+        m_lock = nullptr;
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "VendorSaiLock.h"
+
+namespace syncd
+{
+    /**
+     * @brief Vendor SAI lock guard.
+     *
+     * Null lock means no locking (lock free pass through policy).
+     */
+    class VendorSaiLockGuard
+    {
+        public:
+
+            VendorSaiLockGuard(
+                    _In_ VendorSaiLock* lock);
+
+            ~VendorSaiLockGuard();
+
+        public:
+
+            void unlock();
+
+        private:
+
+            VendorSaiLock* m_lock;
+    };
+}
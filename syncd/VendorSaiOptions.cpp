@@ -0,0 +1,46 @@
+#include "VendorSaiOptions.h"
+
+#include "swss/logger.h"
+
+using namespace syncd;
+
+vendor_sai_lock_policy_t VendorSaiOptions::lockPolicyFromString(
+        _In_ const std::string& policy)
+{
+    SWSS_LOG_ENTER();
+
+    if (policy == "global")
+        return VENDOR_SAI_LOCK_POLICY_GLOBAL;
+
+    if (policy == "domain")
+        return VENDOR_SAI_LOCK_POLICY_DOMAIN;
+
+    if (policy == "none")
+        return VENDOR_SAI_LOCK_POLICY_NONE;
+
+    SWSS_LOG_THROW("unknown vendor SAI lock policy '%s'", policy.c_str());
+}
+
+std::string VendorSaiOptions::lockPolicyToString(
+        _In_ vendor_sai_lock_policy_t policy)
+{
+    SWSS_LOG_ENTER();
+
+    switch (policy)
+    {
+        case VENDOR_SAI_LOCK_POLICY_GLOBAL:
+            return "global";
+
+        case VENDOR_SAI_LOCK_POLICY_DOMAIN:
+            return "domain";
+
+        case VENDOR_SAI_LOCK_POLICY_NONE:
+            return "none";
+
+        default:
+
+            SWSS_LOG_WARN("unknown vendor SAI lock policy %d", policy);
+
+            return "unknown";
+    }
+}
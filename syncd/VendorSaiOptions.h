@@ -2,16 +2,64 @@
 
 #include "meta/SaiOptions.h"
 
+#include "swss/sal.h"
+
+#include <string>
+
 namespace syncd
 {
+    typedef enum _vendor_sai_lock_policy_t
+    {
+        /**
+         * @brief Single lock for all vendor SAI calls (default).
+         */
+        VENDOR_SAI_LOCK_POLICY_GLOBAL,
+
+        /**
+         * @brief Separate locks for configuration and stats/query calls.
+         *
+         * Stats and capability queries (mostly executed from flex counter
+         * threads) will not block configuration calls from main thread and
+         * vice versa. Vendor SAI must support concurrent calls from those
+         * two domains.
+         */
+        VENDOR_SAI_LOCK_POLICY_DOMAIN,
+
+        /**
+         * @brief No lock, calls are passed directly to vendor SAI.
+         *
+         * Vendor SAI must be fully thread safe.
+         */
+        VENDOR_SAI_LOCK_POLICY_NONE,
+
+    } vendor_sai_lock_policy_t;
+
     class VendorSaiOptions:
         public sairedis::SaiOptions
     {
         public:
             static constexpr const char *OPTIONS_KEY = "vok";
 
+        public:
+
+            /**
+             * @brief Convert lock policy name (global|domain|none) to policy.
+             *
+             * Throws on unknown name.
+             */
+            static vendor_sai_lock_policy_t lockPolicyFromString(
+                    _In_ const std::string& policy);
+
+            static std::string lockPolicyToString(
+                    _In_ vendor_sai_lock_policy_t policy);
+
         public:
 
             bool m_checkAttrVersion = false;
+
+            /**
+             * @brief Lock policy, applied on api initialize.
+             */
+            vendor_sai_lock_policy_t m_lockPolicy = VENDOR_SAI_LOCK_POLICY_GLOBAL;
     };
 }
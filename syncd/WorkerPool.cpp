@@ -0,0 +1,183 @@
+#include "WorkerPool.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace syncd;
+
+WorkerPool::WorkerPool(
+        _In_ size_t workerCount):
+    m_run(true),
+    m_generation(0),
+    m_begin(0),
+    m_end(0),
+    m_pending(0),
+    m_busy(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (workerCount == 0)
+    {
+        SWSS_LOG_THROW("worker count must be positive");
+    }
+
+    for (size_t worker = 0; worker < workerCount; worker++)
+    {
+        m_threads.push_back(std::make_shared<std::thread>(&WorkerPool::threadFunction, this, worker));
+    }
+
+    SWSS_LOG_NOTICE("started worker pool with %zu workers", workerCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_run = false;
+    }
+
+    m_cvJob.notify_all();
+
+    for (auto& thread: m_threads)
+    {
+        thread->join();
+    }
+}
+
+size_t WorkerPool::getWorkerCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_threads.size();
+}
+
+std::map<size_t, std::exception_ptr> WorkerPool::run(
+        _In_ size_t begin,
+        _In_ size_t end,
+        _In_ const std::function<void(size_t index, size_t worker)>& fn)
+{
+    SWSS_LOG_ENTER();
+
+    start(begin, end, fn);
+
+    return wait();
+}
+
+void WorkerPool::start(
+        _In_ size_t begin,
+        _In_ size_t end,
+        _In_ const std::function<void(size_t index, size_t worker)>& fn)
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // only one range can be executed at a time
+
+    m_cvDone.wait(lock, [&]{ return !m_busy; });
+
+    m_busy = true;
+    m_begin = begin;
+    m_end = std::max(begin, end);
+    m_fn = fn;
+    m_pending = m_threads.size();
+    m_errors.clear();
+    m_generation++;
+
+    m_cvJob.notify_all();
+}
+
+std::map<size_t, std::exception_ptr> WorkerPool::wait()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (!m_busy)
+    {
+        SWSS_LOG_THROW("no range was started");
+    }
+
+    m_cvDone.wait(lock, [&]{ return m_pending == 0; });
+
+    m_busy = false;
+    m_fn = nullptr;
+
+    auto errors = std::move(m_errors);
+
+    m_errors.clear();
+
+    // wake up other thread waiting in start
+
+    m_cvDone.notify_all();
+
+    return errors;
+}
+
+void WorkerPool::threadFunction(
+        _In_ size_t worker)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        size_t begin;
+        size_t end;
+
+        std::function<void(size_t, size_t)> fn;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cvJob.wait(lock, [&]{ return !m_run || m_generation != generation; });
+
+            if (!m_run)
+            {
+                break;
+            }
+
+            generation = m_generation;
+
+            // contiguous part of range assigned to this worker
+
+            size_t count = m_end - m_begin;
+            size_t workers = m_threads.size();
+
+            begin = m_begin + count * worker / workers;
+            end = m_begin + count * (worker + 1) / workers;
+
+            fn = m_fn;
+        }
+
+        std::map<size_t, std::exception_ptr> errors;
+
+        for (size_t index = begin; index < end; index++)
+        {
+            try
+            {
+                fn(index, worker);
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_errors.insert(errors.begin(), errors.end());
+
+            if (--m_pending == 0)
+            {
+                m_cvDone.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace syncd
+{
+    /**
+     * @brief Worker pool.
+     *
+     * Executes function on range of indexes in parallel on fixed number of
+     * worker threads. Range is split into contiguous parts, one per worker,
+     * so each index is always processed by the same worker and function can
+     * use worker index to select per worker state without locking.
+     *
+     * Only one range can be executed at a time.
+     */
+    class WorkerPool
+    {
+        public:
+
+            WorkerPool(
+                    _In_ size_t workerCount);
+
+            virtual ~WorkerPool();
+
+        public:
+
+            size_t getWorkerCount() const;
+
+            /**
+             * @brief Execute function for each index in range [begin, end).
+             *
+             * Blocks until all indexes are processed. Exception thrown by
+             * function is caught per index and processing of remaining
+             * indexes continues.
+             *
+             * @return Exceptions thrown by function ordered by index.
+             */
+            std::map<size_t, std::exception_ptr> run(
+                    _In_ size_t begin,
+                    _In_ size_t end,
+                    _In_ const std::function<void(size_t index, size_t worker)>& fn);
+
+            /**
+             * @brief Start executing function for each index in range [begin, end).
+             *
+             * Returns without waiting for range to be processed, so caller
+             * can do other work meanwhile. Each start must be followed by
+             * wait, if other range is being executed, waits for it first.
+             */
+            void start(
+                    _In_ size_t begin,
+                    _In_ size_t end,
+                    _In_ const std::function<void(size_t index, size_t worker)>& fn);
+
+            /**
+             * @brief Wait until range started by start is processed.
+             *
+             * @return Exceptions thrown by function ordered by index.
+             */
+            std::map<size_t, std::exception_ptr> wait();
+
+        private:
+
+            WorkerPool(const WorkerPool&);
+            WorkerPool& operator=(const WorkerPool&);
+
+            void threadFunction(
+                    _In_ size_t worker);
+
+        private:
+
+            std::vector<std::shared_ptr<std::thread>> m_threads;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cvJob;
+
+            std::condition_variable m_cvDone;
+
+            bool m_run;
+
+            /**
+             * @brief Incremented on each run, workers compare it with last
+             * executed generation to detect new job.
+             */
+            uint64_t m_generation;
+
+            size_t m_begin;
+
+            size_t m_end;
+
+            std::function<void(size_t, size_t)> m_fn;
+
+            size_t m_pending;
+
+            std::map<size_t, std::exception_ptr> m_errors;
+
+            /**
+             * @brief Indicates that range was started and not yet waited for.
+             */
+            bool m_busy;
+    };
+}
@@ -0,0 +1,121 @@
+#include "BenchmarkResult.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+BenchmarkResult::BenchmarkResult(
+        _In_ const std::string& name):
+    m_name(name),
+    m_ops(0),
+    m_samplesDuration(0),
+    m_duration(0),
+    m_params(nlohmann::json::object())
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void BenchmarkResult::addSample(
+        _In_ uint64_t usec,
+        _In_ uint32_t ops)
+{
+    SWSS_LOG_ENTER();
+
+    m_samples.push_back(usec);
+
+    m_ops += ops;
+
+    m_samplesDuration += usec;
+}
+
+void BenchmarkResult::addSample(
+        _In_ const std::chrono::steady_clock::time_point& start,
+        _In_ const std::chrono::steady_clock::time_point& end,
+        _In_ uint32_t ops)
+{
+    SWSS_LOG_ENTER();
+
+    auto usec = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    addSample((uint64_t)usec, ops);
+}
+
+void BenchmarkResult::setDuration(
+        _In_ uint64_t usec)
+{
+    SWSS_LOG_ENTER();
+
+    m_duration = usec;
+}
+
+void BenchmarkResult::setParam(
+        _In_ const std::string& name,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    m_params[name] = value;
+}
+
+uint64_t BenchmarkResult::getPercentile(
+        _In_ double percentile) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_samples.empty())
+    {
+        return 0;
+    }
+
+    auto sorted = m_samples;
+
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t rank = (size_t)std::ceil(percentile / 100.0 * (double)sorted.size());
+
+    rank = std::min(std::max(rank, (size_t)1), sorted.size());
+
+    return sorted[rank - 1];
+}
+
+double BenchmarkResult::getOpsPerSec() const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t duration = m_duration ? m_duration : m_samplesDuration;
+
+    if (duration == 0)
+    {
+        return 0;
+    }
+
+    return (double)m_ops * 1000000.0 / (double)duration;
+}
+
+nlohmann::json BenchmarkResult::toJson() const
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json j;
+
+    j["name"] = m_name;
+    j["params"] = m_params;
+    j["calls"] = m_samples.size();
+    j["ops"] = m_ops;
+    j["duration_us"] = m_duration ? m_duration : m_samplesDuration;
+    j["ops_per_sec"] = getOpsPerSec();
+
+    nlohmann::json latency;
+
+    latency["min"] = getPercentile(0);
+    latency["p50"] = getPercentile(50);
+    latency["p99"] = getPercentile(99);
+    latency["max"] = getPercentile(100);
+
+    j["latency_us"] = latency;
+
+    return j;
+}
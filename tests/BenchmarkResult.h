@@ -0,0 +1,76 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Benchmark result.
+ *
+ * Collects duration of each measured call in microseconds together with
+ * number of SAI operations executed by that call (1 for single API, bulk size
+ * for bulk API), and reports throughput and latency percentiles as JSON.
+ */
+class BenchmarkResult
+{
+    public:
+
+        BenchmarkResult(
+                _In_ const std::string& name);
+
+        virtual ~BenchmarkResult() = default;
+
+    public:
+
+        void addSample(
+                _In_ uint64_t usec,
+                _In_ uint32_t ops);
+
+        void addSample(
+                _In_ const std::chrono::steady_clock::time_point& start,
+                _In_ const std::chrono::steady_clock::time_point& end,
+                _In_ uint32_t ops);
+
+        /**
+         * @brief Set wall clock time of whole scenario.
+         *
+         * If not set, sum of all samples is used to compute throughput.
+         */
+        void setDuration(
+                _In_ uint64_t usec);
+
+        void setParam(
+                _In_ const std::string& name,
+                _In_ uint64_t value);
+
+        /**
+         * @brief Returns latency percentile in microseconds.
+         *
+         * Percentile is in range <0..100>, nearest rank method is used.
+         */
+        uint64_t getPercentile(
+                _In_ double percentile) const;
+
+        double getOpsPerSec() const;
+
+        nlohmann::json toJson() const;
+
+    private:
+
+        std::string m_name;
+
+        std::vector<uint64_t> m_samples;
+
+        uint64_t m_ops;
+
+        uint64_t m_samplesDuration;
+
+        uint64_t m_duration;
+
+        nlohmann::json m_params;
+};
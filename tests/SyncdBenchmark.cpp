@@ -0,0 +1,1099 @@
+#include "SyncdBenchmark.h"
+
+#include "syncd/Syncd.h"
+#include "syncd/VendorSai.h"
+#include "syncd/MetadataLogger.h"
+#include "syncd/RequestShutdown.h"
+#include "syncd/RedisNotificationProducer.h"
+#include "syncd/ZeroMQNotificationProducer.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/dbconnector.h"
+#include "swss/redisreply.h"
+#include "swss/logger.h"
+
+#include <arpa/inet.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+
+using namespace syncd;
+using namespace std::chrono;
+
+#define ASSERT_SUCCESS(x) \
+{\
+    sai_status_t _status = (x);\
+    if (_status != SAI_STATUS_SUCCESS)\
+    {\
+        SWSS_LOG_THROW("expected success, line: %d, got: %s", __LINE__, sai_serialize_status(_status).c_str());\
+    }\
+}
+
+#define FDB_NOTIFICATION_TIMEOUT_SEC 60
+
+// default zmq notification endpoint, see lib/ContextConfig.cpp
+#define ZMQ_NTF_ENDPOINT "ipc:///tmp/zmq_ntf_ep"
+
+static std::atomic<uint32_t> g_fdbEventCount;
+
+static std::vector<steady_clock::time_point> g_fdbEventTimes;
+
+static void onFdbEvent(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t *data)
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t index = g_fdbEventCount++;
+
+        if (index < g_fdbEventTimes.size())
+        {
+            g_fdbEventTimes[index] = steady_clock::now();
+        }
+    }
+}
+
+static const char* profileGetValue(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    return NULL;
+}
+
+static int profileGetNextValue(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    return -1;
+}
+
+static sai_service_method_table_t benchmark_services = {
+    profileGetValue,
+    profileGetNextValue
+};
+
+static void setS8List(
+        _Out_ sai_s8_list_t& list,
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    list.count = (uint32_t)str.size();
+    list.list = (int8_t*)const_cast<char*>(str.c_str());
+}
+
+SyncdBenchmarkOptions::SyncdBenchmarkOptions()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 10000;
+    m_bulkSize = 1000;
+    m_iterations = 3;
+    m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+    m_externalSyncd = false;
+    m_profileMapFile = "./BCM56850/vsprofile.ini";
+}
+
+SyncdBenchmark::SyncdBenchmark(
+        _In_ std::shared_ptr<SyncdBenchmarkOptions> options):
+    m_options(options),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_vr(SAI_NULL_OBJECT_ID),
+    m_rif(SAI_NULL_OBJECT_ID),
+    m_defaultVlan(SAI_NULL_OBJECT_ID),
+    m_bridgePort(SAI_NULL_OBJECT_ID)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_options->m_bulkSize == 0)
+    {
+        SWSS_LOG_THROW("bulk size must be positive");
+    }
+}
+
+SyncdBenchmark::~SyncdBenchmark()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::vector<std::string> SyncdBenchmark::getScenarios()
+{
+    SWSS_LOG_ENTER();
+
+    return {
+        "route",
+        "route_bulk",
+        "neighbor",
+        "neighbor_bulk",
+        "next_hop",
+        "next_hop_bulk",
+        "next_hop_group_member_bulk",
+        "fdb_notification",
+        "apply_view",
+        "flex_counter",
+    };
+}
+
+void SyncdBenchmark::syncdWorkerThread()
+{
+    SWSS_LOG_ENTER();
+
+    MetadataLogger::initialize();
+
+    auto vendorSai = std::make_shared<VendorSai>();
+    auto commandLineOptions = std::make_shared<CommandLineOptions>();
+
+    commandLineOptions->m_enableTempView = true;
+    commandLineOptions->m_disableExitSleep = true;
+    commandLineOptions->m_enableSaiBulkSupport = true;
+    commandLineOptions->m_startType = SAI_START_TYPE_COLD_BOOT;
+    commandLineOptions->m_redisCommunicationMode = m_options->m_redisCommunicationMode;
+    commandLineOptions->m_profileMapFile = m_options->m_profileMapFile;
+
+    auto syncd = std::make_shared<Syncd>(vendorSai, commandLineOptions, false);
+
+    // syncd can override communication mode from options (e.g. deprecated
+    // sync mode flag), results would then be reported for wrong mode
+
+    if (commandLineOptions->m_redisCommunicationMode != m_options->m_redisCommunicationMode)
+    {
+        SWSS_LOG_THROW("syncd runs in %s mode instead of requested %s mode",
+                sai_serialize_redis_communication_mode(commandLineOptions->m_redisCommunicationMode).c_str(),
+                sai_serialize_redis_communication_mode(m_options->m_redisCommunicationMode).c_str());
+    }
+
+    syncd->run();
+
+    SWSS_LOG_NOTICE("syncd worker finished");
+}
+
+void SyncdBenchmark::setup()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_options->m_externalSyncd)
+    {
+        swss::DBConnector db("ASIC_DB", 0);
+
+        swss::RedisReply r(&db, "FLUSHDB", REDIS_REPLY_STATUS);
+
+        r.checkStatusOK();
+
+        m_worker = std::make_shared<std::thread>(&SyncdBenchmark::syncdWorkerThread, this);
+    }
+
+    m_sairedis = std::make_shared<sairedis::Sai>();
+
+    ASSERT_SUCCESS(m_sairedis->apiInitialize(0, &benchmark_services));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = m_options->m_redisCommunicationMode;
+
+    ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORD;
+    attr.value.booldata = false;
+
+    ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    notifySyncd(SAI_REDIS_NOTIFY_SYNCD_INIT_VIEW);
+
+    createBaseObjects();
+
+    notifySyncd(SAI_REDIS_NOTIFY_SYNCD_APPLY_VIEW);
+}
+
+void SyncdBenchmark::teardown()
+{
+    SWSS_LOG_ENTER();
+
+    ASSERT_SUCCESS(m_sairedis->apiUninitialize());
+
+    m_sairedis = nullptr;
+
+    if (m_worker)
+    {
+        auto opt = std::make_shared<RequestShutdownCommandLineOptions>();
+
+        opt->setRestartType(SYNCD_RESTART_TYPE_COLD);
+
+        RequestShutdown(opt).send();
+
+        m_worker->join();
+
+        m_worker = nullptr;
+    }
+}
+
+void SyncdBenchmark::notifySyncd(
+        _In_ sai_redis_notify_syncd_t op)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_NOTIFY_SYNCD;
+    attr.value.s32 = op;
+
+    ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+}
+
+void SyncdBenchmark::createBaseObjects()
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attrs[0].value.booldata = true;
+
+    attrs[1].id = SAI_SWITCH_ATTR_FDB_EVENT_NOTIFY;
+    attrs[1].value.ptr = (void*)&onFdbEvent;
+
+    ASSERT_SUCCESS(m_sairedis->create(SAI_OBJECT_TYPE_SWITCH, &m_switchId, SAI_NULL_OBJECT_ID, 2, attrs));
+
+    attrs[0].id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+    attrs[1].id = SAI_SWITCH_ATTR_DEFAULT_VLAN_ID;
+
+    ASSERT_SUCCESS(m_sairedis->get(SAI_OBJECT_TYPE_SWITCH, m_switchId, 2, attrs));
+
+    m_vr = attrs[0].value.oid;
+    m_defaultVlan = attrs[1].value.oid;
+
+    attrs[0].id = SAI_SWITCH_ATTR_PORT_NUMBER;
+
+    ASSERT_SUCCESS(m_sairedis->get(SAI_OBJECT_TYPE_SWITCH, m_switchId, 1, attrs));
+
+    m_ports.resize(attrs[0].value.u32);
+
+    attrs[0].id = SAI_SWITCH_ATTR_PORT_LIST;
+    attrs[0].value.objlist.count = (uint32_t)m_ports.size();
+    attrs[0].value.objlist.list = m_ports.data();
+
+    ASSERT_SUCCESS(m_sairedis->get(SAI_OBJECT_TYPE_SWITCH, m_switchId, 1, attrs));
+
+    attrs[0].id = SAI_SWITCH_ATTR_DEFAULT_1Q_BRIDGE_ID;
+
+    ASSERT_SUCCESS(m_sairedis->get(SAI_OBJECT_TYPE_SWITCH, m_switchId, 1, attrs));
+
+    sai_object_id_t bridge = attrs[0].value.oid;
+
+    std::vector<sai_object_id_t> bridgePorts(m_ports.size() + 1);
+
+    attrs[0].id = SAI_BRIDGE_ATTR_PORT_LIST;
+    attrs[0].value.objlist.count = (uint32_t)bridgePorts.size();
+    attrs[0].value.objlist.list = bridgePorts.data();
+
+    ASSERT_SUCCESS(m_sairedis->get(SAI_OBJECT_TYPE_BRIDGE, bridge, 1, attrs));
+
+    m_bridgePort = attrs[0].value.objlist.count ? bridgePorts[0] : SAI_NULL_OBJECT_ID;
+
+    // loopback router interface, used by neighbors, next hops and routes
+
+    attrs[0].id = SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID;
+    attrs[0].value.oid = m_vr;
+
+    attrs[1].id = SAI_ROUTER_INTERFACE_ATTR_TYPE;
+    attrs[1].value.s32 = SAI_ROUTER_INTERFACE_TYPE_LOOPBACK;
+
+    ASSERT_SUCCESS(m_sairedis->create(SAI_OBJECT_TYPE_ROUTER_INTERFACE, &m_rif, m_switchId, 2, attrs));
+}
+
+std::vector<sai_route_entry_t> SyncdBenchmark::makeRoutes(
+        _In_ uint32_t count) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_route_entry_t> routes(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto& route = routes[i];
+
+        memset(&route, 0, sizeof(route));
+
+        route.switch_id = m_switchId;
+        route.vr_id = m_vr;
+        route.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route.destination.addr.ip4 = htonl(0x14000000 + i); // 20.0.0.0/8
+        route.destination.mask.ip4 = htonl(0xffffffff);
+    }
+
+    return routes;
+}
+
+std::vector<sai_neighbor_entry_t> SyncdBenchmark::makeNeighbors(
+        _In_ uint32_t count) const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_neighbor_entry_t> neighbors(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto& neighbor = neighbors[i];
+
+        memset(&neighbor, 0, sizeof(neighbor));
+
+        neighbor.switch_id = m_switchId;
+        neighbor.rif_id = m_rif;
+        neighbor.ip_address.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        neighbor.ip_address.addr.ip4 = htonl(0x1e000000 + i); // 30.0.0.0/8
+    }
+
+    return neighbors;
+}
+
+BenchmarkResult& SyncdBenchmark::addResult(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    m_results.emplace_back(name);
+
+    auto& result = m_results.back();
+
+    result.setParam("count", m_options->m_count);
+    result.setParam("bulk_size", m_options->m_bulkSize);
+
+    return result;
+}
+
+void SyncdBenchmark::benchRoutes(
+        _In_ bool bulk)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = m_options->m_count;
+    uint32_t bulkSize = bulk ? m_options->m_bulkSize : 1;
+
+    auto routes = makeRoutes(count);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attr.value.oid = m_rif;
+
+    std::vector<uint32_t> attrCount(bulkSize, 1);
+    std::vector<const sai_attribute_t*> attrList(bulkSize, &attr);
+    std::vector<sai_status_t> statuses(bulkSize);
+
+    std::string prefix = bulk ? "route_bulk" : "route";
+
+    m_results.reserve(m_results.size() + 2);
+
+    auto& create = addResult(prefix + "_create");
+    auto& remove = addResult(prefix + "_remove");
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkCreate(n, &routes[i], attrCount.data(), attrList.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->create(&routes[i], 1, &attr));
+        }
+
+        create.addSample(start, steady_clock::now(), n);
+    }
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkRemove(n, &routes[i], SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->remove(&routes[i]));
+        }
+
+        remove.addSample(start, steady_clock::now(), n);
+    }
+}
+
+void SyncdBenchmark::benchNeighbors(
+        _In_ bool bulk)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = m_options->m_count;
+    uint32_t bulkSize = bulk ? m_options->m_bulkSize : 1;
+
+    auto neighbors = makeNeighbors(count);
+
+    sai_attribute_t attr;
+
+    sai_mac_t mac = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+    attr.id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+    memcpy(attr.value.mac, mac, sizeof(sai_mac_t));
+
+    std::vector<uint32_t> attrCount(bulkSize, 1);
+    std::vector<const sai_attribute_t*> attrList(bulkSize, &attr);
+    std::vector<sai_status_t> statuses(bulkSize);
+
+    std::string prefix = bulk ? "neighbor_bulk" : "neighbor";
+
+    m_results.reserve(m_results.size() + 2);
+
+    auto& create = addResult(prefix + "_create");
+    auto& remove = addResult(prefix + "_remove");
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkCreate(n, &neighbors[i], attrCount.data(), attrList.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->create(&neighbors[i], 1, &attr));
+        }
+
+        create.addSample(start, steady_clock::now(), n);
+    }
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkRemove(n, &neighbors[i], SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->remove(&neighbors[i]));
+        }
+
+        remove.addSample(start, steady_clock::now(), n);
+    }
+}
+
+void SyncdBenchmark::benchNextHops(
+        _In_ bool bulk)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = m_options->m_count;
+    uint32_t bulkSize = bulk ? m_options->m_bulkSize : 1;
+
+    std::vector<std::array<sai_attribute_t, 3>> attrs(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        attrs[i][0].id = SAI_NEXT_HOP_ATTR_TYPE;
+        attrs[i][0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+        attrs[i][1].id = SAI_NEXT_HOP_ATTR_IP;
+        attrs[i][1].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        attrs[i][1].value.ipaddr.addr.ip4 = htonl(0x28000000 + i); // 40.0.0.0/8
+
+        attrs[i][2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+        attrs[i][2].value.oid = m_rif;
+    }
+
+    std::vector<sai_object_id_t> nextHops(count, SAI_NULL_OBJECT_ID);
+    std::vector<uint32_t> attrCount(bulkSize, 3);
+    std::vector<const sai_attribute_t*> attrList(bulkSize);
+    std::vector<sai_status_t> statuses(bulkSize);
+
+    std::string prefix = bulk ? "next_hop_bulk" : "next_hop";
+
+    m_results.reserve(m_results.size() + 2);
+
+    auto& create = addResult(prefix + "_create");
+    auto& remove = addResult(prefix + "_remove");
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        for (uint32_t j = 0; j < n; j++)
+        {
+            attrList[j] = attrs[i + j].data();
+        }
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkCreate(SAI_OBJECT_TYPE_NEXT_HOP, m_switchId, n, attrCount.data(), attrList.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &nextHops[i], statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->create(SAI_OBJECT_TYPE_NEXT_HOP, &nextHops[i], m_switchId, 3, attrList[0]));
+        }
+
+        create.addSample(start, steady_clock::now(), n);
+    }
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        if (bulk)
+        {
+            ASSERT_SUCCESS(m_sairedis->bulkRemove(SAI_OBJECT_TYPE_NEXT_HOP, n, &nextHops[i],
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+        else
+        {
+            ASSERT_SUCCESS(m_sairedis->remove(SAI_OBJECT_TYPE_NEXT_HOP, nextHops[i]));
+        }
+
+        remove.addSample(start, steady_clock::now(), n);
+    }
+}
+
+/*
+ * Members of single next hop group are created in bulk, which is the case
+ * of large ECMP groups. Next hops and group are created before measurement.
+ */
+void SyncdBenchmark::benchNextHopGroupMembers()
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = m_options->m_count;
+    uint32_t bulkSize = m_options->m_bulkSize;
+
+    std::vector<std::array<sai_attribute_t, 3>> attrs(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        attrs[i][0].id = SAI_NEXT_HOP_ATTR_TYPE;
+        attrs[i][0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+        attrs[i][1].id = SAI_NEXT_HOP_ATTR_IP;
+        attrs[i][1].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        attrs[i][1].value.ipaddr.addr.ip4 = htonl(0x32000000 + i); // 50.0.0.0/8
+
+        attrs[i][2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+        attrs[i][2].value.oid = m_rif;
+    }
+
+    std::vector<sai_object_id_t> nextHops(count, SAI_NULL_OBJECT_ID);
+    std::vector<sai_object_id_t> members(count, SAI_NULL_OBJECT_ID);
+    std::vector<uint32_t> attrCount(bulkSize, 3);
+    std::vector<const sai_attribute_t*> attrList(bulkSize);
+    std::vector<sai_status_t> statuses(bulkSize);
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        for (uint32_t j = 0; j < n; j++)
+        {
+            attrList[j] = attrs[i + j].data();
+        }
+
+        ASSERT_SUCCESS(m_sairedis->bulkCreate(SAI_OBJECT_TYPE_NEXT_HOP, m_switchId, n, attrCount.data(), attrList.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &nextHops[i], statuses.data()));
+    }
+
+    sai_object_id_t group;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_NEXT_HOP_GROUP_ATTR_TYPE;
+    attr.value.s32 = SAI_NEXT_HOP_GROUP_TYPE_ECMP;
+
+    ASSERT_SUCCESS(m_sairedis->create(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, &group, m_switchId, 1, &attr));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        attrs[i][0].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+        attrs[i][0].value.oid = group;
+
+        attrs[i][1].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        attrs[i][1].value.oid = nextHops[i];
+
+        attrs[i][2].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
+        attrs[i][2].value.u32 = 1 + i % 8;
+    }
+
+    m_results.reserve(m_results.size() + 2);
+
+    auto& create = addResult("next_hop_group_member_bulk_create");
+    auto& remove = addResult("next_hop_group_member_bulk_remove");
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        for (uint32_t j = 0; j < n; j++)
+        {
+            attrList[j] = attrs[i + j].data();
+        }
+
+        auto start = steady_clock::now();
+
+        ASSERT_SUCCESS(m_sairedis->bulkCreate(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, m_switchId, n, attrCount.data(), attrList.data(),
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &members[i], statuses.data()));
+
+        create.addSample(start, steady_clock::now(), n);
+    }
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        auto start = steady_clock::now();
+
+        ASSERT_SUCCESS(m_sairedis->bulkRemove(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, n, &members[i],
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+
+        remove.addSample(start, steady_clock::now(), n);
+    }
+
+    ASSERT_SUCCESS(m_sairedis->remove(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, group));
+
+    for (uint32_t i = 0; i < count; i += bulkSize)
+    {
+        uint32_t n = std::min(bulkSize, count - i);
+
+        ASSERT_SUCCESS(m_sairedis->bulkRemove(SAI_OBJECT_TYPE_NEXT_HOP, n, &nextHops[i],
+                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+    }
+}
+
+/*
+ * FDB notifications are injected into the same notification channel syncd
+ * uses to deliver them to the client, since virtual switch learns only from
+ * packets on tap devices. This measures delivery, deserialization, metadata
+ * processing and callback on the client side.
+ */
+void SyncdBenchmark::benchFdbNotifications()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_options->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_SHM_SYNC)
+    {
+        // shm notification ring has single producer, which is owned by syncd
+
+        SWSS_LOG_WARN("fdb notification scenario is not supported in shm sync mode, skipping");
+
+        return;
+    }
+
+    uint32_t count = m_options->m_count;
+
+    std::shared_ptr<NotificationProducerBase> producer;
+
+    if (m_options->m_redisCommunicationMode == SAI_REDIS_COMMUNICATION_MODE_ZMQ_SYNC)
+    {
+        producer = std::make_shared<ZeroMQNotificationProducer>(ZMQ_NTF_ENDPOINT);
+    }
+    else
+    {
+        producer = std::make_shared<RedisNotificationProducer>("ASIC_DB");
+    }
+
+    std::vector<steady_clock::time_point> sendTimes(count);
+
+    g_fdbEventTimes.assign(count, steady_clock::time_point());
+    g_fdbEventCount = 0;
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    attrs[1].value.oid = m_bridgePort;
+
+    sai_fdb_event_notification_data_t data;
+
+    memset(&data, 0, sizeof(data));
+
+    data.event_type = SAI_FDB_EVENT_LEARNED;
+    data.fdb_entry.switch_id = m_switchId;
+    data.fdb_entry.bv_id = m_defaultVlan;
+    data.attr_count = 2;
+    data.attr = attrs;
+
+    auto start = steady_clock::now();
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        data.fdb_entry.mac_address[0] = 0x02; // locally administered
+        data.fdb_entry.mac_address[3] = (uint8_t)(i >> 16);
+        data.fdb_entry.mac_address[4] = (uint8_t)(i >> 8);
+        data.fdb_entry.mac_address[5] = (uint8_t)i;
+
+        auto s = sai_serialize_fdb_event_ntf(1, &data);
+
+        sendTimes[i] = steady_clock::now();
+
+        producer->send(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s, {});
+    }
+
+    auto deadline = steady_clock::now() + seconds(FDB_NOTIFICATION_TIMEOUT_SEC);
+
+    while (g_fdbEventCount < count && steady_clock::now() < deadline)
+    {
+        usleep(1000);
+    }
+
+    uint32_t received = std::min((uint32_t)g_fdbEventCount, count);
+
+    if (received < count)
+    {
+        SWSS_LOG_WARN("received only %u out of %u fdb notifications", received, count);
+    }
+
+    auto& result = addResult("fdb_notification");
+
+    result.setParam("received", received);
+
+    for (uint32_t i = 0; i < received; i++)
+    {
+        result.addSample(sendTimes[i], g_fdbEventTimes[i], 1);
+    }
+
+    if (received)
+    {
+        result.setDuration((uint64_t)duration_cast<microseconds>(g_fdbEventTimes[received - 1] - start).count());
+    }
+}
+
+/*
+ * First apply view populates switch with next hops and routes, following
+ * apply views with the same content measure comparison logic only.
+ */
+void SyncdBenchmark::benchApplyView()
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t count = m_options->m_count;
+    uint32_t bulkSize = m_options->m_bulkSize;
+
+    m_results.reserve(m_results.size() + 3);
+
+    auto& populate = addResult("apply_view_populate");
+    auto& reconcile = addResult("apply_view_reconcile");
+    auto& cleanup = addResult("apply_view_cleanup");
+
+    reconcile.setParam("iterations", m_options->m_iterations);
+
+    for (uint32_t it = 0; it <= m_options->m_iterations; it++)
+    {
+        notifySyncd(SAI_REDIS_NOTIFY_SYNCD_INIT_VIEW);
+
+        createBaseObjects();
+
+        std::vector<sai_object_id_t> nextHops(count);
+        std::vector<std::array<sai_attribute_t, 3>> nhAttrs(count);
+        std::vector<sai_attribute_t> routeAttrs(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            nhAttrs[i][0].id = SAI_NEXT_HOP_ATTR_TYPE;
+            nhAttrs[i][0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+            nhAttrs[i][1].id = SAI_NEXT_HOP_ATTR_IP;
+            nhAttrs[i][1].value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            nhAttrs[i][1].value.ipaddr.addr.ip4 = htonl(0x28000000 + i);
+
+            nhAttrs[i][2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+            nhAttrs[i][2].value.oid = m_rif;
+        }
+
+        auto routes = makeRoutes(count);
+
+        std::vector<uint32_t> attrCount(bulkSize);
+        std::vector<const sai_attribute_t*> attrList(bulkSize);
+        std::vector<sai_status_t> statuses(bulkSize);
+
+        for (uint32_t i = 0; i < count; i += bulkSize)
+        {
+            uint32_t n = std::min(bulkSize, count - i);
+
+            for (uint32_t j = 0; j < n; j++)
+            {
+                attrCount[j] = 3;
+                attrList[j] = nhAttrs[i + j].data();
+            }
+
+            ASSERT_SUCCESS(m_sairedis->bulkCreate(SAI_OBJECT_TYPE_NEXT_HOP, m_switchId, n, attrCount.data(), attrList.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &nextHops[i], statuses.data()));
+
+            for (uint32_t j = 0; j < n; j++)
+            {
+                routeAttrs[i + j].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+                routeAttrs[i + j].value.oid = nextHops[i + j];
+
+                attrCount[j] = 1;
+                attrList[j] = &routeAttrs[i + j];
+            }
+
+            ASSERT_SUCCESS(m_sairedis->bulkCreate(n, &routes[i], attrCount.data(), attrList.data(),
+                        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data()));
+        }
+
+        auto start = steady_clock::now();
+
+        notifySyncd(SAI_REDIS_NOTIFY_SYNCD_APPLY_VIEW);
+
+        (it == 0 ? populate : reconcile).addSample(start, steady_clock::now(), count * 2);
+    }
+
+    notifySyncd(SAI_REDIS_NOTIFY_SYNCD_INIT_VIEW);
+
+    createBaseObjects();
+
+    auto start = steady_clock::now();
+
+    notifySyncd(SAI_REDIS_NOTIFY_SYNCD_APPLY_VIEW);
+
+    cleanup.addSample(start, steady_clock::now(), count * 2);
+}
+
+/*
+ * Flex counter registration is measured through the same redis extension
+ * attributes orchagent uses, polling cost is measured by get stats calls
+ * for the same counters that flex counter is polling.
+ */
+void SyncdBenchmark::benchFlexCounters()
+{
+    SWSS_LOG_ENTER();
+
+    const std::string group = "PORT_STAT_COUNTER";
+
+    std::vector<sai_stat_id_t> ids = {
+        SAI_PORT_STAT_IF_IN_OCTETS,
+        SAI_PORT_STAT_IF_IN_UCAST_PKTS,
+        SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS,
+        SAI_PORT_STAT_IF_IN_DISCARDS,
+        SAI_PORT_STAT_IF_IN_ERRORS,
+        SAI_PORT_STAT_IF_OUT_OCTETS,
+        SAI_PORT_STAT_IF_OUT_UCAST_PKTS,
+        SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS,
+        SAI_PORT_STAT_IF_OUT_DISCARDS,
+        SAI_PORT_STAT_IF_OUT_ERRORS,
+    };
+
+    std::stringstream ss;
+
+    for (size_t i = 0; i < ids.size(); i++)
+    {
+        ss << (i ? "," : "") << sai_serialize_port_stat((sai_port_stat_t)ids[i]);
+    }
+
+    const std::string counterIds = ss.str();
+    const std::string fieldName = "PORT_COUNTER_ID_LIST";
+    const std::string pollInterval = "1000";
+    const std::string statsMode = "STATS_MODE_READ";
+    const std::string enable = "enable";
+
+    sai_redis_flex_counter_group_parameter_t groupParam;
+
+    memset(&groupParam, 0, sizeof(groupParam));
+
+    setS8List(groupParam.counter_group_name, group);
+    setS8List(groupParam.poll_interval, pollInterval);
+    setS8List(groupParam.stats_mode, statsMode);
+    setS8List(groupParam.operation, enable);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP;
+    attr.value.ptr = &groupParam;
+
+    ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, m_switchId, &attr));
+
+    m_results.reserve(m_results.size() + 3);
+
+    auto& add = addResult("flex_counter_add");
+    auto& get = addResult("port_stats_get");
+    auto& remove = addResult("flex_counter_remove");
+
+    add.setParam("ports", m_ports.size());
+    get.setParam("ports", m_ports.size());
+    get.setParam("iterations", m_options->m_iterations);
+    remove.setParam("ports", m_ports.size());
+
+    std::vector<std::string> keys;
+
+    for (auto port: m_ports)
+    {
+        keys.push_back(group + ":" + sai_serialize_object_id(port));
+    }
+
+    for (auto& key: keys)
+    {
+        sai_redis_flex_counter_parameter_t param;
+
+        memset(&param, 0, sizeof(param));
+
+        setS8List(param.counter_key, key);
+        setS8List(param.counter_ids, counterIds);
+        setS8List(param.counter_field_name, fieldName);
+        setS8List(param.stats_mode, statsMode);
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER;
+        attr.value.ptr = &param;
+
+        auto start = steady_clock::now();
+
+        ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, m_switchId, &attr));
+
+        add.addSample(start, steady_clock::now(), 1);
+    }
+
+    std::vector<uint64_t> counters(ids.size());
+
+    for (uint32_t it = 0; it < m_options->m_iterations; it++)
+    {
+        for (auto port: m_ports)
+        {
+            auto start = steady_clock::now();
+
+            ASSERT_SUCCESS(m_sairedis->getStats(SAI_OBJECT_TYPE_PORT, port, (uint32_t)ids.size(), ids.data(), counters.data()));
+
+            get.addSample(start, steady_clock::now(), 1);
+        }
+    }
+
+    for (auto& key: keys)
+    {
+        sai_redis_flex_counter_parameter_t param;
+
+        memset(&param, 0, sizeof(param));
+
+        setS8List(param.counter_key, key);
+
+        attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER;
+        attr.value.ptr = &param;
+
+        auto start = steady_clock::now();
+
+        ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, m_switchId, &attr));
+
+        remove.addSample(start, steady_clock::now(), 1);
+    }
+
+    // empty parameters remove the group
+
+    memset(&groupParam, 0, sizeof(groupParam));
+
+    setS8List(groupParam.counter_group_name, group);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP;
+    attr.value.ptr = &groupParam;
+
+    ASSERT_SUCCESS(m_sairedis->set(SAI_OBJECT_TYPE_SWITCH, m_switchId, &attr));
+}
+
+nlohmann::json SyncdBenchmark::run()
+{
+    SWSS_LOG_ENTER();
+
+    std::set<std::string> selected;
+
+    std::stringstream ss(m_options->m_scenarios);
+
+    std::string item;
+
+    while (std::getline(ss, item, ','))
+    {
+        if (item.size())
+        {
+            selected.insert(item);
+        }
+    }
+
+    for (auto& name: selected)
+    {
+        auto all = getScenarios();
+
+        if (std::find(all.begin(), all.end(), name) == all.end())
+        {
+            SWSS_LOG_THROW("unknown scenario '%s'", name.c_str());
+        }
+    }
+
+    std::map<std::string, std::function<void()>> scenarios = {
+        { "route",              [this]() { benchRoutes(false); } },
+        { "route_bulk",         [this]() { benchRoutes(true); } },
+        { "neighbor",           [this]() { benchNeighbors(false); } },
+        { "neighbor_bulk",      [this]() { benchNeighbors(true); } },
+        { "next_hop",           [this]() { benchNextHops(false); } },
+        { "next_hop_bulk",      [this]() { benchNextHops(true); } },
+        { "next_hop_group_member_bulk", [this]() { benchNextHopGroupMembers(); } },
+        { "fdb_notification",   [this]() { benchFdbNotifications(); } },
+        { "apply_view",         [this]() { benchApplyView(); } },
+        { "flex_counter",       [this]() { benchFlexCounters(); } },
+    };
+
+    m_results.clear();
+
+    setup();
+
+    for (auto& name: getScenarios())
+    {
+        if (selected.size() && selected.find(name) == selected.end())
+        {
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("running scenario: %s", name.c_str());
+
+        scenarios.at(name)();
+    }
+
+    teardown();
+
+    nlohmann::json j;
+
+    j["communication_mode"] = sai_serialize_redis_communication_mode(m_options->m_redisCommunicationMode);
+    j["external_syncd"] = m_options->m_externalSyncd;
+    j["results"] = nlohmann::json::array();
+
+    for (auto& result: m_results)
+    {
+        j["results"].push_back(result.toJson());
+    }
+
+    return j;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "lib/Sai.h"
+#include "BenchmarkResult.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+
+class SyncdBenchmarkOptions
+{
+    public:
+
+        SyncdBenchmarkOptions();
+
+        virtual ~SyncdBenchmarkOptions() = default;
+
+    public:
+
+        /**
+         * @brief Number of objects created in each scenario.
+         */
+        uint32_t m_count;
+
+        /**
+         * @brief Number of objects in single bulk API call.
+         */
+        uint32_t m_bulkSize;
+
+        /**
+         * @brief Number of repetitions of scenarios which don't create objects.
+         */
+        uint32_t m_iterations;
+
+        sai_redis_communication_mode_t m_redisCommunicationMode;
+
+        /**
+         * @brief Don't start syncd in process, connect to already running one.
+         */
+        bool m_externalSyncd;
+
+        std::string m_profileMapFile;
+
+        /**
+         * @brief Comma separated list of scenarios to run, all if empty.
+         */
+        std::string m_scenarios;
+};
+
+/**
+ * @brief Syncd throughput and latency benchmark.
+ *
+ * Starts syncd with virtual switch (libsaivs) as vendor SAI in worker thread
+ * (unless external syncd is requested) and drives it through sairedis client
+ * over redis or zmq channel, the same way orchagent does.
+ */
+class SyncdBenchmark
+{
+    public:
+
+        SyncdBenchmark(
+                _In_ std::shared_ptr<SyncdBenchmarkOptions> options);
+
+        virtual ~SyncdBenchmark();
+
+    public:
+
+        static std::vector<std::string> getScenarios();
+
+        /**
+         * @brief Run selected scenarios and return results as JSON document.
+         */
+        nlohmann::json run();
+
+    private:
+
+        void setup();
+
+        void teardown();
+
+        void syncdWorkerThread();
+
+        void notifySyncd(
+                _In_ sai_redis_notify_syncd_t op);
+
+        void createBaseObjects();
+
+        std::vector<sai_route_entry_t> makeRoutes(
+                _In_ uint32_t count) const;
+
+        std::vector<sai_neighbor_entry_t> makeNeighbors(
+                _In_ uint32_t count) const;
+
+    private: // scenarios
+
+        void benchRoutes(
+                _In_ bool bulk);
+
+        void benchNeighbors(
+                _In_ bool bulk);
+
+        void benchNextHops(
+                _In_ bool bulk);
+
+        void benchNextHopGroupMembers();
+
+        void benchFdbNotifications();
+
+        void benchApplyView();
+
+        void benchFlexCounters();
+
+    private:
+
+        BenchmarkResult& addResult(
+                _In_ const std::string& name);
+
+    private:
+
+        std::shared_ptr<SyncdBenchmarkOptions> m_options;
+
+        std::shared_ptr<std::thread> m_worker;
+
+        std::shared_ptr<sairedis::Sai> m_sairedis;
+
+        std::vector<BenchmarkResult> m_results;
+
+        sai_object_id_t m_switchId;
+
+        sai_object_id_t m_vr;
+
+        sai_object_id_t m_rif;
+
+        sai_object_id_t m_defaultVlan;
+
+        sai_object_id_t m_bridgePort;
+
+        std::vector<sai_object_id_t> m_ports;
+};
@@ -0,0 +1,166 @@
+#include "SyncdBenchmark.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+
+#include <fstream>
+#include <iostream>
+
+static void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: syncdbench [-c count] [-b bulk_size] [-i iterations] [-z redis_sync|zmq_sync|shm_sync] [-e] [-p profile] [-s scenarios] [-o output] [-h]" << std::endl;
+    std::cout << "    -c --count" << std::endl;
+    std::cout << "        Number of objects created in each scenario" << std::endl;
+    std::cout << "    -b --bulkSize" << std::endl;
+    std::cout << "        Number of objects in single bulk API call" << std::endl;
+    std::cout << "    -i --iterations" << std::endl;
+    std::cout << "        Number of repetitions for apply view and stats scenarios" << std::endl;
+    std::cout << "    -z --redisCommunicationMode" << std::endl;
+    std::cout << "        Redis communication mode (redis_sync, zmq_sync, shm_sync), default: redis_sync" << std::endl;
+    std::cout << "    -e --externalSyncd" << std::endl;
+    std::cout << "        Connect to already running syncd instead of starting one in process" << std::endl;
+    std::cout << "    -p --profile" << std::endl;
+    std::cout << "        Virtual switch profile file" << std::endl;
+    std::cout << "    -s --scenarios" << std::endl;
+    std::cout << "        Comma separated list of scenarios to run, default: all" << std::endl;
+    std::cout << "        Available:";
+
+    for (auto& name: SyncdBenchmark::getScenarios())
+    {
+        std::cout << " " << name;
+    }
+
+    std::cout << std::endl;
+    std::cout << "    -o --output" << std::endl;
+    std::cout << "        Write JSON results to file instead of standard output" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+static std::shared_ptr<SyncdBenchmarkOptions> parseCommandLine(
+        _In_ int argc,
+        _In_ char **argv,
+        _Out_ std::string& output)
+{
+    SWSS_LOG_ENTER();
+
+    auto options = std::make_shared<SyncdBenchmarkOptions>();
+
+    const char* const optstring = "c:b:i:z:ep:s:o:h";
+
+    static struct option long_options[] =
+    {
+        { "count",                  required_argument, 0, 'c' },
+        { "bulkSize",               required_argument, 0, 'b' },
+        { "iterations",             required_argument, 0, 'i' },
+        { "redisCommunicationMode", required_argument, 0, 'z' },
+        { "externalSyncd",          no_argument,       0, 'e' },
+        { "profile",                required_argument, 0, 'p' },
+        { "scenarios",              required_argument, 0, 's' },
+        { "output",                 required_argument, 0, 'o' },
+        { "help",                   no_argument,       0, 'h' },
+        { 0,                        0,                 0,  0  }
+    };
+
+    while (true)
+    {
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+            case 'c':
+                options->m_count = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'b':
+                options->m_bulkSize = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'i':
+                options->m_iterations = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'z':
+                sai_deserialize_redis_communication_mode(optarg, options->m_redisCommunicationMode);
+                break;
+
+            case 'e':
+                options->m_externalSyncd = true;
+                break;
+
+            case 'p':
+                options->m_profileMapFile = optarg;
+                break;
+
+            case 's':
+                options->m_scenarios = optarg;
+                break;
+
+            case 'o':
+                output = optarg;
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    return options;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    std::string output;
+
+    auto options = parseCommandLine(argc, argv, output);
+
+    SyncdBenchmark benchmark(options);
+
+    auto result = benchmark.run();
+
+    if (output.empty())
+    {
+        std::cout << result.dump(4) << std::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream ofs(output);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open %s", output.c_str());
+
+        return EXIT_FAILURE;
+    }
+
+    ofs << result.dump(4) << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+#include "AsyncOperationQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace sairedis;
+
+TEST(AsyncOperationQueue, completeFront)
+{
+    AsyncOperationQueue queue;
+
+    std::vector<sai_status_t> statuses;
+
+    auto t1 = queue.push(SAI_COMMON_API_CREATE, [&](sai_status_t status) { statuses.push_back(status); });
+    auto t2 = queue.push(SAI_COMMON_API_SET, nullptr);
+    auto t3 = queue.push(SAI_COMMON_API_REMOVE, [&](sai_status_t status) { statuses.push_back(status); });
+
+    EXPECT_EQ(queue.size(), 3);
+    EXPECT_EQ(queue.frontApi(), SAI_COMMON_API_CREATE);
+    EXPECT_NE(t1.id, t2.id);
+
+    EXPECT_FALSE(AsyncOperationQueue::isCompleted(t1));
+
+    queue.completeFront(SAI_STATUS_SUCCESS);
+    queue.completeFront(SAI_STATUS_FAILURE);
+
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t1));
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t2));
+    EXPECT_FALSE(AsyncOperationQueue::isCompleted(t3));
+
+    EXPECT_EQ(t1.status.get(), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(t2.status.get(), SAI_STATUS_FAILURE);
+
+    queue.completeAll(SAI_STATUS_FAILURE);
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(t3.status.get(), SAI_STATUS_FAILURE);
+
+    EXPECT_EQ(statuses, std::vector<sai_status_t>({SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE}));
+
+    EXPECT_THROW(queue.completeFront(SAI_STATUS_SUCCESS), std::runtime_error);
+    EXPECT_THROW(queue.frontApi(), std::runtime_error);
+}
+
+TEST(AsyncOperationQueue, complete)
+{
+    AsyncOperationQueue queue;
+
+    queue.push(SAI_COMMON_API_CREATE, nullptr);
+
+    sai_status_t result = SAI_STATUS_SUCCESS;
+
+    auto ticket = queue.complete(SAI_STATUS_NOT_SUPPORTED, [&](sai_status_t status) { result = status; });
+
+    // queued operation is not affected
+
+    EXPECT_EQ(queue.size(), 1);
+
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(ticket));
+    EXPECT_EQ(ticket.status.get(), SAI_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(result, SAI_STATUS_NOT_SUPPORTED);
+}
+
+TEST(AsyncOperationQueue, callbackThrows)
+{
+    AsyncOperationQueue queue;
+
+    auto ticket = queue.push(SAI_COMMON_API_CREATE, [](sai_status_t) { throw std::runtime_error("foo"); });
+
+    queue.completeFront(SAI_STATUS_SUCCESS);
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(ticket.status.get(), SAI_STATUS_SUCCESS);
+
+    async_ticket_t invalid;
+
+    invalid.id = 0;
+
+    EXPECT_THROW(AsyncOperationQueue::isCompleted(invalid), std::runtime_error);
+}
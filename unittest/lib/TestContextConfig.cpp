@@ -27,5 +27,19 @@ TEST(ContextConfig, hasConflict)
     aa->m_zmqNtfEndpoint = "AA";
 
     EXPECT_FALSE(cc->hasConflict(aa));
+
+    // default shm endpoint is only checked when shm is enabled on both
+
+    aa->m_shmEnable = true;
+
+    EXPECT_FALSE(cc->hasConflict(aa));
+
+    cc->m_shmEnable = true;
+
+    EXPECT_TRUE(cc->hasConflict(aa));
+
+    aa->m_shmEndpoint = "AA";
+
+    EXPECT_FALSE(cc->hasConflict(aa));
 }
 
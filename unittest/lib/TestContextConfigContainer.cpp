@@ -20,6 +20,20 @@ TEST(ContextConfigContainer, loadFromFile)
     EXPECT_NE(ccc.loadFromFile("files/ccc_bad.txt"), nullptr);
 }
 
+TEST(ContextConfigContainer, loadFromFileMultipleContexts)
+{
+    // shipped config has no shm fields, both contexts must be loaded
+
+    auto ccc = ContextConfigContainer::loadFromFile("../../lib/context_config.json");
+
+    EXPECT_EQ(ccc->getAllContextConfigs().size(), 2);
+
+    ASSERT_NE(ccc->get(1), nullptr);
+
+    EXPECT_EQ(ccc->get(1)->m_name, "syncd1");
+    EXPECT_FALSE(ccc->get(1)->m_shmEnable);
+}
+
 TEST(ContextConfigContainer, insert)
 {
     ContextConfigContainer ccc;
@@ -1,12 +1,17 @@
 #include "RedisChannel.h"
 #include "sairediscommon.h"
 
+#include "meta/Globals.h"
+
 #include "swss/notificationproducer.h"
+#include "swss/producertable.h"
 
 #include <gtest/gtest.h>
 
 #include <memory>
 
+#include <unistd.h>
+
 using namespace sairedis;
 
 static std::string g_op;
@@ -54,3 +59,74 @@ TEST(RedisChannel, flush)
 
     rc.flush();
 }
+
+TEST(RedisChannel, waitBatchResponse)
+{
+    RedisChannel rc("ASIC_DB", callback);
+
+    rc.setResponseTimeout(1000);
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::ProducerTable p(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    saimeta::Globals::appendBatchResponse(entries, 1, swss::KeyOpFieldsValuesTuple("SAI_STATUS_SUCCESS", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, {}));
+    saimeta::Globals::appendBatchResponse(entries, 2, swss::KeyOpFieldsValuesTuple("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, {}));
+
+    p.set("2", entries, REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    // second response is consumed from batch without waiting
+
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+}
+
+TEST(RedisChannel, isResponseAvailable)
+{
+    RedisChannel rc("ASIC_DB", callback);
+
+    rc.setResponseTimeout(500);
+
+    EXPECT_FALSE(rc.isResponseAvailable());
+
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::ProducerTable p(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    saimeta::Globals::appendBatchResponse(entries, 1, swss::KeyOpFieldsValuesTuple("SAI_STATUS_SUCCESS", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, {}));
+    saimeta::Globals::appendBatchResponse(entries, 2, swss::KeyOpFieldsValuesTuple("SAI_STATUS_FAILURE", REDIS_ASIC_STATE_COMMAND_GETRESPONSE, {}));
+
+    p.set("2", entries, REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE);
+    p.set("SAI_STATUS_NOT_IMPLEMENTED", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    bool available = false;
+
+    for (int i = 0; i < 100 && !available; i++)
+    {
+        available = rc.isResponseAvailable();
+
+        if (!available)
+        {
+            usleep(10000);
+        }
+    }
+
+    EXPECT_TRUE(available);
+
+    // responses already consumed by poll must be returned by wait, not lost
+    // in select which would then block until timeout
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_FAILURE);
+    EXPECT_EQ(rc.wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_NOT_IMPLEMENTED);
+
+    EXPECT_FALSE(rc.isResponseAvailable());
+}
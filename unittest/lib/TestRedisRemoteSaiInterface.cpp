@@ -1,10 +1,73 @@
 #include "RedisRemoteSaiInterface.h"
 #include "ContextConfigContainer.h"
+#include "sairediscommon.h"
+#include "sai_serialize.h"
+
+#include "swss/dbconnector.h"
+#include "swss/producertable.h"
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
+#include <unistd.h>
+
 using namespace sairedis;
 
+static sai_object_id_t createSyncSwitch(
+        _In_ RedisRemoteSaiInterface& sai)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    // switch is created in default async mode, so no response is needed
+
+    sai_object_id_t switchId;
+
+    EXPECT_EQ(sai.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_OPERATION_RESPONSE_TIMEOUT;
+    attr.value.u64 = 500;
+
+    EXPECT_EQ(sai.set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr), SAI_STATUS_SUCCESS);
+
+    return switchId;
+}
+
+static void sendResponses(
+        _In_ const std::vector<std::string>& statuses,
+        _In_ const std::vector<swss::FieldValueTuple>& lastValues = {})
+{
+    SWSS_LOG_ENTER();
+
+    // act as syncd, responses are received in order of requests
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::ProducerTable p(&db, REDIS_TABLE_GETRESPONSE);
+
+    for (size_t idx = 0; idx < statuses.size(); idx++)
+    {
+        std::vector<swss::FieldValueTuple> values;
+
+        if (idx + 1 == statuses.size())
+        {
+            values = lastValues;
+        }
+
+        p.set(statuses[idx], values, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    }
+}
+
 TEST(RedisRemoteSaiInterface, queryStatsCapabilityNegative)
 {
     auto ctx = ContextConfigContainer::loadFromFile("foo");
@@ -17,3 +80,222 @@ TEST(RedisRemoteSaiInterface, queryStatsCapabilityNegative)
                 SAI_OBJECT_TYPE_NULL,
                 0));
 }
+
+TEST(RedisRemoteSaiInterface, createAsyncSwitch)
+{
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    sai_object_id_t switchId;
+
+    auto ticket = sai.createAsync(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 0, nullptr);
+
+    EXPECT_EQ(switchId, SAI_NULL_OBJECT_ID);
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(ticket));
+    EXPECT_EQ(sai.waitAsync(ticket), SAI_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(sai.getAsyncOperationCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, pipelineAsync)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto switchId = createSyncSwitch(sai);
+
+    std::vector<std::string> completed;
+
+    auto cb = [&](const std::string& name) {
+        return [&completed, name](sai_status_t status) {
+            completed.push_back(name + ":" + sai_serialize_status(status));
+        };
+    };
+
+    sai_object_id_t vlan1;
+    sai_object_id_t vlan2;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_VLAN_ATTR_LEARN_DISABLE;
+    attr.value.booldata = true;
+
+    auto t1 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan1, switchId, 0, nullptr, cb("create1"));
+    auto t2 = sai.setAsync(SAI_OBJECT_TYPE_VLAN, vlan1, &attr, cb("set1"));
+    auto t3 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan2, switchId, 0, nullptr, cb("create2"));
+    auto t4 = sai.removeAsync(SAI_OBJECT_TYPE_VLAN, vlan1, cb("remove1"));
+
+    EXPECT_NE(vlan1, SAI_NULL_OBJECT_ID);
+    EXPECT_NE(vlan2, SAI_NULL_OBJECT_ID);
+
+    EXPECT_LT(t1.id, t2.id);
+    EXPECT_LT(t2.id, t3.id);
+    EXPECT_LT(t3.id, t4.id);
+
+    EXPECT_EQ(sai.getAsyncOperationCount(), 4);
+    EXPECT_FALSE(AsyncOperationQueue::isCompleted(t1));
+
+    sendResponses({"SAI_STATUS_SUCCESS", "SAI_STATUS_SUCCESS", "SAI_STATUS_FAILURE", "SAI_STATUS_SUCCESS"});
+
+    // waiting for second operation completes first one too
+
+    EXPECT_EQ(sai.waitAsync(t2), SAI_STATUS_SUCCESS);
+
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t1));
+    EXPECT_FALSE(AsyncOperationQueue::isCompleted(t3));
+    EXPECT_EQ(sai.getAsyncOperationCount(), 2);
+
+    // failed create releases allocated object id in completion
+
+    EXPECT_EQ(sai.waitAsync(t3), SAI_STATUS_FAILURE);
+
+    sai.waitForAsyncOperations();
+
+    EXPECT_EQ(t4.status.get(), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(sai.getAsyncOperationCount(), 0);
+
+    std::vector<std::string> expected = {
+        "create1:SAI_STATUS_SUCCESS",
+        "set1:SAI_STATUS_SUCCESS",
+        "create2:SAI_STATUS_FAILURE",
+        "remove1:SAI_STATUS_SUCCESS" };
+
+    EXPECT_EQ(completed, expected);
+}
+
+TEST(RedisRemoteSaiInterface, pipelineAsyncBeforeGet)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto switchId = createSyncSwitch(sai);
+
+    sai_object_id_t vlan;
+
+    auto t1 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan, switchId, 0, nullptr);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_VLAN_ATTR_LEARN_DISABLE;
+    attr.value.booldata = true;
+
+    auto t2 = sai.setAsync(SAI_OBJECT_TYPE_VLAN, vlan, &attr);
+
+    sendResponses({"SAI_STATUS_SUCCESS", "SAI_STATUS_SUCCESS", "SAI_STATUS_SUCCESS"}, {{"SAI_VLAN_ATTR_VLAN_ID", "10"}});
+
+    // blocking get completes asynchronous operations before its own response
+
+    attr.id = SAI_VLAN_ATTR_VLAN_ID;
+    attr.value.u16 = 0;
+
+    EXPECT_EQ(sai.get(SAI_OBJECT_TYPE_VLAN, vlan, 1, &attr), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(attr.value.u16, 10);
+
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t1));
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t2));
+    EXPECT_EQ(sai.getAsyncOperationCount(), 0);
+}
+
+TEST(RedisRemoteSaiInterface, pipelineAsyncTimeout)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto switchId = createSyncSwitch(sai);
+
+    sai_object_id_t vlan1;
+    sai_object_id_t vlan2;
+
+    auto t1 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan1, switchId, 0, nullptr);
+    auto t2 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan2, switchId, 0, nullptr);
+
+    // no response, all operations in flight are failed
+
+    EXPECT_EQ(sai.waitAsync(t1), SAI_STATUS_FAILURE);
+
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t2));
+    EXPECT_EQ(t2.status.get(), SAI_STATUS_FAILURE);
+    EXPECT_EQ(sai.getAsyncOperationCount(), 0);
+
+    // late responses must not complete next operation
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_VLAN_ATTR_LEARN_DISABLE;
+    attr.value.booldata = true;
+
+    auto t3 = sai.setAsync(SAI_OBJECT_TYPE_VLAN, vlan1, &attr);
+
+    sendResponses({"SAI_STATUS_SUCCESS", "SAI_STATUS_SUCCESS", "SAI_STATUS_NOT_IMPLEMENTED"});
+
+    EXPECT_EQ(sai.waitAsync(t3), SAI_STATUS_NOT_IMPLEMENTED);
+}
+
+TEST(RedisRemoteSaiInterface, pollAsync)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+
+    auto ctx = ContextConfigContainer::loadFromFile("foo");
+    auto rec = std::make_shared<Recorder>();
+
+    RedisRemoteSaiInterface sai(ctx->get(0), nullptr, rec);
+
+    auto switchId = createSyncSwitch(sai);
+
+    sai_object_id_t vlan1;
+    sai_object_id_t vlan2;
+
+    auto t1 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan1, switchId, 0, nullptr);
+    auto t2 = sai.createAsync(SAI_OBJECT_TYPE_VLAN, &vlan2, switchId, 0, nullptr);
+
+    // nothing was received yet, poll must not block
+
+    EXPECT_EQ(sai.pollAsync(), 0);
+
+    sendResponses({"SAI_STATUS_SUCCESS"});
+
+    size_t count = 0;
+
+    for (int i = 0; i < 100 && count == 0; i++)
+    {
+        count = sai.pollAsync();
+
+        if (count == 0)
+        {
+            usleep(10000);
+        }
+    }
+
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(AsyncOperationQueue::isCompleted(t1));
+    EXPECT_EQ(t1.status.get(), SAI_STATUS_SUCCESS);
+
+    // response was consumed by poll, next wait must not time out
+
+    sendResponses({"SAI_STATUS_NOT_IMPLEMENTED"});
+
+    EXPECT_EQ(sai.waitAsync(t2), SAI_STATUS_NOT_IMPLEMENTED);
+    EXPECT_EQ(sai.getAsyncOperationCount(), 0);
+}
@@ -13,3 +13,17 @@ TEST(ServerConfig, loadFromFile)
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_ok.json"), nullptr);
     EXPECT_NE(ServerConfig::loadFromFile("files/server_config_bad.json"), nullptr);
 }
+
+TEST(ServerConfig, clientEndpoints)
+{
+    auto cc = ServerConfig::loadFromFile("files/server_config_ok.json");
+
+    EXPECT_EQ(cc->m_zmqClientEndpoints.size(), 0);
+
+    cc = ServerConfig::loadFromFile("files/server_config_clients.json");
+
+    ASSERT_EQ(cc->m_zmqClientEndpoints.size(), 2);
+
+    EXPECT_EQ(cc->m_zmqClientEndpoints[0], "ipc:///tmp/saiServerClient0");
+    EXPECT_EQ(cc->m_zmqClientEndpoints[1], "ipc:///tmp/saiServerClient1");
+}
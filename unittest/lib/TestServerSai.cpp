@@ -8,16 +8,26 @@
 
 #include "swss/dbconnector.h"
 
+#include "sairedis.h"
 #include "sairediscommon.h"
 
 #include "MockSaiInterface.h"
 #include "SelectableChannel.h"
+#include "ZeroMQChannel.h"
 #include "swss/dbconnector.h"
 #include "swss/redisreply.h"
+#include "swss/consumertable.h"
+#include "swss/producertable.h"
+#include "swss/select.h"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstring>
+#include <chrono>
 
 
 using namespace sairedis;
@@ -65,3 +75,337 @@ TEST(ServerSai, bulkGet)
                 SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
                 statuses));
 }
+
+static const char* clients_profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable != NULL && strcmp(variable, SAI_REDIS_KEY_SERVER_CONFIG) == 0)
+        return "files/server_config_clients.json";
+
+    return NULL;
+}
+
+static sai_service_method_table_t test_clients_services = {
+    clients_profile_get_value,
+    profile_get_next_value
+};
+
+/**
+ * @brief Sai interface which blocks set until released, and get until
+ * expected number of get calls is executed at the same time.
+ */
+class BlockingSaiInterface:
+    public MockSaiInterface
+{
+    public:
+
+        BlockingSaiInterface(
+                _In_ int concurrentGets):
+            m_concurrentGets(concurrentGets),
+            m_gets(0),
+            m_setEntered(false),
+            m_setReleased(false)
+        {
+            SWSS_LOG_ENTER();
+        }
+
+        virtual sai_status_t set(
+                _In_ sai_object_type_t objectType,
+                _In_ sai_object_id_t objectId,
+                _In_ const sai_attribute_t *attr) override
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_setEntered = true;
+
+            m_cv.notify_all();
+
+            bool released = m_cv.wait_for(lock, std::chrono::seconds(10), [this]{ return m_setReleased; });
+
+            return released ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+        }
+
+        virtual sai_status_t get(
+                _In_ sai_object_type_t objectType,
+                _In_ sai_object_id_t objectId,
+                _In_ uint32_t attr_count,
+                _Inout_ sai_attribute_t *attr_list) override
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_gets++;
+
+            m_cv.notify_all();
+
+            bool met = m_cv.wait_for(lock, std::chrono::seconds(10), [this]{ return m_gets >= m_concurrentGets; });
+
+            return met ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+        }
+
+        bool waitForSet()
+        {
+            SWSS_LOG_ENTER();
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            return m_cv.wait_for(lock, std::chrono::seconds(10), [this]{ return m_setEntered; });
+        }
+
+        void releaseSet()
+        {
+            SWSS_LOG_ENTER();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_setReleased = true;
+
+            m_cv.notify_all();
+        }
+
+    private:
+
+        int m_concurrentGets;
+
+        int m_gets;
+
+        bool m_setEntered;
+
+        bool m_setReleased;
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_cv;
+};
+
+class ServerSaiTest:
+    public ServerSai
+{
+    public:
+
+        void setSai(
+                _In_ std::shared_ptr<SaiInterface> sai)
+        {
+            SWSS_LOG_ENTER();
+
+            m_sai = sai;
+        }
+};
+
+static sai_status_t sendRequest(
+        _In_ const std::string& endpoint,
+        _In_ const std::string& ntfEndpoint,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& op,
+        _In_ const std::string& response)
+{
+    SWSS_LOG_ENTER();
+
+    ZeroMQChannel channel(endpoint, ntfEndpoint, nullptr);
+
+    channel.set(key, values, op);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    return channel.wait(response, kco);
+}
+
+static sai_status_t sendRequest(
+        _In_ const std::string& endpoint,
+        _In_ const std::string& ntfEndpoint,
+        _In_ const std::string& op,
+        _In_ const std::string& response)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_PORT_ATTR_ADMIN_STATE", "true");
+
+    return sendRequest(endpoint, ntfEndpoint, "SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", values, op, response);
+}
+
+TEST(ServerSai, readOnlyWhileMutating)
+{
+    auto bsai = std::make_shared<BlockingSaiInterface>(1);
+
+    ServerSaiTest sai;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.apiInitialize(0, &test_clients_services));
+
+    sai.setSai(bsai);
+
+    sai_status_t setStatus = SAI_STATUS_FAILURE;
+
+    std::thread setThread([&]{
+            setStatus = sendRequest(
+                    "ipc:///tmp/saiServer",
+                    "ipc:///tmp/saiServerTestNtf0",
+                    REDIS_ASIC_STATE_COMMAND_SET,
+                    REDIS_ASIC_STATE_COMMAND_GETRESPONSE); });
+
+    EXPECT_TRUE(bsai->waitForSet());
+
+    // set from first client holds server lock, get from second client must
+    // not be blocked by it
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sendRequest(
+                "ipc:///tmp/saiServerClient0",
+                "ipc:///tmp/saiServerTestNtf1",
+                REDIS_ASIC_STATE_COMMAND_GET,
+                REDIS_ASIC_STATE_COMMAND_GETRESPONSE));
+
+    bsai->releaseSet();
+
+    setThread.join();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, setStatus);
+}
+
+TEST(ServerSai, clientsServedConcurrently)
+{
+    // each get succeeds only when both gets are executing at the same time
+
+    auto bsai = std::make_shared<BlockingSaiInterface>(2);
+
+    ServerSaiTest sai;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.apiInitialize(0, &test_clients_services));
+
+    sai.setSai(bsai);
+
+    sai_status_t status0 = SAI_STATUS_FAILURE;
+    sai_status_t status1 = SAI_STATUS_FAILURE;
+
+    std::thread thread0([&]{
+            status0 = sendRequest(
+                    "ipc:///tmp/saiServerClient0",
+                    "ipc:///tmp/saiServerTestNtf0",
+                    REDIS_ASIC_STATE_COMMAND_GET,
+                    REDIS_ASIC_STATE_COMMAND_GETRESPONSE); });
+
+    std::thread thread1([&]{
+            status1 = sendRequest(
+                    "ipc:///tmp/saiServerClient1",
+                    "ipc:///tmp/saiServerTestNtf1",
+                    REDIS_ASIC_STATE_COMMAND_GET,
+                    REDIS_ASIC_STATE_COMMAND_GETRESPONSE); });
+
+    thread0.join();
+    thread1.join();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, status0);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, status1);
+}
+
+TEST(ServerSai, readOnlyConcurrentOnRealSai)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    db.flushdb();
+
+    // act as syncd
+
+    swss::ConsumerTable requests(&db, ASIC_STATE_TABLE);
+    swss::ProducerTable responses(&db, REDIS_TABLE_GETRESPONSE);
+
+    ServerSai sai;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.apiInitialize(0, &test_clients_services));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    sai_object_id_t switchId;
+
+    // switch is created in default async mode, so no response is needed
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_SYNC_OPERATION_RESPONSE_TIMEOUT;
+    attr.value.u64 = 3000;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.set(SAI_OBJECT_TYPE_SWITCH, switchId, &attr));
+
+    std::vector<swss::FieldValueTuple> query = {
+        { "OBJECT_TYPE", "SAI_OBJECT_TYPE_PORT" },
+        { "ATTR_ID", "SAI_PORT_ATTR_ADMIN_STATE" } };
+
+    sai_status_t status0 = SAI_STATUS_FAILURE;
+    sai_status_t status1 = SAI_STATUS_FAILURE;
+
+    std::thread thread0([&]{
+            status0 = sendRequest(
+                    "ipc:///tmp/saiServerClient0",
+                    "ipc:///tmp/saiServerTestNtf0",
+                    sai_serialize_object_id(switchId),
+                    query,
+                    REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY,
+                    REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE); });
+
+    std::thread thread1([&]{
+            status1 = sendRequest(
+                    "ipc:///tmp/saiServerClient1",
+                    "ipc:///tmp/saiServerTestNtf1",
+                    sai_serialize_object_id(switchId),
+                    query,
+                    REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY,
+                    REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE); });
+
+    // respond only when both queries are in flight, if sai executed them one
+    // by one, first one would time out
+
+    swss::Select s;
+
+    s.addSelectable(&requests);
+
+    int queries = 0;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (queries < 2 && std::chrono::steady_clock::now() < deadline)
+    {
+        swss::Selectable *sel;
+
+        if (s.select(&sel, 100) != swss::Select::OBJECT)
+            continue;
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        requests.pop(kco);
+
+        if (kfvOp(kco) == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY)
+            queries++;
+    }
+
+    EXPECT_EQ(queries, 2);
+
+    for (int i = 0; i < queries; i++)
+    {
+        responses.set("SAI_STATUS_SUCCESS", {
+                { "CREATE_IMPLEMENTED", "true" },
+                { "SET_IMPLEMENTED", "true" },
+                { "GET_IMPLEMENTED", "true" } },
+                REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_RESPONSE);
+    }
+
+    thread0.join();
+    thread1.join();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, status0);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, status1);
+}
@@ -45,3 +45,91 @@ TEST(Globals, getHardwareInfo)
 
     EXPECT_EQ("000", Globals::getHardwareInfo(1, &attr));
 }
+
+TEST(Globals, parseBulkJoined)
+{
+    std::vector<swss::FieldValueTuple> values = {
+        { "oid:0x1", "SAI_PORT_ATTR_MTU=9100|SAI_PORT_ATTR_ADMIN_STATE=true" },
+        { "oid:0x2", "" },
+    };
+
+    std::vector<std::string> objectIds;
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+    Globals::parseBulk(Globals::getBulkKey("SAI_OBJECT_TYPE_PORT", 2, false), values, objectIds, strAttributes);
+
+    EXPECT_EQ(objectIds, std::vector<std::string>({ "oid:0x1", "oid:0x2" }));
+    EXPECT_EQ(strAttributes.size(), 2);
+    EXPECT_EQ(strAttributes[0].size(), 2);
+    EXPECT_EQ(fvField(strAttributes[0][1]), "SAI_PORT_ATTR_ADMIN_STATE");
+    EXPECT_EQ(fvValue(strAttributes[0][1]), "true");
+    EXPECT_EQ(strAttributes[1].size(), 0);
+}
+
+TEST(Globals, parseBulkFields)
+{
+    std::vector<swss::FieldValueTuple> values;
+
+    Globals::appendBulkFields(values, "oid:0x1", { { "SAI_PORT_ATTR_MTU", "9100" }, { "SAI_PORT_ATTR_ADMIN_STATE", "true" } });
+    Globals::appendBulkFields(values, "oid:0x2", {});
+
+    EXPECT_EQ(values.size(), 4);
+
+    auto key = Globals::getBulkKey("SAI_OBJECT_TYPE_PORT", 2, true);
+
+    EXPECT_EQ(key, "SAI_OBJECT_TYPE_PORT:2:fields");
+
+    std::vector<std::string> objectIds;
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+
+    Globals::parseBulk(key, values, objectIds, strAttributes);
+
+    EXPECT_EQ(objectIds, std::vector<std::string>({ "oid:0x1", "oid:0x2" }));
+    EXPECT_EQ(strAttributes.size(), 2);
+    EXPECT_EQ(strAttributes[0].size(), 2);
+    EXPECT_EQ(fvField(strAttributes[0][0]), "SAI_PORT_ATTR_MTU");
+    EXPECT_EQ(fvValue(strAttributes[0][0]), "9100");
+    EXPECT_EQ(strAttributes[1].size(), 0);
+
+    // attribute count exceeds entries
+
+    values.pop_back();
+    values.emplace_back("oid:0x2", "1");
+
+    EXPECT_THROW(Globals::parseBulk(key, values, objectIds, strAttributes), std::runtime_error);
+}
+
+TEST(Globals, parseBatchResponse)
+{
+    std::vector<swss::FieldValueTuple> entries;
+
+    swss::KeyOpFieldsValuesTuple first("SAI_STATUS_SUCCESS", "getresponse", {});
+    swss::KeyOpFieldsValuesTuple second("SAI_STATUS_FAILURE", "getresponse", { { "SAI_STATUS_SUCCESS", "" }, { "SAI_STATUS_FAILURE", "" } });
+
+    Globals::appendBatchResponse(entries, 7, first);
+    Globals::appendBatchResponse(entries, 8, second);
+
+    EXPECT_EQ(entries.size(), 6);
+
+    std::vector<uint64_t> sequences;
+    std::vector<swss::KeyOpFieldsValuesTuple> responses;
+
+    Globals::parseBatchResponse(entries, sequences, responses);
+
+    EXPECT_EQ(sequences, std::vector<uint64_t>({ 7, 8 }));
+    EXPECT_EQ(responses.size(), 2);
+    EXPECT_EQ(responses[0], first);
+    EXPECT_EQ(responses[1], second);
+
+    // value count exceeds entries
+
+    entries.pop_back();
+
+    EXPECT_THROW(Globals::parseBatchResponse(entries, sequences, responses), std::runtime_error);
+
+    // missing key and op pair
+
+    entries.resize(1);
+
+    EXPECT_THROW(Globals::parseBatchResponse(entries, sequences, responses), std::runtime_error);
+}
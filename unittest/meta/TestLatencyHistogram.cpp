@@ -0,0 +1,89 @@
+#include "LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace sairediscommon;
+
+TEST(LatencyHistogram, empty)
+{
+    LatencyHistogram h;
+
+    EXPECT_EQ(h.getCount(), 0);
+    EXPECT_EQ(h.getSum(), 0);
+    EXPECT_EQ(h.getMax(), 0);
+    EXPECT_EQ(h.getPercentile(99), 0);
+}
+
+TEST(LatencyHistogram, getBucketIndex)
+{
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(0), 0);
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(3), 3);
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(8), 8);
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(9), 8);
+    EXPECT_LT(LatencyHistogram::getBucketIndex(UINT64_MAX), LatencyHistogram::BUCKETS);
+
+    for (uint64_t v: std::vector<uint64_t>{0, 1, 7, 100, 1000, 123456789, UINT64_MAX})
+    {
+        auto idx = LatencyHistogram::getBucketIndex(v);
+
+        EXPECT_GE(LatencyHistogram::getBucketUpperBound(idx), v);
+
+        if (idx > 0)
+        {
+            EXPECT_LT(LatencyHistogram::getBucketUpperBound(idx - 1), v);
+        }
+    }
+}
+
+TEST(LatencyHistogram, getPercentile)
+{
+    LatencyHistogram h;
+
+    for (uint64_t i = 1; i <= 1000; i++)
+    {
+        h.record(i * 1000);
+    }
+
+    EXPECT_EQ(h.getCount(), 1000);
+    EXPECT_EQ(h.getSum(), 500500000);
+    EXPECT_EQ(h.getMax(), 1000000);
+    EXPECT_EQ(h.getPercentile(100), 1000000);
+
+    auto p50 = h.getPercentile(50);
+
+    EXPECT_GE(p50, 500000);
+    EXPECT_LE(p50, 500000 * 5 / 4);
+
+    auto p99 = h.getPercentile(99);
+
+    EXPECT_GE(p99, 990000);
+    EXPECT_LE(p99, 1000000);
+}
+
+TEST(LatencyHistogram, concurrentRecord)
+{
+    LatencyHistogram h;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&h, t]() {
+                for (uint64_t i = 0; i < 10000; i++)
+                {
+                    h.record(t * 100 + 1);
+                }
+        });
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(h.getCount(), 40000);
+    EXPECT_EQ(h.getMax(), 301);
+}
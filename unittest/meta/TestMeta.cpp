@@ -1713,23 +1713,94 @@ TEST(Meta, populate)
 TEST(Meta, bulkGetClearStats)
 {
     Meta m(std::make_shared<MetaTestSaiInterface>());
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                         SAI_OBJECT_TYPE_PORT,
-                                                         0,
-                                                         nullptr,
-                                                         0,
-                                                         nullptr,
-                                                         SAI_STATS_MODE_BULK_READ,
-                                                         nullptr,
-                                                         nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
                                                            0,
                                                            nullptr,
-                                                           SAI_STATS_MODE_BULK_CLEAR,
+                                                           SAI_STATS_MODE_BULK_READ,
+                                                           nullptr,
                                                            nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                             SAI_OBJECT_TYPE_PORT,
+                                                             0,
+                                                             nullptr,
+                                                             0,
+                                                             nullptr,
+                                                             SAI_STATS_MODE_BULK_CLEAR,
+                                                             nullptr));
+}
+
+TEST(Meta, bulkGetClearStatsPerObjectStatus)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_stat_id_t counter_ids[1] = { SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_0_DROPPED_PKTS };
+
+    sai_object_key_t keys[2];
+
+    keys[0].key.object_id = switchId;
+    keys[1].key.object_id = SAI_NULL_OBJECT_ID;
+
+    sai_status_t statuses[2];
+
+    uint64_t counters[2];
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkGetStats(SAI_NULL_OBJECT_ID,
+                                                 SAI_OBJECT_TYPE_SWITCH,
+                                                 1,
+                                                 keys,
+                                                 1,
+                                                 counter_ids,
+                                                 SAI_STATS_MODE_BULK_READ,
+                                                 statuses,
+                                                 counters));
+
+    statuses[1] = SAI_STATUS_SUCCESS;
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, m.bulkGetStats(SAI_NULL_OBJECT_ID,
+                                                 SAI_OBJECT_TYPE_SWITCH,
+                                                 2,
+                                                 keys,
+                                                 1,
+                                                 counter_ids,
+                                                 SAI_STATS_MODE_BULK_READ,
+                                                 statuses,
+                                                 counters));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, statuses[1]);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                   SAI_OBJECT_TYPE_SWITCH,
+                                                   1,
+                                                   keys,
+                                                   1,
+                                                   counter_ids,
+                                                   SAI_STATS_MODE_BULK_CLEAR,
+                                                   statuses));
+
+    statuses[1] = SAI_STATUS_SUCCESS;
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                   SAI_OBJECT_TYPE_SWITCH,
+                                                   2,
+                                                   keys,
+                                                   1,
+                                                   counter_ids,
+                                                   SAI_STATS_MODE_BULK_CLEAR,
+                                                   statuses));
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, statuses[1]);
 }
 
 TEST(Meta, quad_ars)
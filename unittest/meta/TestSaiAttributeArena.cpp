@@ -0,0 +1,71 @@
+#include "SaiAttributeArena.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saimeta;
+
+TEST(SaiAttributeArena, allocate)
+{
+    SaiAttributeArena arena(64);
+
+    EXPECT_EQ(arena.getReservedSize(), SaiAttributeArena::DEFAULT_BLOCK_SIZE);
+
+    auto a = arena.allocate(3, 1);
+    auto b = arena.allocate_n<uint64_t>(2);
+
+    EXPECT_NE(a, nullptr);
+    EXPECT_EQ((uintptr_t)b % alignof(uint64_t), 0);
+    EXPECT_TRUE(arena.contains(a));
+    EXPECT_TRUE(arena.contains(b));
+
+    int local;
+
+    EXPECT_FALSE(arena.contains(&local));
+    EXPECT_FALSE(arena.contains(nullptr));
+
+    // zero size allocations are unique
+
+    EXPECT_NE(arena.allocate(0, 1), arena.allocate(0, 1));
+
+    EXPECT_EQ(arena.getUsedSize(), 3 + 2 * sizeof(uint64_t) + 2);
+}
+
+TEST(SaiAttributeArena, grow)
+{
+    SaiAttributeArena arena;
+
+    auto a = arena.allocate(SaiAttributeArena::DEFAULT_BLOCK_SIZE, 8);
+    auto b = arena.allocate(3 * SaiAttributeArena::DEFAULT_BLOCK_SIZE, 8);
+
+    EXPECT_TRUE(arena.contains(a));
+    EXPECT_TRUE(arena.contains(b));
+
+    EXPECT_GE(arena.getReservedSize(), 4 * SaiAttributeArena::DEFAULT_BLOCK_SIZE);
+    EXPECT_EQ(arena.getUsedSize(), 4 * SaiAttributeArena::DEFAULT_BLOCK_SIZE);
+}
+
+TEST(SaiAttributeArena, scope)
+{
+    SaiAttributeArena first;
+    SaiAttributeArena second;
+
+    EXPECT_EQ(SaiAttributeArena::getCurrent(), nullptr);
+
+    {
+        SaiAttributeArena::Scope scope(&first);
+
+        EXPECT_EQ(SaiAttributeArena::getCurrent(), &first);
+
+        {
+            SaiAttributeArena::Scope inner(&second);
+
+            EXPECT_EQ(SaiAttributeArena::getCurrent(), &second);
+        }
+
+        EXPECT_EQ(SaiAttributeArena::getCurrent(), &first);
+    }
+
+    EXPECT_EQ(SaiAttributeArena::getCurrent(), nullptr);
+}
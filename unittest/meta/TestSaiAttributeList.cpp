@@ -44,3 +44,38 @@ TEST(SaiAttributeList, ctr_hash)
     EXPECT_THROW(std::make_shared<SaiAttributeList>((sai_object_type_t)-1, hash, false), std::runtime_error);
 #pragma GCC diagnostic pop
 }
+
+TEST(SaiAttributeList, ctr_arena)
+{
+    std::vector<swss::FieldValueTuple> vals;
+
+    vals.emplace_back("NULL", "NULL");
+    vals.emplace_back("SAI_PORT_ATTR_HW_LANE_LIST", "4:1,2,3,4");
+    vals.emplace_back("SAI_PORT_ATTR_SPEED", "10000");
+
+    EXPECT_THROW(std::make_shared<SaiAttributeList>(SAI_OBJECT_TYPE_PORT, vals, false, nullptr), std::runtime_error);
+
+    auto arena = std::make_shared<SaiAttributeArena>();
+
+    auto list = std::make_shared<SaiAttributeList>(SAI_OBJECT_TYPE_PORT, vals, false, arena);
+
+    EXPECT_EQ(list->get_attr_count(), 2);
+
+    auto attrs = list->get_attr_list();
+
+    EXPECT_TRUE(arena->contains(attrs));
+
+    EXPECT_EQ(attrs[0].id, SAI_PORT_ATTR_HW_LANE_LIST);
+    EXPECT_EQ(attrs[0].value.u32list.count, 4);
+    EXPECT_EQ(attrs[0].value.u32list.list[3], 4);
+    EXPECT_TRUE(arena->contains(attrs[0].value.u32list.list));
+
+    EXPECT_EQ(attrs[1].id, SAI_PORT_ATTR_SPEED);
+    EXPECT_EQ(attrs[1].value.u32, 10000);
+
+    // list keeps arena alive
+
+    arena = nullptr;
+
+    EXPECT_EQ(list->get_attr_list()[0].value.u32list.list[0], 1);
+}
@@ -0,0 +1,168 @@
+#include "ShmRing.h"
+
+#include "swss/logger.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+
+using namespace sairedis;
+
+class ShmRingTest:
+    public ::testing::Test
+{
+    public:
+
+        void init(
+                _In_ size_t capacity)
+        {
+            SWSS_LOG_ENTER();
+
+            void* memory = nullptr;
+
+            ASSERT_EQ(posix_memalign(&memory, 64, ShmRing::getRequiredSize(capacity)), 0);
+
+            m_memory.reset(memory);
+
+            m_eventFd = eventfd(0, EFD_NONBLOCK);
+
+            ASSERT_GE(m_eventFd, 0);
+
+            m_ring = std::make_shared<ShmRing>(memory, capacity, m_eventFd);
+
+            m_ring->reset();
+        }
+
+        virtual void TearDown() override
+        {
+            SWSS_LOG_ENTER();
+
+            m_ring = nullptr;
+
+            if (m_eventFd >= 0)
+            {
+                close(m_eventFd);
+            }
+        }
+
+        bool isSignaled()
+        {
+            SWSS_LOG_ENTER();
+
+            uint64_t value;
+
+            return read(m_eventFd, &value, sizeof(value)) == sizeof(value);
+        }
+
+    protected:
+
+        struct Free
+        {
+            void operator()(void* p) const { free(p); }
+        };
+
+        std::unique_ptr<void, Free> m_memory;
+
+        int m_eventFd = -1;
+
+        std::shared_ptr<ShmRing> m_ring;
+};
+
+TEST_F(ShmRingTest, pushPop)
+{
+    init(1024);
+
+    EXPECT_TRUE(m_ring->isValid());
+    EXPECT_TRUE(m_ring->empty());
+
+    std::vector<swss::FieldValueTuple> values = { { "f1", "v1" }, { "f2", "" } };
+
+    EXPECT_TRUE(m_ring->push("key", values, "op", 0));
+
+    EXPECT_FALSE(m_ring->empty());
+    EXPECT_TRUE(isSignaled());
+
+    // ring was not empty, so second push don't signal
+
+    EXPECT_TRUE(m_ring->push("key2", {}, "op2", 0));
+    EXPECT_FALSE(isSignaled());
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_TRUE(m_ring->pop(kco));
+
+    EXPECT_EQ(kfvKey(kco), "key");
+    EXPECT_EQ(kfvOp(kco), "op");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+
+    EXPECT_TRUE(m_ring->pop(kco));
+
+    EXPECT_EQ(kfvKey(kco), "key2");
+    EXPECT_EQ(kfvOp(kco), "op2");
+    EXPECT_EQ(kfvFieldsValues(kco).size(), 0);
+
+    EXPECT_FALSE(m_ring->pop(kco));
+    EXPECT_TRUE(m_ring->empty());
+}
+
+TEST_F(ShmRingTest, wrapAround)
+{
+    init(100);
+
+    std::vector<swss::FieldValueTuple> values = { { "field", "value" } };
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    // message size is not divisor of capacity, so messages will be split
+
+    for (int i = 0; i < 50; i++)
+    {
+        std::string key = "key" + std::to_string(i);
+
+        EXPECT_TRUE(m_ring->push(key, values, "op", 0));
+
+        EXPECT_TRUE(m_ring->pop(kco));
+
+        EXPECT_EQ(kfvKey(kco), key);
+        EXPECT_EQ(kfvFieldsValues(kco), values);
+    }
+}
+
+TEST_F(ShmRingTest, full)
+{
+    init(64);
+
+    std::vector<swss::FieldValueTuple> values = { { "field", "value" } };
+
+    EXPECT_TRUE(m_ring->push("key", values, "op", 0));
+
+    EXPECT_FALSE(m_ring->push("key", values, "op", 1));
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_TRUE(m_ring->pop(kco));
+
+    EXPECT_TRUE(m_ring->push("key", values, "op", 0));
+}
+
+TEST_F(ShmRingTest, tooLarge)
+{
+    init(64);
+
+    std::vector<swss::FieldValueTuple> values = { { "field", std::string(64, 'x') } };
+
+    EXPECT_THROW(m_ring->push("key", values, "op", 0), std::runtime_error);
+}
+
+TEST_F(ShmRingTest, isValid)
+{
+    init(64);
+
+    ShmRing ring(m_memory.get(), 128, m_eventFd);
+
+    EXPECT_FALSE(ring.isValid());
+}
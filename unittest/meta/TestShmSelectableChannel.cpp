@@ -0,0 +1,278 @@
+#include "ShmSelectableChannel.h"
+#include "ShmChannel.h"
+
+#include "sairediscommon.h"
+
+#include "swss/logger.h"
+#include "swss/select.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace sairedis;
+
+#define SHM_TEST_ENDPOINT "/tmp/shm_test"
+
+TEST(ShmSelectableChannel, ctr)
+{
+    EXPECT_THROW(std::make_shared<ShmSelectableChannel>("/dev_not/foo"), std::runtime_error);
+}
+
+TEST(ShmSelectableChannel, empty)
+{
+    ShmSelectableChannel c(SHM_TEST_ENDPOINT);
+
+    EXPECT_EQ(c.empty(), true);
+    EXPECT_EQ(c.hasData(), false);
+    EXPECT_EQ(c.hasCachedData(), false);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    EXPECT_THROW(c.pop(kco, false), std::runtime_error);
+}
+
+TEST(ShmSelectableChannel, set)
+{
+    ShmSelectableChannel c(SHM_TEST_ENDPOINT);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    // no client, response is dropped
+    EXPECT_NO_THROW(c.set("key", values, "op"));
+}
+
+static std::mutex g_mutex;
+static std::condition_variable g_cv;
+static std::string g_ntfData;
+
+static void cb(
+        _In_ const std::string& op,
+        _In_ const std::string& data,
+        _In_ const std::vector<swss::FieldValueTuple>&)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+
+    g_ntfData = op + ":" + data;
+
+    g_cv.notify_all();
+}
+
+TEST(ShmSelectableChannel, readData)
+{
+    ShmSelectableChannel c(SHM_TEST_ENDPOINT);
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    // accept is done on select, so connect from different thread
+
+    std::shared_ptr<ShmChannel> main;
+
+    std::atomic<bool> connected(false);
+
+    std::thread client([&]() {
+            main = std::make_shared<ShmChannel>(SHM_TEST_ENDPOINT, cb);
+            connected = true;
+            });
+
+    // accepted connection alone is not reported as data
+
+    for (int i = 0; i < 50 && !connected; i++)
+    {
+        EXPECT_EQ(ss.select(&sel, 100), swss::Select::TIMEOUT);
+    }
+
+    client.join();
+
+    ASSERT_NE(main, nullptr);
+
+    std::vector<swss::FieldValueTuple> values = { { "field", "value" } };
+
+    main->set("key", values, "command");
+    main->set("key2", values, "command");
+
+    EXPECT_EQ(ss.select(&sel, 1000), swss::Select::OBJECT);
+
+    EXPECT_EQ(c.empty(), false);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    c.pop(kco, false);
+
+    EXPECT_EQ(kfvKey(kco), "key");
+    EXPECT_EQ(kfvOp(kco), "command");
+    EXPECT_EQ(kfvFieldsValues(kco), values);
+
+    c.pop(kco, false);
+
+    EXPECT_EQ(kfvKey(kco), "key2");
+    EXPECT_EQ(c.empty(), true);
+
+    c.set("SAI_STATUS_SUCCESS", {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    EXPECT_EQ(main->isResponseAvailable(), true);
+
+    EXPECT_EQ(main->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+    c.sendNotification("ntf", "data", {});
+
+    std::unique_lock<std::mutex> lock(g_mutex);
+
+    EXPECT_TRUE(g_cv.wait_for(lock, std::chrono::seconds(1), []{ return g_ntfData.size(); }));
+
+    EXPECT_EQ(g_ntfData, "ntf:data");
+}
+
+TEST(ShmSelectableChannel, bothRingsFull)
+{
+    // small rings, so both rings are full long before all requests are sent
+
+    ShmSelectableChannel c(SHM_TEST_ENDPOINT, 256);
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    std::shared_ptr<ShmChannel> main;
+
+    std::atomic<bool> connected(false);
+
+    std::thread client([&]() {
+            main = std::make_shared<ShmChannel>(SHM_TEST_ENDPOINT, cb);
+            connected = true;
+            });
+
+    for (int i = 0; i < 50 && !connected; i++)
+    {
+        ss.select(&sel, 100);
+    }
+
+    client.join();
+
+    ASSERT_NE(main, nullptr);
+
+    const int count = 100;
+
+    // responds to each request like syncd, blocking while response ring is full
+
+    std::thread server([&]() {
+            for (int i = 0; i < count;)
+            {
+                if (c.empty())
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(10));
+                    continue;
+                }
+
+                swss::KeyOpFieldsValuesTuple kco;
+
+                c.pop(kco, false);
+
+                c.set("SAI_STATUS_SUCCESS", { { "index", kfvKey(kco) } }, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+                i++;
+            }
+            });
+
+    // all requests are sent before any response is waited for
+
+    for (int i = 0; i < count; i++)
+    {
+        main->set(std::to_string(i), {}, "command");
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        swss::KeyOpFieldsValuesTuple kco;
+
+        ASSERT_EQ(main->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco), SAI_STATUS_SUCCESS);
+
+        EXPECT_EQ(fvValue(kfvFieldsValues(kco).at(0)), std::to_string(i));
+    }
+
+    server.join();
+
+    EXPECT_EQ(main->isResponseAvailable(), false);
+}
+
+TEST(ShmSelectableChannel, notificationRingFull)
+{
+    ShmSelectableChannel c(SHM_TEST_ENDPOINT, 256);
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    // client connects but never reads notifications
+
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+
+    ASSERT_GE(fd, 0);
+
+    sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+
+    addr.sun_family = AF_UNIX;
+
+    strncpy(addr.sun_path, SHM_TEST_ENDPOINT, sizeof(addr.sun_path) - 1);
+
+    ASSERT_EQ(connect(fd, (sockaddr*)&addr, sizeof(addr)), 0);
+
+    EXPECT_EQ(ss.select(&sel, 100), swss::Select::TIMEOUT);
+
+    // notifications are dropped when ring is full instead of waiting
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < 100; i++)
+    {
+        c.sendNotification("ntf", "data", {});
+    }
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    // disconnect is processed while notifications are still being sent
+
+    std::atomic<bool> done(false);
+
+    std::thread ntf([&]() {
+            while (!done)
+            {
+                c.sendNotification("ntf", "data", {});
+            }
+            });
+
+    close(fd);
+
+    start = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(ss.select(&sel, 100), swss::Select::TIMEOUT);
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    done = true;
+
+    ntf.join();
+
+    EXPECT_EQ(c.hasData(), false);
+}
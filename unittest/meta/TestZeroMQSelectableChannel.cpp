@@ -87,3 +87,53 @@ TEST(ZeroMQSelectableChannel, readData)
     c.pop(kco, false);
 }
 
+
+TEST(ZeroMQSelectableChannel, receiveAfterResponse)
+{
+    ZeroMQChannel client1("ipc:///tmp/zmq_test", "ipc:///tmp/zmq_test_ntf", cb);
+    ZeroMQChannel client2("ipc:///tmp/zmq_test", "ipc:///tmp/zmq_test_ntf", cb);
+
+    ZeroMQSelectableChannel c("ipc:///tmp/zmq_test");
+
+    swss::Select ss;
+
+    ss.addSelectable(&c);
+
+    swss::Selectable *sel = NULL;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    client1.set("key1", values, "command");
+    client2.set("key2", values, "command");
+
+    EXPECT_EQ(ss.select(&sel), swss::Select::OBJECT);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    c.pop(kco, false);
+
+    EXPECT_EQ(c.empty(), true);
+
+    auto first = kfvKey(kco);
+
+    c.set(first, values, "response");
+
+    // second request is received right after response is sent, unless it
+    // didn't arrive yet, then it must be signaled by select
+
+    if (c.empty())
+    {
+        EXPECT_EQ(ss.select(&sel, 1000), swss::Select::OBJECT);
+    }
+
+    ASSERT_EQ(c.empty(), false);
+
+    c.pop(kco, false);
+
+    EXPECT_NE(first, kfvKey(kco));
+
+    c.set(kfvKey(kco), values, "response");
+
+    EXPECT_EQ(client1.wait("response", kco), SAI_STATUS_SUCCESS);
+    EXPECT_EQ(client2.wait("response", kco), SAI_STATUS_SUCCESS);
+}
@@ -91,7 +91,8 @@ TEST(Sai, bulkGet)
     sai_status_t statuses[1] = {0};
 
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED,
+    // api not initialized
+    EXPECT_EQ(SAI_STATUS_FAILURE,
             sai.bulkGet(
                 SAI_OBJECT_TYPE_PORT,
                 1,
@@ -600,6 +601,248 @@ TEST(Sai, clearStats)
     thread->join();
 }
 
+TEST(Sai, bulkCreate)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    std::shared_ptr<sairedis::SaiInterface> dummy = std::make_shared<saimeta::DummySaiInterface>();
+
+    auto proxy = std::make_shared<Proxy>(dummy);
+
+    auto thread = std::make_shared<std::thread>(fun,proxy);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+    attr.value.booldata = true;
+
+    const sai_attribute_t* attrs[2] = { &attr, &attr };
+    uint32_t attrCount[2] = { 1, 1 };
+    sai_object_id_t oids[2] = { 0, 0 };
+    sai_status_t statuses[2] = { SAI_STATUS_FAILURE, SAI_STATUS_FAILURE };
+
+    // bulk create oid
+    auto status = sai.bulkCreate(
+            SAI_OBJECT_TYPE_PORT,
+            (sai_object_id_t)1,
+            2,
+            attrCount,
+            attrs,
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+            oids,
+            statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    sai_route_entry_t routes[2] = {};
+
+    routes[1].vr_id = 1;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    statuses[0] = statuses[1] = SAI_STATUS_FAILURE;
+
+    // bulk create entry
+    status = sai.bulkCreate(2, routes, attrCount, attrs, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    proxy->stop();
+
+    thread->join();
+}
+
+TEST(Sai, bulkRemove)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    std::shared_ptr<sairedis::SaiInterface> dummy = std::make_shared<saimeta::DummySaiInterface>();
+
+    auto proxy = std::make_shared<Proxy>(dummy);
+
+    auto thread = std::make_shared<std::thread>(fun,proxy);
+
+    sai_object_id_t oids[2] = { (sai_object_id_t)1, (sai_object_id_t)2 };
+    sai_status_t statuses[2] = { SAI_STATUS_FAILURE, SAI_STATUS_FAILURE };
+
+    // bulk remove oid
+    auto status = sai.bulkRemove(SAI_OBJECT_TYPE_PORT, 2, oids, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    sai_fdb_entry_t fdbs[2] = {};
+
+    statuses[0] = statuses[1] = SAI_STATUS_FAILURE;
+
+    // bulk remove entry
+    status = sai.bulkRemove(2, fdbs, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    proxy->stop();
+
+    thread->join();
+}
+
+TEST(Sai, bulkSet)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    std::shared_ptr<sairedis::SaiInterface> dummy = std::make_shared<saimeta::DummySaiInterface>();
+
+    auto proxy = std::make_shared<Proxy>(dummy);
+
+    auto thread = std::make_shared<std::thread>(fun,proxy);
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_PORT_ATTR_ADMIN_STATE;
+    attrs[0].value.booldata = true;
+    attrs[1].id = SAI_PORT_ATTR_ADMIN_STATE;
+    attrs[1].value.booldata = false;
+
+    sai_object_id_t oids[2] = { (sai_object_id_t)1, (sai_object_id_t)2 };
+    sai_status_t statuses[2] = { SAI_STATUS_FAILURE, SAI_STATUS_FAILURE };
+
+    // bulk set oid
+    auto status = sai.bulkSet(SAI_OBJECT_TYPE_PORT, 2, oids, attrs, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    sai_route_entry_t routes[2] = {};
+
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[1].value.s32 = SAI_PACKET_ACTION_DROP;
+
+    statuses[0] = statuses[1] = SAI_STATUS_FAILURE;
+
+    // bulk set entry
+    status = sai.bulkSet(2, routes, attrs, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[0], SAI_STATUS_SUCCESS);
+    EXPECT_EQ(statuses[1], SAI_STATUS_SUCCESS);
+
+    proxy->stop();
+
+    thread->join();
+}
+
+TEST(Sai, bulkGetProxy)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    std::shared_ptr<sairedis::SaiInterface> dummy = std::make_shared<saimeta::DummySaiInterface>();
+
+    auto proxy = std::make_shared<Proxy>(dummy);
+
+    auto thread = std::make_shared<std::thread>(fun,proxy);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+
+    sai_attribute_t* attrs[1] = { &attr };
+    uint32_t attrCount[1] = { 1 };
+    sai_object_id_t oids[1] = { (sai_object_id_t)1 };
+    sai_status_t statuses[1] = { SAI_STATUS_SUCCESS };
+
+    // dummy vendor bulk get is not implemented, status must be passed back
+    auto status = sai.bulkGet(SAI_OBJECT_TYPE_PORT, 1, oids, attrCount, attrs, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_NOT_IMPLEMENTED);
+    EXPECT_EQ(statuses[0], SAI_STATUS_FAILURE);
+
+    proxy->stop();
+
+    thread->join();
+}
+
+TEST(Sai, bulkStats)
+{
+    Sai sai;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    std::shared_ptr<sairedis::SaiInterface> dummy = std::make_shared<saimeta::DummySaiInterface>();
+
+    auto proxy = std::make_shared<Proxy>(dummy);
+
+    auto thread = std::make_shared<std::thread>(fun,proxy);
+
+    sai_object_key_t keys[2];
+
+    keys[0].key.object_id = (sai_object_id_t)1;
+    keys[1].key.object_id = (sai_object_id_t)2;
+
+    sai_stat_id_t counter_ids[2] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_IN_UCAST_PKTS };
+
+    uint64_t counters[4];
+
+    sai_status_t statuses[2];
+
+    auto status = sai.bulkGetStats(
+            (sai_object_id_t)1,
+            SAI_OBJECT_TYPE_PORT,
+            2,
+            keys,
+            2,
+            counter_ids,
+            SAI_STATS_MODE_BULK_READ,
+            statuses,
+            counters);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+
+    status = sai.bulkClearStats(
+            (sai_object_id_t)1,
+            SAI_OBJECT_TYPE_PORT,
+            2,
+            keys,
+            2,
+            counter_ids,
+            SAI_STATS_MODE_BULK_CLEAR,
+            statuses);
+
+    EXPECT_EQ(status, SAI_STATUS_SUCCESS);
+
+    // object type without stats
+    EXPECT_EQ(sai.bulkClearStats(
+            (sai_object_id_t)1,
+            SAI_OBJECT_TYPE_NULL,
+            2,
+            keys,
+            2,
+            counter_ids,
+            SAI_STATS_MODE_BULK_CLEAR,
+            statuses), SAI_STATUS_INVALID_PARAMETER);
+
+    proxy->stop();
+
+    thread->join();
+}
+
 static int ntfCounter = 0;
 
 static void onSwitchStateChange(
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "meta/sai_serialize.h"
 #include "SaiDump.h"
+#include <fstream>
 using namespace swss;
 
 #define ARRAYLEN(arr) (int)(sizeof(arr) / sizeof((arr)[0]))
@@ -55,6 +56,68 @@ TEST(SaiDump, dumpFromRedisRdbJson)
     EXPECT_EQ(SAI_STATUS_FAILURE, m_saiDump.dumpFromRedisRdbJson());
 }
 
+TEST(SaiDump, dumpFromRedisRdbJsonMaxSize)
+{
+    SWSS_LOG_ENTER();
+    std::ofstream file("./large.json");
+    file << "[" << std::string(2 * 1024 * 1024, ' ') << "]";
+    file.close();
+
+    syncd::SaiDump m_saiDump;
+    const char *cmd1[] = {"saidump", "-r", "./large.json", "-m", "1"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd1), const_cast<char **>(cmd1));
+    EXPECT_EQ(SAI_STATUS_FAILURE, m_saiDump.dumpFromRedisRdbJson());
+
+    const char *cmd2[] = {"saidump", "-r", "./large.json", "-m", "3"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd2), const_cast<char **>(cmd2));
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_saiDump.dumpFromRedisRdbJson());
+}
+
+TEST(SaiDump, dumpFromRedisRdbJsonStream)
+{
+    SWSS_LOG_ENTER();
+    std::ofstream file("./stream.json");
+    file << "[{";
+    file << "\"ROUTE_TABLE:10.0.0.0/24\":{\"protocol\":\"bgp\"},";
+    file << "\"ASIC_STATE:SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000\":{\"NULL\":\"NULL\",\"SAI_SWITCH_ATTR_INIT_SWITCH\":\"true\"},";
+    file << "\"ASIC_STATE:SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001\":{\"SAI_VLAN_ATTR_VLAN_ID\":\"2\"},";
+    file << "\"ASIC_STATE:SAI_OBJECT_TYPE_VLAN_MEMBER:oid:0x27000000000002\":{\"SAI_VLAN_MEMBER_ATTR_VLAN_ID\":\"oid:0x26000000000001\"},";
+    file << "\"ASIC_STATE:SAI_OBJECT_TYPE_VLAN:oid:0x26000000000003\":[]";
+    file << "}]";
+    file.close();
+
+    syncd::SaiDump m_saiDump;
+    const char *cmd1[] = {"saidump", "-r", "./stream.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd1), const_cast<char **>(cmd1));
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_saiDump.dumpFromRedisRdbJson());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output.find("ROUTE_TABLE"), std::string::npos);
+    EXPECT_EQ(output.find("NULL"), std::string::npos);
+    EXPECT_NE(output.find("SAI_OBJECT_TYPE_SWITCH oid:0x21000000000000 \n    SAI_SWITCH_ATTR_INIT_SWITCH : true\n\n"), std::string::npos);
+    EXPECT_NE(output.find("SAI_OBJECT_TYPE_VLAN oid:0x26000000000003 \n"), std::string::npos);
+
+    const char *cmd2[] = {"saidump", "-g", "-r", "./stream.json"};
+    optind = 0;
+    m_saiDump.handleCmdLine(ARRAYLEN(cmd2), const_cast<char **>(cmd2));
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m_saiDump.dumpFromRedisRdbJson());
+    output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("digraph"), std::string::npos);
+    EXPECT_NE(output.find("VLAN -> VLAN_MEMBER[ color = "), std::string::npos);
+
+    file.open("./stream.json");
+    file << "{\"ASIC_STATE:SAI_OBJECT_TYPE_VLAN:oid:0x26000000000001\":{\"SAI_VLAN_ATTR_VLAN_ID\":2}}";
+    file.close();
+
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(SAI_STATUS_FAILURE, m_saiDump.dumpFromRedisRdbJson());
+    testing::internal::GetCapturedStdout();
+}
+
 TEST(SaiDump, dumpFromRedisDb1)
 {
     SWSS_LOG_ENTER();
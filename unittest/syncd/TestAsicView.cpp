@@ -0,0 +1,136 @@
+#include "AsicView.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace syncd;
+
+TEST(AsicView, getNotProcessedObjectsBySignature)
+{
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"];
+    dump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000001"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_EGRESS";
+    dump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000002"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_INGRESS";
+    dump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000003"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_INGRESS";
+
+    AsicView view(dump);
+
+    int calls = 0;
+
+    auto builder = [&](const std::shared_ptr<const SaiObj> &obj) -> std::string
+    {
+        calls++;
+
+        if (!obj->hasAttr(SAI_BUFFER_POOL_ATTR_TYPE))
+            return "";
+
+        return obj->getSaiAttr(SAI_BUFFER_POOL_ATTR_TYPE)->getStrAttrValue();
+    };
+
+    auto list = view.getNotProcessedObjectsBySignature(SAI_OBJECT_TYPE_BUFFER_POOL, "SAI_BUFFER_POOL_TYPE_INGRESS", builder);
+
+    ASSERT_EQ(list.size(), 2);
+    EXPECT_EQ(list[0]->m_str_object_id, "oid:0x18000000000002");
+    EXPECT_EQ(list[1]->m_str_object_id, "oid:0x18000000000003");
+    EXPECT_EQ(calls, 3);
+
+    // object without signature is returned for every signature, and only
+    // new object is indexed
+
+    auto dummy = view.createDummyExistingObject(0x1234, 0x18000000000000);
+
+    list = view.getNotProcessedObjectsBySignature(SAI_OBJECT_TYPE_BUFFER_POOL, "SAI_BUFFER_POOL_TYPE_INGRESS", builder);
+
+    ASSERT_EQ(list.size(), 3);
+    EXPECT_EQ(list[0]->m_str_object_id, "oid:0x18000000000000");
+    EXPECT_EQ(calls, 4);
+
+    list = view.getNotProcessedObjectsBySignature(SAI_OBJECT_TYPE_BUFFER_POOL, "SAI_BUFFER_POOL_TYPE_BOTH", builder);
+
+    ASSERT_EQ(list.size(), 1);
+    EXPECT_EQ(list[0]->m_str_object_id, "oid:0x18000000000000");
+
+    // removed objects are removed from index without rebuild
+
+    view.m_vidToRid[0x18000000000002] = 0x5678;
+
+    view.asicRemoveObject(dummy);
+    view.asicRemoveObject(view.m_soOids.at("oid:0x18000000000002"));
+
+    list = view.getNotProcessedObjectsBySignature(SAI_OBJECT_TYPE_BUFFER_POOL, "SAI_BUFFER_POOL_TYPE_INGRESS", builder);
+
+    ASSERT_EQ(list.size(), 1);
+    EXPECT_EQ(list[0]->m_str_object_id, "oid:0x18000000000003");
+    EXPECT_EQ(calls, 4);
+
+    list = view.getNotProcessedObjectsBySignature(SAI_OBJECT_TYPE_BUFFER_POOL, "SAI_BUFFER_POOL_TYPE_BOTH", builder);
+
+    EXPECT_EQ(list.size(), 0);
+}
+
+TEST(AsicView, nativeEntryKeys)
+{
+    const std::string route = "{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000001\"}";
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"];
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000001"];
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:" + route]["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_DROP";
+
+    AsicView view(dump);
+
+    // bytes not used by IPv4 prefix don't take part in lookup
+
+    sai_object_meta_key_t mk;
+
+    memset(&mk, 0xff, sizeof(mk));
+
+    mk.objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+
+    sai_deserialize_route_entry(route, mk.objectkey.key.route_entry);
+
+    auto it = view.m_soRoutes.find(mk);
+
+    ASSERT_NE(it, view.m_soRoutes.end());
+    EXPECT_EQ(it->second->m_str_object_id, route);
+
+    mk.objectkey.key.route_entry.vr_id = 0x3000000000002;
+
+    EXPECT_EQ(view.m_soRoutes.find(mk), view.m_soRoutes.end());
+}
+
+TEST(AsicView, routesByPrefix)
+{
+    const std::string route = "{\"dest\":\"10.0.0.0/24\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000001\"}";
+
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"];
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000001"];
+    dump["SAI_OBJECT_TYPE_ROUTE_ENTRY:" + route]["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_DROP";
+
+    AsicView view(dump);
+
+    sai_ip_prefix_t prefix;
+
+    memset(&prefix, 0xff, sizeof(prefix));
+
+    sai_deserialize_ip_prefix("10.0.0.0/24", prefix);
+
+    auto it = view.m_routesByPrefix.find(prefix);
+
+    ASSERT_NE(it, view.m_routesByPrefix.end());
+    ASSERT_EQ(it->second.size(), 1);
+    EXPECT_EQ(it->second.at(0)->m_str_object_id, route);
+
+    sai_deserialize_ip_prefix("10.0.0.0/16", prefix);
+
+    EXPECT_EQ(view.m_routesByPrefix.find(prefix), view.m_routesByPrefix.end());
+}
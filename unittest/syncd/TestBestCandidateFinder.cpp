@@ -21,3 +21,41 @@ TEST(BestCandidateFinder, getSaiAttrFromDefaultValue)
     auto attr = BestCandidateFinder::getSaiAttrFromDefaultValue(av, sw, *meta);
     EXPECT_NE(attr, nullptr);
 }
+
+TEST(BestCandidateFinder, findCurrentBestMatchBySignature)
+{
+    swss::TableDump currentDump;
+
+    currentDump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"];
+    currentDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000001"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_EGRESS";
+    currentDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000001"]["SAI_BUFFER_POOL_ATTR_SIZE"] = "100";
+    currentDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000002"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_INGRESS";
+    currentDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000002"]["SAI_BUFFER_POOL_ATTR_SIZE"] = "200";
+
+    swss::TableDump temporaryDump;
+
+    temporaryDump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"];
+    temporaryDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000003"]["SAI_BUFFER_POOL_ATTR_TYPE"] = "SAI_BUFFER_POOL_TYPE_INGRESS";
+    temporaryDump["SAI_OBJECT_TYPE_BUFFER_POOL:oid:0x18000000000003"]["SAI_BUFFER_POOL_ATTR_SIZE"] = "100";
+
+    AsicView current(currentDump);
+    AsicView temporary(temporaryDump);
+
+    auto sw = std::make_shared<MockableSaiSwitchInterface>(0,0);
+
+    BestCandidateFinder bcf(current, temporary, sw);
+
+    auto tmp = temporary.m_soOids.at("oid:0x18000000000003");
+
+    // egress pool has more equal attributes, but different create only TYPE
+
+    auto match = bcf.findCurrentBestMatch(tmp);
+
+    ASSERT_NE(match, nullptr);
+
+    EXPECT_EQ(match->m_str_object_id, "oid:0x18000000000002");
+
+    current.m_soOids.at("oid:0x18000000000002")->setObjectStatus(SAI_OBJECT_STATUS_MATCHED);
+
+    EXPECT_EQ(bcf.findCurrentBestMatch(tmp), nullptr);
+}
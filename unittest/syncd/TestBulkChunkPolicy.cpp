@@ -0,0 +1,78 @@
+#include "BulkChunkPolicy.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+TEST(BulkChunkPolicy, parse)
+{
+    auto policy = BulkChunkPolicy::parse("");
+
+    EXPECT_FALSE(policy->isAutoTune());
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), 0);
+
+    policy = BulkChunkPolicy::parse("128,SAI_OBJECT_TYPE_ROUTE_ENTRY:1000");
+
+    EXPECT_FALSE(policy->isAutoTune());
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), 1000);
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_NEXT_HOP), 128);
+
+    policy = BulkChunkPolicy::parse("auto");
+
+    EXPECT_TRUE(policy->isAutoTune());
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), BulkChunkPolicy::AUTO_TUNE_INITIAL_CHUNK_SIZE);
+
+    EXPECT_THROW(BulkChunkPolicy::parse("foo"), std::runtime_error);
+    EXPECT_THROW(BulkChunkPolicy::parse("SAI_OBJECT_TYPE_FOO:10"), std::runtime_error);
+    EXPECT_THROW(BulkChunkPolicy::parse("SAI_OBJECT_TYPE_ROUTE_ENTRY:bar"), std::runtime_error);
+}
+
+TEST(BulkChunkPolicy, autoTune)
+{
+    auto policy = BulkChunkPolicy::parse("auto,64");
+
+    // not full chunks are ignored
+
+    for (uint32_t i = 0; i < BulkChunkPolicy::AUTO_TUNE_SAMPLES; i++)
+    {
+        policy->update(SAI_OBJECT_TYPE_ROUTE_ENTRY, 10, 1000);
+    }
+
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), 64);
+
+    // first measurement grows chunk
+
+    for (uint32_t i = 0; i < BulkChunkPolicy::AUTO_TUNE_SAMPLES; i++)
+    {
+        policy->update(SAI_OBJECT_TYPE_ROUTE_ENTRY, 64, 64 * 100);
+    }
+
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), 128);
+
+    // latency per object got worse, so chunk shrinks back
+
+    for (uint32_t i = 0; i < BulkChunkPolicy::AUTO_TUNE_SAMPLES; i++)
+    {
+        policy->update(SAI_OBJECT_TYPE_ROUTE_ENTRY, 128, 128 * 200);
+    }
+
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_ROUTE_ENTRY), 64);
+
+    // other object types are not affected
+
+    EXPECT_EQ(policy->getChunkSize(SAI_OBJECT_TYPE_NEXT_HOP), 64);
+}
+
+TEST(BulkChunkPolicy, bulkSupport)
+{
+    BulkChunkPolicy policy;
+
+    EXPECT_TRUE(policy.isBulkSupported(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_BULK_CREATE));
+
+    policy.setBulkNotSupported(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_BULK_CREATE);
+    policy.setBulkNotSupported(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_BULK_CREATE);
+
+    EXPECT_FALSE(policy.isBulkSupported(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_BULK_CREATE));
+    EXPECT_TRUE(policy.isBulkSupported(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_BULK_REMOVE));
+    EXPECT_TRUE(policy.isBulkSupported(SAI_OBJECT_TYPE_NEXT_HOP, SAI_COMMON_API_BULK_CREATE));
+}
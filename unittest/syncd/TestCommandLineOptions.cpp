@@ -7,7 +7,7 @@
 using namespace syncd;
 
 const std::string expected_usage =
-R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-h]
+R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-B supportingBulkCounters] [-L interval] [-P policy] [-k chunkSize] [-j threads] [-e] [-h]
     -d --diag
         Enable diagnostic shell
     -p --profile profile
@@ -25,7 +25,7 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
     -s --syncMode
         Enable synchronous mode (depreacated, use -z)
     -z --redisCommunicationMode
-        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async
+        Redis communication mode (redis_async|redis_sync|zmq_sync|shm_sync), default: redis_async
     -l --enableBulk
         Enable SAI Bulk support
     -g --globalContext
@@ -40,6 +40,16 @@ R"(Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [
         Counter groups those support bulk polling
     -a --enableAttrVersionCheck
         Enable attribute SAI version check when performing SAI discovery
+    -L --latencyStatsInterval interval
+        Record per operation latency and export it to COUNTERS_DB every interval seconds
+    -P --vendorSaiLockPolicy policy
+        Vendor SAI lock policy (global|domain|none), default: global
+    -k --bulkChunkSize chunkSize
+        Bulk chunk size per object type, e.g. auto,512,SAI_OBJECT_TYPE_ROUTE_ENTRY:1000
+    -j --bulkDeserializeThreads threads
+        Number of threads deserializing bulk objects in parallel, default: 0 (disabled)
+    -e --enableResponseBatch
+        Send responses of consecutively processed requests in single message (redis modes only)
     -h --help
         Print out this message
 )";
@@ -53,7 +63,7 @@ TEST(CommandLineOptions, getCommandLineString)
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
             " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig="
-            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO");
+            " WatchdogWarnTimeSpan=30000000 SupportingBulkCounters= EnableAttrVersionCheck=NO LatencyStatsInterval=0 VendorSaiLockPolicy=global BulkChunkSize= BulkDeserializeThreads=0 EnableResponseBatch=NO");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -81,9 +91,23 @@ TEST(CommandLineOptionsParser, parseCommandLine)
     char arg3[] = "1000";
     char arg4[] = "-B";
     char arg5[] = "WATERMARK";
-    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5};
+    char arg6[] = "-L";
+    char arg7[] = "10";
+    char arg8[] = "-P";
+    char arg9[] = "domain";
+    char arg10[] = "-k";
+    char arg11[] = "auto,512";
+    char arg12[] = "-j";
+    char arg13[] = "4";
+    char arg14[] = "-e";
+    std::vector<char *> args = {arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14};
 
     auto opt = syncd::CommandLineOptionsParser::parseCommandLine((int)args.size(), args.data());
     EXPECT_EQ(opt->m_watchdogWarnTimeSpan, 1000);
     EXPECT_EQ(opt->m_supportingBulkCounterGroups, "WATERMARK");
+    EXPECT_EQ(opt->m_latencyStatsInterval, 10);
+    EXPECT_EQ(opt->m_vendorSaiLockPolicy, VENDOR_SAI_LOCK_POLICY_DOMAIN);
+    EXPECT_EQ(opt->m_bulkChunkSize, "auto,512");
+    EXPECT_EQ(opt->m_bulkDeserializeThreads, 4);
+    EXPECT_EQ(opt->m_enableResponseBatch, true);
 }
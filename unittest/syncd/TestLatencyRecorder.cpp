@@ -0,0 +1,127 @@
+#include "LatencyRecorder.h"
+#include "LatencyScope.h"
+#include "LatencyStageTimer.h"
+
+#include "sairediscommon.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+static std::string getField(
+        _In_ const std::vector<swss::FieldValueTuple>& values,
+        _In_ const std::string& field)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::find_if(values.begin(), values.end(),
+            [&](const swss::FieldValueTuple& fvt) { return fvField(fvt) == field; });
+
+    return it == values.end() ? "" : fvValue(*it);
+}
+
+TEST(LatencyRecorder, disabled)
+{
+    LatencyRecorder lr("COUNTERS_DB", 0);
+
+    EXPECT_FALSE(lr.isEnabled());
+
+    {
+        LatencyScope ls(lr, REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        LatencyStageTimer timer(lr, LatencyRecorder::STAGE_VENDOR);
+
+        ls.setStatus(SAI_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(lr.getCounters().size(), 0);
+}
+
+TEST(LatencyRecorder, endEvent)
+{
+    LatencyRecorder lr("COUNTERS_DB", 3600);
+
+    EXPECT_TRUE(lr.isEnabled());
+
+    for (int i = 0; i < 3; i++)
+    {
+        lr.addStageTime(LatencyRecorder::STAGE_POP, 100);
+
+        lr.beginEvent(REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        lr.setObjectType(SAI_OBJECT_TYPE_PORT);
+
+        lr.addStageTime(LatencyRecorder::STAGE_VENDOR, 1000);
+        lr.addStageTime(LatencyRecorder::STAGE_VENDOR, 1000);
+
+        EXPECT_EQ(lr.getStageTime(LatencyRecorder::STAGE_VENDOR), 2000);
+
+        lr.endEvent(i ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE);
+
+        EXPECT_EQ(lr.getStageTime(LatencyRecorder::STAGE_VENDOR), 0);
+    }
+
+    auto counters = lr.getCounters();
+
+    EXPECT_EQ(counters.size(), 2);
+
+    auto& success = counters["create:SAI_OBJECT_TYPE_PORT:SUCCESS"];
+
+    EXPECT_EQ(getField(success, "pop_count"), "2");
+    EXPECT_EQ(getField(success, "vendor_count"), "2");
+    EXPECT_EQ(getField(success, "vendor_sum_ns"), "4000");
+    EXPECT_EQ(getField(success, "vendor_max_ns"), "2000");
+    EXPECT_EQ(getField(success, "total_count"), "2");
+    EXPECT_EQ(getField(success, "translate_count"), "");
+
+    auto& failure = counters["create:SAI_OBJECT_TYPE_PORT:FAILURE"];
+
+    EXPECT_EQ(getField(failure, "vendor_count"), "1");
+}
+
+TEST(LatencyRecorder, unknownOp)
+{
+    LatencyRecorder lr("COUNTERS_DB", 3600);
+
+    {
+        LatencyScope ls(lr, "foo");
+
+        ls.setStatus(SAI_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(lr.getCounters().size(), 0);
+}
+
+TEST(LatencyRecorder, unknownObjectType)
+{
+    LatencyRecorder lr("COUNTERS_DB", 3600);
+
+    for (auto ot: { SAI_OBJECT_TYPE_NULL, (sai_object_type_t)(SAI_OBJECT_TYPE_MAX + 1), (sai_object_type_t)(SAI_OBJECT_TYPE_MAX + 2) })
+    {
+        lr.beginEvent(REDIS_ASIC_STATE_COMMAND_CREATE);
+
+        lr.setObjectType(ot);
+
+        lr.addStageTime(LatencyRecorder::STAGE_VENDOR, 1000);
+
+        lr.endEvent(SAI_STATUS_SUCCESS);
+    }
+
+    auto counters = lr.getCounters();
+
+    EXPECT_EQ(counters.size(), 2);
+
+    EXPECT_EQ(getField(counters["create:SAI_OBJECT_TYPE_NULL:SUCCESS"], "vendor_count"), "1");
+    EXPECT_EQ(getField(counters["create:OTHER:SUCCESS"], "vendor_count"), "2");
+}
+
+TEST(LatencyRecorder, stageToString)
+{
+    EXPECT_EQ(LatencyRecorder::stageToString(LatencyRecorder::STAGE_TOTAL), "total");
+
+    EXPECT_THROW(LatencyRecorder::stageToString(LatencyRecorder::STAGE_MAX), std::runtime_error);
+}
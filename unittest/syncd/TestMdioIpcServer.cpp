@@ -6,6 +6,8 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -29,18 +31,18 @@ static sai_status_t MockMdioRead(
     _Out_ uint32_t *reg_val)
 {
     SWSS_LOG_ENTER();
-    uint64_t key = device_addr;
-    key <<= 32;
-    key |= start_reg_addr;
-    auto it = mdioDevRegValMap.find(key);
-    if (it == mdioDevRegValMap.end())
+    for (uint32_t i = 0; i < number_of_registers; i++)
     {
-        *reg_val = 0;
-        return SAI_STATUS_FAILURE;
-    }
-    else
-    {
-        *reg_val = it->second;
+        uint64_t key = device_addr;
+        key <<= 32;
+        key |= start_reg_addr + i;
+        auto it = mdioDevRegValMap.find(key);
+        if (it == mdioDevRegValMap.end())
+        {
+            reg_val[i] = 0;
+            return SAI_STATUS_FAILURE;
+        }
+        reg_val[i] = it->second;
     }
     return SAI_STATUS_SUCCESS;
 }
@@ -57,10 +59,13 @@ static sai_status_t MockMdioWrite(
     {
         return SAI_STATUS_FAILURE;
     }
-    uint64_t key = device_addr;
-    key <<= 32;
-    key |= start_reg_addr;
-    mdioDevRegValMap[key] = *reg_val;
+    for (uint32_t i = 0; i < number_of_registers; i++)
+    {
+        uint64_t key = device_addr;
+        key <<= 32;
+        key |= start_reg_addr + i;
+        mdioDevRegValMap[key] = reg_val[i];
+    }
     return SAI_STATUS_SUCCESS;
 }
 
@@ -72,18 +77,18 @@ static sai_status_t MockMdioCl22Read(
     _Out_ uint32_t *reg_val)
 {
     SWSS_LOG_ENTER();
-    uint64_t key = device_addr;
-    key <<= 32;
-    key |= start_reg_addr;
-    auto it = mdioDevCl22RegValMap.find(key);
-    if (it == mdioDevCl22RegValMap.end())
-    {
-        *reg_val = 0;
-        return SAI_STATUS_FAILURE;
-    }
-    else
+    for (uint32_t i = 0; i < number_of_registers; i++)
     {
-        *reg_val = it->second;
+        uint64_t key = device_addr;
+        key <<= 32;
+        key |= start_reg_addr + i;
+        auto it = mdioDevCl22RegValMap.find(key);
+        if (it == mdioDevCl22RegValMap.end())
+        {
+            reg_val[i] = 0;
+            return SAI_STATUS_FAILURE;
+        }
+        reg_val[i] = it->second;
     }
     return SAI_STATUS_SUCCESS;
 }
@@ -100,10 +105,13 @@ static sai_status_t MockMdioCl22Write(
     {
         return SAI_STATUS_FAILURE;
     }
-    uint64_t key = device_addr;
-    key <<= 32;
-    key |= start_reg_addr;
-    mdioDevCl22RegValMap[key] = *reg_val;
+    for (uint32_t i = 0; i < number_of_registers; i++)
+    {
+        uint64_t key = device_addr;
+        key <<= 32;
+        key |= start_reg_addr + i;
+        mdioDevCl22RegValMap[key] = reg_val[i];
+    }
     return SAI_STATUS_SUCCESS;
 }
 
@@ -169,8 +177,12 @@ TEST(MdioIpcServer, mdioAccess)
     rc = mdio_write(0xF0F0F0F0F0F0F0F0, MDIO_MISSING_DEV_ADDR, MDIO_MISSING_REG_ADDR, 1, &data);
     EXPECT_NE(rc, SAI_STATUS_SUCCESS);
 
+    data2[0] = 0x1111;
+    data2[1] = 0x2222;
     rc = mdio_write(0xF0F0F0F0F0F0F0F0, 0x3, 0x1B, 2, data2);
-    EXPECT_NE(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mdioDevRegValMap[key], 0x1111);
+    EXPECT_EQ(mdioDevRegValMap[key + 1], 0x2222);
 
     /* MDIO CL22 read */
     mdioDevCl22RegValMap.clear();
@@ -205,8 +217,57 @@ TEST(MdioIpcServer, mdioAccess)
     rc = mdio_write_cl22(0xF0F0F0F0F0F0F0F0, MDIO_MISSING_DEV_ADDR, MDIO_MISSING_REG_ADDR, 1, &data);
     EXPECT_NE(rc, SAI_STATUS_SUCCESS);
 
+    data2[0] = 0x1111;
+    data2[1] = 0x2222;
     rc = mdio_write_cl22(0xF0F0F0F0F0F0F0F0, 0x1, 0x1D, 2, data2);
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mdioDevCl22RegValMap[key], 0x1111);
+    EXPECT_EQ(mdioDevCl22RegValMap[key + 1], 0x2222);
+
+    rc = mdio_read(0xF0F0F0F0F0F0F0F0, 0x4, 0x1A, 0, &data);
+    EXPECT_EQ(rc, SAI_STATUS_INVALID_PARAMETER);
+
+    /* MDIO burst spanning several pipelined frames */
+    std::vector<uint32_t> burst(MDIO_IPC_MAX_REGS * (MDIO_IPC_PIPELINE_DEPTH + 1) + 3);
+    for (size_t i = 0; i < burst.size(); i++)
+    {
+        burst[i] = (uint32_t)(0xA000 + i);
+    }
+    mdioDevRegValMap.clear();
+    rc = mdio_write(0xF0F0F0F0F0F0F0F0, 0x5, 0x100, (uint32_t)burst.size(), burst.data());
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(mdioDevRegValMap.size(), burst.size());
+
+    std::vector<uint32_t> readback(burst.size(), 0);
+    rc = mdio_read(0xF0F0F0F0F0F0F0F0, 0x5, 0x100, (uint32_t)readback.size(), readback.data());
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(readback, burst);
+
+    /* failure in one frame is reported, following frames are still served */
+    key = 0x5;
+    key <<= 32;
+    key |= 0x100 + 1;
+    mdioDevRegValMap.erase(key);
+    rc = mdio_read(0xF0F0F0F0F0F0F0F0, 0x5, 0x100, (uint32_t)readback.size(), readback.data());
     EXPECT_NE(rc, SAI_STATUS_SUCCESS);
+    rc = mdio_read(0xF0F0F0F0F0F0F0F0, 0x5, 0x100 + MDIO_IPC_MAX_REGS, 2, data2);
+    EXPECT_EQ(rc, SAI_STATUS_SUCCESS);
+    EXPECT_EQ(data2[0], 0xA000 + MDIO_IPC_MAX_REGS);
+
+    /* legacy text protocol on the same server */
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un saddr;
+    memset(&saddr, 0, sizeof(saddr));
+    saddr.sun_family = AF_UNIX;
+    snprintf(saddr.sun_path, sizeof(saddr.sun_path), "%s/%s.srv", SYNCD_IPC_SOCK_SYNCD, SYNCD_IPC_SOCK_FILE);
+    EXPECT_EQ(connect(sock, (struct sockaddr *)&saddr, sizeof(saddr)), 0);
+
+    char resp[SYNCD_IPC_BUFF_SIZE] = { 0 };
+    const char *cmd = "mdio 0x5 0x102\n";
+    EXPECT_EQ(send(sock, cmd, strlen(cmd), 0), (ssize_t)strlen(cmd));
+    EXPECT_GT(recv(sock, resp, sizeof(resp) - 1, 0), 0);
+    EXPECT_EQ(std::string(resp), "0 0xa002\n");
+    close(sock);
 
     /* Test ipc client timeout */
     sleep(MDIO_CLIENT_TIMEOUT+1);
@@ -0,0 +1,85 @@
+#include "RedisClient.h"
+#include "lib/sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+TEST(RedisClient, replaceAsicView)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    dbAsic->flushdb();
+
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    const std::string sw = "SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000";
+    const std::string vr = "SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000001";
+    const std::string rif = "SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x6000000000002";
+
+    dbAsic->hset(ASIC_STATE_TABLE ":" + sw, "NULL", "NULL");
+    dbAsic->hset(ASIC_STATE_TABLE ":" + vr, "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "true");
+    dbAsic->hset(ASIC_STATE_TABLE ":" + rif, "SAI_ROUTER_INTERFACE_ATTR_MTU", "9100");
+    dbAsic->hset(TEMP_PREFIX ASIC_STATE_TABLE ":" + vr, "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "false");
+
+    auto currentView = client->getAsicView();
+
+    std::map<std::string, std::vector<swss::FieldValueTuple>> newView;
+
+    newView[sw];
+    newView[vr].emplace_back("SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE", "false");
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> map;
+
+    map[0x21000000000000] = 0x1;
+    map[0x3000000000001] = 0x2;
+
+    client->replaceAsicView(currentView, newView, map);
+
+    EXPECT_EQ(*dbAsic->hget(ASIC_STATE_TABLE ":" + sw, "NULL"), "NULL");
+    EXPECT_EQ(*dbAsic->hget(ASIC_STATE_TABLE ":" + vr, "SAI_VIRTUAL_ROUTER_ATTR_ADMIN_V4_STATE"), "false");
+    EXPECT_FALSE(dbAsic->exists(ASIC_STATE_TABLE ":" + rif));
+    EXPECT_FALSE(dbAsic->exists(TEMP_PREFIX ASIC_STATE_TABLE ":" + vr));
+
+    EXPECT_EQ(client->getRidForVid(0x3000000000001), 0x2);
+    EXPECT_EQ(client->getVidForRid(0x1), 0x21000000000000);
+}
+
+TEST(RedisClient, replaceAsicViewChunks)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    dbAsic->flushdb();
+
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    // more temporary keys than fit into single script call, all calls are
+    // executed in single transaction
+
+    for (int i = 0; i < 5000; i++)
+    {
+        dbAsic->hset(TEMP_PREFIX ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_ROUTE_ENTRY:" + std::to_string(i), "NULL", "NULL");
+    }
+
+    client->setVidAndRidMap({ { 0x21000000000000, 0x1 }, { 0x3000000000001, 0x2 }, { 0x3000000000002, 0x3 } });
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> map;
+
+    map[0x21000000000000] = 0x1;
+    map[0x3000000000001] = 0x4;
+
+    client->replaceAsicView(client->getAsicView(), {}, map);
+
+    EXPECT_TRUE(client->getTempAsicView().empty());
+
+    EXPECT_EQ(client->getVidToRidMap(), map);
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> ridToVid;
+
+    ridToVid[0x1] = 0x21000000000000;
+    ridToVid[0x4] = 0x3000000000001;
+
+    EXPECT_EQ(client->getRidToVidMap(), ridToVid);
+}
@@ -1,5 +1,6 @@
 #include "Syncd.h"
 #include "sai_serialize.h"
+#include "meta/Globals.h"
 #include "RequestShutdown.h"
 #include "vslib/ContextConfigContainer.h"
 #include "vslib/VirtualSwitchSaiInterface.h"
@@ -16,6 +17,8 @@
 #include "SelectableChannel.h"
 #include "swss/dbconnector.h"
 #include "swss/redisreply.h"
+#include "swss/redispipeline.h"
+#include "swss/select.h"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -210,6 +213,143 @@ TEST(Syncd, inspectAsic)
     EXPECT_EQ(SAI_STATUS_SUCCESS, sai->apiUninitialize());
 }
 
+TEST(Syncd, responseBatch)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0, true);
+
+    swss::RedisReply r(db.get(), "FLUSHALL", REDIS_REPLY_STATUS);
+
+    r.checkStatusOK();
+
+    sai_service_method_table_t smt;
+
+    smt.profile_get_value = &profileGetValue;
+    smt.profile_get_next_value = &profileGetNextValue;
+
+    auto vssai = std::make_shared<saivs::Sai>();
+
+    auto cmd = std::make_shared<CommandLineOptions>();
+
+    cmd->m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+    cmd->m_enableTempView = false;
+    cmd->m_enableResponseBatch = true;
+    cmd->m_profileMapFile = "profile.ini";
+
+    auto syncd = std::make_shared<Syncd>(vssai, cmd, false);
+
+    std::thread thread(syncd_thread, syncd);
+
+    auto sai = std::make_shared<sairedis::Sai>();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai->apiInitialize(0, &smt));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = SAI_REDIS_COMMUNICATION_MODE_REDIS_SYNC;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    sai_object_id_t switchId;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai->create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    // send requests in single pipeline, so syncd processes them in single pass
+
+    swss::RedisPipeline pipeline(db.get());
+
+    swss::ProducerTable producer(&pipeline, ASIC_STATE_TABLE, true);
+
+    std::string getKey = "SAI_OBJECT_TYPE_SWITCH:" + sai_serialize_object_id(switchId);
+
+    std::vector<swss::FieldValueTuple> getValues = { { "SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID", "oid:0x0" } };
+
+    sai_redis_notify_syncd_t notify = SAI_REDIS_NOTIFY_SYNCD_INSPECT_ASIC;
+
+    producer.set(getKey, getValues, REDIS_ASIC_STATE_COMMAND_GET);
+    producer.set(getKey, getValues, REDIS_ASIC_STATE_COMMAND_GET);
+    producer.set(sai_serialize(notify), {}, REDIS_ASIC_STATE_COMMAND_NOTIFY);
+    producer.set(getKey, getValues, REDIS_ASIC_STATE_COMMAND_GET);
+    producer.set(getKey, getValues, REDIS_ASIC_STATE_COMMAND_GET);
+
+    producer.flush();
+
+    // responses queued before notify are sent before processing it
+
+    swss::ConsumerTable consumer(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    swss::Select s;
+
+    s.addSelectable(&consumer);
+
+    std::vector<swss::KeyOpFieldsValuesTuple> batches;
+
+    while (batches.size() < 2)
+    {
+        swss::Selectable *sel;
+
+        if (s.select(&sel, 5000) != swss::Select::OBJECT)
+        {
+            break;
+        }
+
+        while (!consumer.empty())
+        {
+            swss::KeyOpFieldsValuesTuple kco;
+
+            consumer.pop(kco);
+
+            batches.push_back(kco);
+        }
+    }
+
+    ASSERT_EQ(2, batches.size());
+
+    std::vector<uint64_t> sequences;
+    std::vector<swss::KeyOpFieldsValuesTuple> responses;
+
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE, kfvOp(batches[0]));
+
+    saimeta::Globals::parseBatchResponse(kfvFieldsValues(batches[0]), sequences, responses);
+
+    ASSERT_EQ(2, responses.size());
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kfvOp(responses[0]));
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kfvOp(responses[1]));
+
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_BATCH_RESPONSE, kfvOp(batches[1]));
+
+    uint64_t lastSequence = sequences.back();
+
+    saimeta::Globals::parseBatchResponse(kfvFieldsValues(batches[1]), sequences, responses);
+
+    ASSERT_EQ(3, responses.size());
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_NOTIFY, kfvOp(responses[0]));
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kfvOp(responses[1]));
+    EXPECT_EQ(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kfvOp(responses[2]));
+
+    // sequence continues across batches
+
+    EXPECT_EQ(lastSequence + 1, sequences[0]);
+    EXPECT_EQ(lastSequence + 3, sequences[2]);
+
+    auto opt = std::make_shared<RequestShutdownCommandLineOptions>();
+
+    opt->setRestartType(SYNCD_RESTART_TYPE_COLD);
+
+    RequestShutdown rs(opt);
+
+    rs.send();
+
+    thread.join();
+
+    syncd = nullptr;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai->apiUninitialize());
+}
+
 using namespace syncd;
 
 #ifdef MOCK_METHOD
@@ -0,0 +1,41 @@
+#include "TimerWatchdog.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace syncd;
+
+TEST(TimerWatchdog, callbackCanUseWatchdog)
+{
+    TimerWatchdog wd(1000); // 1ms
+
+    std::atomic<bool> called(false);
+
+    wd.setCallback([&](uint64_t span) {
+
+        // callback is executed outside watchdog mutex, so it can call
+        // watchdog api without deadlock
+
+        wd.setEventData("callback");
+        wd.setEndTime();
+
+        called = true;
+    });
+
+    wd.setEventData("hanged");
+    wd.setStartTime();
+
+    for (int i = 0; i < 50 && !called; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    EXPECT_TRUE(called);
+
+    wd.setCallback(nullptr);
+}
@@ -131,6 +131,22 @@ TEST_F(VendorSaiTest, portBulkAddRemove)
     {
         ASSERT_EQ(statusList.at(i), SAI_STATUS_SUCCESS);
     }
+
+    auto records = m_vsai->getCallTrace()->getRecords();
+
+    ASSERT_GE(records.size(), 2);
+
+    auto& create = records[records.size() - 2];
+    auto& remove = records[records.size() - 1];
+
+    EXPECT_STREQ(create.api, "bulkCreate");
+    EXPECT_EQ(create.objectType, SAI_OBJECT_TYPE_PORT);
+    EXPECT_EQ(create.objectCount, portCount);
+    EXPECT_EQ(create.status, SAI_STATUS_SUCCESS);
+    EXPECT_FALSE(create.inProgress);
+
+    EXPECT_STREQ(remove.api, "bulkRemove");
+    EXPECT_EQ(remove.keyHash, oidList.at(0));
 }
 
 TEST(VendorSai, bulkGetStats)
@@ -178,6 +194,43 @@ TEST(VendorSai, clearStats)
                                                        nullptr));
 }
 
+TEST(VendorSai, lockPolicy)
+{
+    VendorSai sai;
+
+    // default is single global lock
+
+    EXPECT_EQ(sai.getLockStats().size(), 1);
+
+    auto vso = std::make_shared<VendorSaiOptions>();
+
+    vso->m_lockPolicy = VENDOR_SAI_LOCK_POLICY_DOMAIN;
+
+    sai.setOptions(VendorSaiOptions::OPTIONS_KEY, vso);
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    sai.clearStats(SAI_OBJECT_TYPE_NULL, SAI_NULL_OBJECT_ID, 0, nullptr);
+
+    auto stats = sai.getLockStats();
+
+    ASSERT_EQ(stats.size(), 2);
+
+    EXPECT_EQ(stats[0].name, "config");
+    EXPECT_EQ(stats[1].name, "stats");
+    EXPECT_EQ(stats[1].acquisitions, 2); // api initialize and clear stats
+
+    sai.logLockStats();
+
+    EXPECT_EQ(sai.apiUninitialize(), SAI_STATUS_SUCCESS);
+
+    vso->m_lockPolicy = VENDOR_SAI_LOCK_POLICY_NONE;
+
+    EXPECT_EQ(sai.apiInitialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    EXPECT_EQ(sai.getLockStats().size(), 0);
+}
+
 sai_object_id_t create_port(
         _In_ VendorSai& sai,
         _In_ sai_object_id_t switch_id)
@@ -0,0 +1,140 @@
+#include "VendorSaiCallTrace.h"
+#include "VendorSaiCallScope.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace syncd;
+
+TEST(VendorSaiCallTrace, beginEnd)
+{
+    VendorSaiCallTrace trace(4);
+
+    EXPECT_EQ(trace.getSize(), 4);
+    EXPECT_EQ(trace.getRecords().size(), 0);
+
+    auto seq = trace.begin("create", SAI_OBJECT_TYPE_PORT, 0x1000, 1);
+
+    auto records = trace.getRecords();
+
+    ASSERT_EQ(records.size(), 1);
+
+    EXPECT_EQ(records[0].seq, seq);
+    EXPECT_STREQ(records[0].api, "create");
+    EXPECT_EQ(records[0].objectType, SAI_OBJECT_TYPE_PORT);
+    EXPECT_EQ(records[0].keyHash, 0x1000);
+    EXPECT_EQ(records[0].objectCount, 1);
+    EXPECT_NE(records[0].threadId, 0);
+    EXPECT_TRUE(records[0].inProgress);
+
+    trace.end(seq, SAI_STATUS_INVALID_PARAMETER);
+
+    records = trace.getRecords();
+
+    ASSERT_EQ(records.size(), 1);
+
+    EXPECT_FALSE(records[0].inProgress);
+    EXPECT_EQ(records[0].status, SAI_STATUS_INVALID_PARAMETER);
+
+    trace.dump("test");
+}
+
+TEST(VendorSaiCallTrace, wrap)
+{
+    VendorSaiCallTrace trace(4);
+
+    uint64_t last = 0;
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        last = trace.begin("bulkCreate", SAI_OBJECT_TYPE_ROUTE_ENTRY, i, i);
+
+        trace.end(last, SAI_STATUS_SUCCESS);
+    }
+
+    auto records = trace.getRecords();
+
+    ASSERT_EQ(records.size(), 4);
+
+    // oldest first
+
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        EXPECT_EQ(records[i].seq, last - 3 + i);
+        EXPECT_EQ(records[i].keyHash, 6 + i);
+    }
+
+    // ending call which slot was already reused must not modify newer call
+
+    auto seq = trace.begin("remove", SAI_OBJECT_TYPE_PORT, 1, 1);
+
+    trace.end(seq - 4, SAI_STATUS_FAILURE);
+
+    records = trace.getRecords();
+
+    EXPECT_EQ(records.back().seq, seq);
+    EXPECT_TRUE(records.back().inProgress);
+
+    trace.dump("test");
+}
+
+TEST(VendorSaiCallTrace, hash)
+{
+    sai_route_entry_t a = {};
+    sai_route_entry_t b = {};
+
+    b.destination.addr.ip4 = 1;
+
+    auto ot = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+
+    EXPECT_EQ(VendorSaiCallTrace::hashEntry(ot, &a), VendorSaiCallTrace::hashEntry(ot, &a));
+    EXPECT_NE(VendorSaiCallTrace::hashEntry(ot, &a), VendorSaiCallTrace::hashEntry(ot, &b));
+    EXPECT_EQ(VendorSaiCallTrace::hashEntry(ot, (sai_route_entry_t*)nullptr), 0);
+
+    // bytes not used by IPv4 prefix must not change hash
+
+    memset(&a, 0x00, sizeof(a));
+    memset(&b, 0xff, sizeof(b));
+
+    a.destination.addr_family = b.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    a.destination.addr.ip4 = b.destination.addr.ip4 = 0x0100000a;
+    a.destination.mask.ip4 = b.destination.mask.ip4 = 0x00ffffff;
+    a.switch_id = b.switch_id = 0x21000000000000;
+    a.vr_id = b.vr_id = 0x3000000000001;
+
+    EXPECT_EQ(VendorSaiCallTrace::hashEntry(ot, &a), VendorSaiCallTrace::hashEntry(ot, &b));
+}
+
+TEST(VendorSaiCallScope, end)
+{
+    VendorSaiCallTrace trace(4);
+
+    {
+        VendorSaiCallScope scope(trace, "get", SAI_OBJECT_TYPE_SWITCH, 1, 1);
+
+        EXPECT_EQ(scope.end(SAI_STATUS_SUCCESS), SAI_STATUS_SUCCESS);
+    }
+
+    try
+    {
+        VendorSaiCallScope scope(trace, "set", SAI_OBJECT_TYPE_SWITCH, 1, 1);
+
+        throw std::runtime_error("vendor exception");
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    auto records = trace.getRecords();
+
+    ASSERT_EQ(records.size(), 2);
+
+    EXPECT_FALSE(records[0].inProgress);
+    EXPECT_EQ(records[0].status, SAI_STATUS_SUCCESS);
+
+    EXPECT_FALSE(records[1].inProgress);
+    EXPECT_EQ(records[1].status, SAI_STATUS_FAILURE);
+}
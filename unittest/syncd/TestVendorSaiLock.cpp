@@ -0,0 +1,81 @@
+#include "VendorSaiLock.h"
+#include "VendorSaiLockGuard.h"
+#include "VendorSaiOptions.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <chrono>
+
+using namespace syncd;
+
+TEST(VendorSaiLock, uncontended)
+{
+    VendorSaiLock lock("config");
+
+    {
+        VendorSaiLockGuard guard(&lock);
+    }
+
+    {
+        VendorSaiLockGuard guard(&lock);
+
+        guard.unlock();
+        guard.unlock(); // second unlock is no op
+    }
+
+    auto stats = lock.getStats();
+
+    EXPECT_EQ(stats.name, "config");
+    EXPECT_EQ(stats.acquisitions, 2);
+    EXPECT_EQ(stats.contentions, 0);
+    EXPECT_EQ(stats.waitTime, 0);
+}
+
+TEST(VendorSaiLock, contended)
+{
+    VendorSaiLock lock("stats");
+
+    lock.lock();
+
+    std::thread thread([&]()
+            {
+                VendorSaiLockGuard guard(&lock);
+            });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    lock.unlock();
+
+    thread.join();
+
+    auto stats = lock.getStats();
+
+    EXPECT_EQ(stats.acquisitions, 2);
+    EXPECT_EQ(stats.contentions, 1);
+    EXPECT_GT(stats.waitTime, 0);
+    EXPECT_EQ(stats.waitTime, stats.maxWaitTime);
+}
+
+TEST(VendorSaiLockGuard, null)
+{
+    VendorSaiLockGuard guard(nullptr);
+
+    guard.unlock();
+}
+
+TEST(VendorSaiOptions, lockPolicy)
+{
+    EXPECT_EQ(VendorSaiOptions::lockPolicyFromString("global"), VENDOR_SAI_LOCK_POLICY_GLOBAL);
+    EXPECT_EQ(VendorSaiOptions::lockPolicyFromString("domain"), VENDOR_SAI_LOCK_POLICY_DOMAIN);
+    EXPECT_EQ(VendorSaiOptions::lockPolicyFromString("none"), VENDOR_SAI_LOCK_POLICY_NONE);
+
+    EXPECT_THROW(VendorSaiOptions::lockPolicyFromString("foo"), std::runtime_error);
+
+    EXPECT_EQ(VendorSaiOptions::lockPolicyToString(VENDOR_SAI_LOCK_POLICY_GLOBAL), "global");
+    EXPECT_EQ(VendorSaiOptions::lockPolicyToString(VENDOR_SAI_LOCK_POLICY_DOMAIN), "domain");
+    EXPECT_EQ(VendorSaiOptions::lockPolicyToString(VENDOR_SAI_LOCK_POLICY_NONE), "none");
+    EXPECT_EQ(VendorSaiOptions::lockPolicyToString((vendor_sai_lock_policy_t)10), "unknown");
+}
@@ -0,0 +1,123 @@
+#include "WorkerPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+using namespace syncd;
+
+TEST(WorkerPool, ctr)
+{
+    EXPECT_THROW(std::make_shared<WorkerPool>(0), std::runtime_error);
+
+    WorkerPool pool(3);
+
+    EXPECT_EQ(pool.getWorkerCount(), 3);
+}
+
+TEST(WorkerPool, run)
+{
+    WorkerPool pool(4);
+
+    std::vector<size_t> workers(1000, SIZE_MAX);
+
+    std::atomic<size_t> calls(0);
+
+    auto errors = pool.run(10, workers.size(), [&](size_t index, size_t worker) {
+        workers[index] = worker;
+        calls++;
+    });
+
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(calls, workers.size() - 10);
+
+    EXPECT_EQ(workers[9], SIZE_MAX);
+
+    // ranges are contiguous and ordered by worker
+
+    for (size_t i = 11; i < workers.size(); i++)
+    {
+        EXPECT_GE(workers[i], workers[i - 1]);
+        EXPECT_LT(workers[i], 4);
+    }
+
+    EXPECT_EQ(workers[10], 0);
+    EXPECT_EQ(workers.back(), 3);
+
+    // empty range
+
+    errors = pool.run(5, 5, [&](size_t index, size_t worker) { calls++; });
+
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(calls, workers.size() - 10);
+}
+
+TEST(WorkerPool, errors)
+{
+    WorkerPool pool(2);
+
+    std::atomic<size_t> calls(0);
+
+    auto errors = pool.run(0, 100, [&](size_t index, size_t worker) {
+        calls++;
+
+        if (index % 30 == 7)
+        {
+            throw std::runtime_error(std::to_string(index));
+        }
+    });
+
+    // all indexes are processed even when some of them failed
+
+    EXPECT_EQ(calls, 100);
+    EXPECT_EQ(errors.size(), 4);
+
+    EXPECT_EQ(errors.begin()->first, 7);
+
+    EXPECT_THROW(std::rethrow_exception(errors.at(97)), std::runtime_error);
+}
+
+TEST(WorkerPool, startWait)
+{
+    WorkerPool pool(1);
+
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+
+    std::mutex mutex;
+
+    std::atomic<size_t> calls(0);
+
+    // range is executed while caller holds mutex, so start didn't block
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        pool.start(0, 3, [&](size_t index, size_t worker) {
+            std::lock_guard<std::mutex> l(mutex);
+
+            calls++;
+
+            if (index == 1)
+            {
+                throw std::runtime_error("1");
+            }
+        });
+
+        EXPECT_EQ(calls, 0);
+    }
+
+    auto errors = pool.wait();
+
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(errors.size(), 1);
+    EXPECT_EQ(errors.begin()->first, 1);
+
+    // pool can be reused by run after wait
+
+    errors = pool.run(0, 2, [&](size_t index, size_t worker) { calls++; });
+
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(calls, 5);
+}
@@ -0,0 +1,106 @@
+#include "FdbInfoSet.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+static FdbInfo makeFdbInfo(
+        _In_ uint8_t mac,
+        _In_ sai_vlan_id_t vlanId,
+        _In_ uint32_t timestamp)
+{
+    FdbInfo fi;
+
+    fi.m_fdbEntry.mac_address[5] = mac;
+    fi.setVlanId(vlanId);
+    fi.setTimestamp(timestamp);
+
+    return fi;
+}
+
+TEST(FdbInfoSet, insert)
+{
+    FdbInfoSet set;
+
+    set.insert(makeFdbInfo(1, 10, 100));
+    set.insert(makeFdbInfo(1, 20, 100));
+    set.insert(makeFdbInfo(1, 10, 105));
+
+    EXPECT_EQ(set.size(), 2);
+
+    EXPECT_TRUE(set.contains(makeFdbInfo(1, 10, 0)));
+    EXPECT_FALSE(set.contains(makeFdbInfo(2, 10, 0)));
+
+    // refreshed entry is moved to the end
+
+    EXPECT_EQ(set.begin()->getVlanId(), 20);
+}
+
+TEST(FdbInfoSet, refresh)
+{
+    FdbInfoSet set;
+
+    EXPECT_FALSE(set.refresh(makeFdbInfo(1, 10, 0), 100));
+
+    set.insert(makeFdbInfo(1, 10, 100));
+    set.insert(makeFdbInfo(2, 10, 101));
+
+    EXPECT_TRUE(set.refresh(makeFdbInfo(1, 10, 0), 110));
+
+    auto aged = set.extractAged(111, 10);
+
+    ASSERT_EQ(aged.size(), 1);
+
+    EXPECT_EQ(aged[0].m_fdbEntry.mac_address[5], 2);
+
+    EXPECT_EQ(set.size(), 1);
+}
+
+TEST(FdbInfoSet, erase)
+{
+    FdbInfoSet set;
+
+    set.insert(makeFdbInfo(1, 10, 100));
+
+    EXPECT_FALSE(set.erase(makeFdbInfo(1, 20, 0)));
+    EXPECT_TRUE(set.erase(makeFdbInfo(1, 10, 0)));
+
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.extractAged(200, 10).size(), 0);
+}
+
+TEST(FdbInfoSet, extractAged)
+{
+    FdbInfoSet set;
+
+    set.insert(makeFdbInfo(1, 10, 100));
+    set.insert(makeFdbInfo(2, 10, 102));
+    set.insert(makeFdbInfo(3, 10, 104));
+
+    EXPECT_EQ(set.extractAged(105, 10).size(), 0);
+    EXPECT_EQ(set.extractAged(112, 10).size(), 2);
+    EXPECT_EQ(set.size(), 1);
+
+    EXPECT_FALSE(set.contains(makeFdbInfo(1, 10, 0)));
+    EXPECT_TRUE(set.contains(makeFdbInfo(3, 10, 0)));
+}
+
+TEST(FdbInfoSet, assignFromSet)
+{
+    std::set<FdbInfo> warm;
+
+    warm.insert(makeFdbInfo(1, 10, 104));
+    warm.insert(makeFdbInfo(2, 10, 100));
+
+    FdbInfoSet set;
+
+    set.insert(makeFdbInfo(3, 10, 50));
+
+    set = warm;
+
+    EXPECT_EQ(set.size(), 2);
+
+    // ordered by timestamp, not by key
+
+    EXPECT_EQ(set.begin()->getTimestamp(), 100);
+}
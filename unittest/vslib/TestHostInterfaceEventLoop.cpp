@@ -0,0 +1,83 @@
+#include "HostInterfaceEventLoop.h"
+
+#include "swss/logger.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace saivs;
+
+TEST(HostInterfaceEventLoop, addFd)
+{
+    auto& loop = HostInterfaceEventLoop::getInstance();
+
+    int fd = eventfd(0, EFD_NONBLOCK);
+
+    ASSERT_GE(fd, 0);
+
+    std::atomic<int> calls(0);
+
+    loop.addFd(fd, [&]() {
+            uint64_t value;
+            EXPECT_EQ(read(fd, &value, sizeof(value)), (ssize_t)sizeof(value));
+            calls++;
+            return true;
+            });
+
+    uint64_t value = 1;
+
+    EXPECT_EQ(write(fd, &value, sizeof(value)), (ssize_t)sizeof(value));
+
+    for (int i = 0; i < 100 && calls == 0; i++)
+    {
+        usleep(10*1000);
+    }
+
+    EXPECT_EQ(calls, 1);
+
+    loop.removeFd(fd);
+
+    // removed descriptor is not watched anymore
+
+    EXPECT_EQ(write(fd, &value, sizeof(value)), (ssize_t)sizeof(value));
+
+    usleep(100*1000);
+
+    EXPECT_EQ(calls, 1);
+
+    close(fd);
+}
+
+TEST(HostInterfaceEventLoop, callbackStopsWatching)
+{
+    auto& loop = HostInterfaceEventLoop::getInstance();
+
+    int fd = eventfd(0, EFD_NONBLOCK);
+
+    ASSERT_GE(fd, 0);
+
+    std::atomic<int> calls(0);
+
+    // descriptor is not read, so it would be reported again if still watched
+
+    loop.addFd(fd, [&]() {
+            calls++;
+            return false;
+            });
+
+    uint64_t value = 1;
+
+    EXPECT_EQ(write(fd, &value, sizeof(value)), (ssize_t)sizeof(value));
+
+    usleep(100*1000);
+
+    EXPECT_EQ(calls, 1);
+
+    loop.removeFd(fd);
+
+    close(fd);
+}
@@ -4,6 +4,7 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <unistd.h>
 
 #include <gtest/gtest.h>
 
@@ -68,3 +69,49 @@ TEST(HostInterfaceInfo, async_process_packet_for_fdb_event)
     close(s);
     close(fd);
 }
+
+TEST(HostInterfaceInfo, forward)
+{
+    auto eq = std::make_shared<EventQueue>(std::make_shared<Signal>());
+
+    int veth[2];
+    int tap[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, veth), 0);
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, tap), 0);
+
+    {
+        // tap fd is closed by destructor
+
+        HostInterfaceInfo hii(0, veth[0], tap[0], "tap", 0, eq);
+
+        struct timeval tv = { 1, 0 };
+
+        setsockopt(veth[1], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        setsockopt(tap[1], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+        unsigned char frame[64] = { 0 };
+        unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
+
+        // both directions are served by shared event loop
+
+        for (int i = 0; i < 3; i++)
+        {
+            frame[0] = (unsigned char)i;
+
+            EXPECT_EQ(write(tap[1], frame, sizeof(frame)), (ssize_t)sizeof(frame));
+
+            EXPECT_EQ(read(veth[1], buffer, sizeof(buffer)), (ssize_t)sizeof(frame));
+            EXPECT_EQ(buffer[0], i);
+
+            EXPECT_EQ(write(veth[1], frame, sizeof(frame)), (ssize_t)sizeof(frame));
+
+            EXPECT_EQ(read(tap[1], buffer, sizeof(buffer)), (ssize_t)sizeof(frame));
+            EXPECT_EQ(buffer[0], i);
+        }
+    }
+
+    close(veth[0]);
+    close(veth[1]);
+    close(tap[1]);
+}
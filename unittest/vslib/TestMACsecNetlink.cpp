@@ -0,0 +1,93 @@
+#include "MACsecNetlink.h"
+
+#include <gtest/gtest.h>
+
+#include <endian.h>
+
+using namespace saivs;
+
+TEST(MACsecNetlink, parseSci)
+{
+    uint64_t sci = 0;
+
+    EXPECT_TRUE(MACsecNetlink::parseSci("0242ac1100030001", sci));
+
+    EXPECT_EQ(sci, htobe64(0x0242ac1100030001ULL));
+
+    EXPECT_FALSE(MACsecNetlink::parseSci("0242ac110003", sci));
+    EXPECT_FALSE(MACsecNetlink::parseSci("0242ac11000300zz", sci));
+    EXPECT_FALSE(MACsecNetlink::parseSci("02:42:ac:11:00:03", sci));
+}
+
+TEST(MACsecNetlink, parseHex)
+{
+    uint8_t buffer[4];
+
+    EXPECT_TRUE(MACsecNetlink::parseHex("a1b2c3d4", sizeof(buffer), buffer));
+
+    EXPECT_EQ(buffer[0], 0xa1);
+    EXPECT_EQ(buffer[3], 0xd4);
+
+    // shorter value is left padded
+
+    EXPECT_TRUE(MACsecNetlink::parseHex("0102", sizeof(buffer), buffer));
+
+    EXPECT_EQ(buffer[0], 0);
+    EXPECT_EQ(buffer[1], 0);
+    EXPECT_EQ(buffer[2], 1);
+    EXPECT_EQ(buffer[3], 2);
+
+    EXPECT_FALSE(MACsecNetlink::parseHex("a1b2c3d4e5", sizeof(buffer), buffer));
+    EXPECT_FALSE(MACsecNetlink::parseHex("a1b", sizeof(buffer), buffer));
+    EXPECT_FALSE(MACsecNetlink::parseHex("g1", sizeof(buffer), buffer));
+}
+
+TEST(MACsecNetlink, missingDevice)
+{
+    MACsecNetlink netlink;
+
+    uint64_t pn = 0;
+
+    EXPECT_FALSE(netlink.addRxSc("macsec_not_existing", "0242ac1100030001"));
+    EXPECT_FALSE(netlink.delSa("macsec_not_existing", true, "0242ac1100030001", 0));
+    EXPECT_FALSE(netlink.getSaPn("macsec_not_existing", true, "0242ac1100030001", 0, pn));
+
+    MACsecNetlink::DeviceState state;
+
+    EXPECT_FALSE(netlink.getDeviceState("macsec_not_existing", state));
+}
+
+TEST(MACsecNetlink, DeviceState_findSc)
+{
+    MACsecNetlink::DeviceState state;
+
+    state.m_txSc.m_sci = htobe64(0x0242ac1100030001ULL);
+    state.m_txSc.m_sas = { { 0, 10 }, { 1, 20 } };
+
+    MACsecNetlink::ScState rxsc;
+
+    rxsc.m_sci = htobe64(0x5254001234560001ULL);
+    rxsc.m_sas = { { 3, 30 } };
+
+    state.m_rxScs.push_back(rxsc);
+
+    auto sc = state.findSc(true, "0242ac1100030001");
+
+    ASSERT_NE(sc, nullptr);
+    ASSERT_NE(sc->findSa(1), nullptr);
+
+    EXPECT_EQ(sc->findSa(1)->m_pn, 20);
+    EXPECT_EQ(sc->findSa(2), nullptr);
+
+    EXPECT_EQ(state.findSc(false, "0242ac1100030001"), nullptr);
+    EXPECT_EQ(state.findSc(true, "5254001234560001"), nullptr);
+
+    sc = state.findSc(false, "5254001234560001");
+
+    ASSERT_NE(sc, nullptr);
+    ASSERT_NE(sc->findSa(3), nullptr);
+
+    EXPECT_EQ(sc->findSa(3)->m_pn, 30);
+
+    EXPECT_EQ(state.findSc(false, "invalid"), nullptr);
+}
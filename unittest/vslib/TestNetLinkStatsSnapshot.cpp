@@ -0,0 +1,47 @@
+#include "NetLinkStatsSnapshot.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+static const std::map<sai_stat_id_t, std::string> g_statIdMap =
+{
+        { SAI_PORT_STAT_IF_IN_OCTETS, "rx_bytes" },
+        { SAI_PORT_STAT_IF_OUT_DISCARDS, "tx_dropped" },
+        { SAI_PORT_STAT_PFC_0_RX_PKTS, "not_netlink_stat" }
+};
+
+TEST(NetLinkStatsSnapshot, isStatSupported)
+{
+    NetLinkStatsSnapshot snapshot(g_statIdMap);
+
+    EXPECT_TRUE(snapshot.isStatSupported(SAI_PORT_STAT_IF_IN_OCTETS));
+    EXPECT_TRUE(snapshot.isStatSupported(SAI_PORT_STAT_IF_OUT_DISCARDS));
+
+    EXPECT_FALSE(snapshot.isStatSupported(SAI_PORT_STAT_PFC_0_RX_PKTS));
+    EXPECT_FALSE(snapshot.isStatSupported(SAI_PORT_STAT_IF_OUT_OCTETS));
+}
+
+TEST(NetLinkStatsSnapshot, getStat)
+{
+    NetLinkStatsSnapshot snapshot(g_statIdMap);
+
+    uint64_t counter = 1;
+
+    EXPECT_FALSE(snapshot.getStat("lo", SAI_PORT_STAT_IF_IN_OCTETS, counter));
+    EXPECT_EQ(counter, 0);
+
+    EXPECT_TRUE(snapshot.refresh());
+
+    EXPECT_NE(snapshot.size(), 0);
+
+    EXPECT_TRUE(snapshot.getStat("lo", SAI_PORT_STAT_IF_IN_OCTETS, counter));
+
+    EXPECT_FALSE(snapshot.getStat("lo", SAI_PORT_STAT_PFC_0_RX_PKTS, counter));
+
+    EXPECT_FALSE(snapshot.getStat("not_existing_interface", SAI_PORT_STAT_IF_IN_OCTETS, counter));
+
+    // refresh twice on the same socket
+
+    EXPECT_TRUE(snapshot.refresh());
+}
@@ -189,22 +189,99 @@ TEST(SaiUnittests, bulkGetClearStats)
 
     sai.apiInitialize(0, &test_services);
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                           SAI_OBJECT_TYPE_PORT,
-                                                           0,
-                                                           nullptr,
-                                                           0,
-                                                           nullptr,
-                                                           SAI_STATS_MODE_BULK_READ,
-                                                           nullptr,
-                                                           nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                              SAI_OBJECT_TYPE_PORT,
                                                              0,
                                                              nullptr,
                                                              0,
                                                              nullptr,
                                                              SAI_STATS_MODE_BULK_READ,
+                                                             nullptr,
                                                              nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                               SAI_OBJECT_TYPE_PORT,
+                                                               0,
+                                                               nullptr,
+                                                               0,
+                                                               nullptr,
+                                                               SAI_STATS_MODE_BULK_READ,
+                                                               nullptr));
 }
 
+
+TEST(SaiUnittests, bulkGetClearStatsSwitch)
+{
+    Sai sai;
+
+    sai.apiInitialize(0, &test_services);
+
+    sai_attribute_t attr;
+
+    sai_object_id_t switch_id;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(SAI_OBJECT_TYPE_SWITCH, &switch_id, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_stat_id_t counter_ids[2] = {
+        SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_0_DROPPED_PKTS,
+        SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_1_DROPPED_PKTS };
+
+    sai_object_key_t keys[2];
+
+    keys[0].key.object_id = switch_id;
+    keys[1].key.object_id = 0x1111111111; // not existing object
+
+    sai_status_t statuses[2] = { SAI_STATUS_NOT_EXECUTED, SAI_STATUS_NOT_EXECUTED };
+
+    uint64_t counters[4] = { 1, 1, 1, 1 };
+
+    // happy path, switch is deduced from object key
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
+                                                   SAI_OBJECT_TYPE_SWITCH,
+                                                   1,
+                                                   keys,
+                                                   2,
+                                                   counter_ids,
+                                                   SAI_STATS_MODE_BULK_READ,
+                                                   statuses,
+                                                   counters));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(0, counters[0]);
+    EXPECT_EQ(0, counters[1]);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                     SAI_OBJECT_TYPE_SWITCH,
+                                                     1,
+                                                     keys,
+                                                     2,
+                                                     counter_ids,
+                                                     SAI_STATS_MODE_BULK_CLEAR,
+                                                     statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+
+    // invalid object don't prevent obtaining counters of valid object
+
+    statuses[0] = SAI_STATUS_NOT_EXECUTED;
+    counters[0] = 1;
+    counters[1] = 1;
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, sai.bulkGetStats(SAI_NULL_OBJECT_ID,
+                                                   SAI_OBJECT_TYPE_SWITCH,
+                                                   2,
+                                                   keys,
+                                                   2,
+                                                   counter_ids,
+                                                   SAI_STATS_MODE_BULK_READ,
+                                                   statuses,
+                                                   counters));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_NE(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_EQ(0, counters[0]);
+    EXPECT_EQ(0, counters[1]);
+}
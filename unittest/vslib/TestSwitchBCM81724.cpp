@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 
 using namespace saivs;
@@ -152,6 +153,74 @@ TEST(SwitchBCM81724, refresh_read_only)
     //std::cout << sw.dump_switch_database_for_warm_restart();
 }
 
+TEST(SwitchBCM81724, refresh_port_list)
+{
+    auto sc = std::make_shared<SwitchConfig>(0, "");
+    auto signal = std::make_shared<Signal>();
+    auto eventQueue = std::make_shared<EventQueue>(signal);
+
+    sc->m_saiSwitchType = SAI_SWITCH_TYPE_NPU;
+    sc->m_switchType = SAI_VS_SWITCH_TYPE_BCM56850;
+    sc->m_bootType = SAI_VS_BOOT_TYPE_COLD;
+    sc->m_useTapDevice = false;
+    sc->m_laneMap = LaneMap::getDefaultLaneMap(0);
+    sc->m_eventQueue = eventQueue;
+
+    auto scc = std::make_shared<SwitchConfigContainer>();
+
+    scc->insert(sc);
+
+    auto mgr = std::make_shared<RealObjectIdManager>(0, scc);
+
+    auto switchId = mgr->allocateNewSwitchObjectId("");
+
+    SwitchBCM81724 sw(
+            switchId,
+            mgr,
+            sc);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(sw.initialize_default_objects(1, &attr), SAI_STATUS_SUCCESS);
+
+    std::vector<sai_object_id_t> ports;
+
+    for (uint32_t lane = 1; lane <= 16; lane++)
+    {
+        sai_attribute_t attrs[2];
+
+        attrs[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+        attrs[0].value.u32list.count = 1;
+        attrs[0].value.u32list.list = &lane;
+
+        attrs[1].id = SAI_PORT_ATTR_SPEED;
+        attrs[1].value.u32 = 10000;
+
+        sai_object_id_t portId = mgr->allocateNewObjectId(SAI_OBJECT_TYPE_PORT, switchId);
+
+        EXPECT_EQ(sw.create(SAI_OBJECT_TYPE_PORT, sai_serialize_object_id(portId), switchId, 2, attrs), SAI_STATUS_SUCCESS);
+
+        ports.push_back(portId);
+    }
+
+    std::vector<sai_object_id_t> list(ports.size());
+
+    attr.id = SAI_SWITCH_ATTR_PORT_LIST;
+    attr.value.objlist.count = (uint32_t)list.size();
+    attr.value.objlist.list = list.data();
+
+    EXPECT_EQ(sw.get(SAI_OBJECT_TYPE_SWITCH, sai_serialize_object_id(switchId), 1, &attr), SAI_STATUS_SUCCESS);
+
+    // ports are kept in hash map, but list must be in deterministic order
+
+    std::sort(ports.begin(), ports.end());
+
+    EXPECT_EQ(list, ports);
+}
+
 TEST(SwitchBCM81724, warm_boot_initialize_objects)
 {
     auto sc = std::make_shared<SwitchConfig>(0, "");
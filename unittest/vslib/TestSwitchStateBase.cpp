@@ -244,3 +244,22 @@ TEST(SwitchStateBase, initialize_voq_switch)
     EXPECT_EQ(SAI_STATUS_SUCCESS,
               ss.initialize_voq_switch_objects((uint32_t)attrs.size(), attrs.data()));
 }
+
+TEST(SwitchStateBase, getSortedObjects)
+{
+    SerializedObjectIdHash hash;
+
+    for (int i = 20; i > 0; i--)
+    {
+        hash[sai_serialize_object_id((sai_object_id_t)(0x1000 + i))];
+    }
+
+    auto sorted = SwitchState::getSortedObjects(hash);
+
+    EXPECT_EQ(hash.size(), sorted.size());
+
+    for (size_t i = 1; i < sorted.size(); i++)
+    {
+        EXPECT_LT(sorted[i - 1]->first, sorted[i]->first);
+    }
+}
@@ -55,3 +55,23 @@ TEST(TrafficFilterPipes, execute)
 
     EXPECT_EQ(p.execute(buf, len), TrafficFilter::TERMINATE);
 }
+
+TEST(TrafficFilterPipes, executeAfterUninstall)
+{
+    TrafficFilterPipes p;
+
+    uint8_t buf[64] = {0};
+    size_t len = sizeof(buf);
+
+    auto filter = std::make_shared<MACsecIngressFilter>("foo");
+
+    EXPECT_TRUE(p.installFilter(0, filter));
+
+    EXPECT_EQ(p.execute(buf, len), TrafficFilter::TERMINATE);
+
+    EXPECT_TRUE(p.uninstallFilter(filter));
+
+    EXPECT_EQ(p.execute(buf, len), TrafficFilter::CONTINUE);
+
+    EXPECT_FALSE(p.uninstallFilter(filter));
+}
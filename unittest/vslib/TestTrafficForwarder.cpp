@@ -1,6 +1,11 @@
 #include "TrafficForwarder.h"
 
 #include <linux/if_packet.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
 
 #include <gtest/gtest.h>
 
@@ -66,3 +71,39 @@ TEST(TrafficForwarder, addVlanTag)
 
     EXPECT_EQ(length, 68);
 }
+
+class TestForwarder:
+    public TrafficForwarder
+{
+};
+
+TEST(TrafficForwarder, sendToDropsWhenFull)
+{
+    int fds[2];
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, fds), 0);
+
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+
+    TestForwarder fwd;
+
+    unsigned char frame[64] = { 0 };
+
+    // fill peer queue, send must not wait for it to be drained
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_TRUE(fwd.sendTo(fds[0], frame, sizeof(frame)));
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 100);
+
+    close(fds[0]);
+    close(fds[1]);
+
+    EXPECT_FALSE(fwd.sendTo(fds[0], frame, sizeof(frame)));
+}
@@ -0,0 +1,156 @@
+#include "FdbInfoSet.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace saivs;
+
+FdbInfoSet& FdbInfoSet::operator=(
+        _In_ const std::set<FdbInfo>& fdbInfoSet)
+{
+    SWSS_LOG_ENTER();
+
+    clear();
+
+    std::vector<FdbInfo> infos(fdbInfoSet.begin(), fdbInfoSet.end());
+
+    std::stable_sort(infos.begin(), infos.end(),
+            [](const FdbInfo& a, const FdbInfo& b) { return a.getTimestamp() < b.getTimestamp(); });
+
+    for (auto& fi: infos)
+    {
+        insert(fi);
+    }
+
+    return *this;
+}
+
+void FdbInfoSet::insert(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    if (refresh(fi, fi.getTimestamp()))
+    {
+        return;
+    }
+
+    auto it = m_list.insert(m_list.end(), fi);
+
+    m_index.emplace(fi, it);
+}
+
+bool FdbInfoSet::refresh(
+        _In_ const FdbInfo& fi,
+        _In_ uint32_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(fi);
+
+    if (it == m_index.end())
+    {
+        return false;
+    }
+
+    it->second->setTimestamp(timestamp);
+
+    // move to the end in constant time, iterator stays valid
+
+    m_list.splice(m_list.end(), m_list, it->second);
+
+    return true;
+}
+
+bool FdbInfoSet::erase(
+        _In_ const FdbInfo& fi)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(fi);
+
+    if (it == m_index.end())
+    {
+        return false;
+    }
+
+    m_list.erase(it->second);
+
+    m_index.erase(it);
+
+    return true;
+}
+
+bool FdbInfoSet::contains(
+        _In_ const FdbInfo& fi) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_index.find(fi) != m_index.end();
+}
+
+std::vector<FdbInfo> FdbInfoSet::extractAged(
+        _In_ uint32_t current,
+        _In_ uint32_t agingTime)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<FdbInfo> aged;
+
+    while (m_list.size())
+    {
+        auto& fi = m_list.front();
+
+        if ((current - fi.getTimestamp()) < agingTime)
+        {
+            // rest of the entries are newer
+            break;
+        }
+
+        aged.push_back(fi);
+
+        m_index.erase(fi);
+
+        m_list.pop_front();
+    }
+
+    return aged;
+}
+
+size_t FdbInfoSet::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_list.size();
+}
+
+bool FdbInfoSet::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_list.empty();
+}
+
+void FdbInfoSet::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_list.clear();
+
+    m_index.clear();
+}
+
+FdbInfoSet::const_iterator FdbInfoSet::begin() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_list.begin();
+}
+
+FdbInfoSet::const_iterator FdbInfoSet::end() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_list.end();
+}
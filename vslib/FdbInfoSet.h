@@ -0,0 +1,97 @@
+#pragma once
+
+#include "FdbInfo.h"
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace saivs
+{
+    /**
+     * @brief FDB info set ordered by last seen time.
+     *
+     * Entries are indexed by MAC and VLAN (same as FdbInfo operator<) and
+     * also kept on a list ordered by timestamp, oldest first. Since learn
+     * timestamps are not decreasing, refreshing an entry just moves it to
+     * the end of the list, and aging only needs to look at the front of
+     * the list instead of scanning all learned entries.
+     */
+    class FdbInfoSet
+    {
+        public:
+
+            typedef std::list<FdbInfo>::const_iterator const_iterator;
+
+            FdbInfoSet() = default;
+
+            virtual ~FdbInfoSet() = default;
+
+            // index holds list iterators, so copy is not allowed
+
+            FdbInfoSet(const FdbInfoSet&) = delete;
+
+            FdbInfoSet& operator=(const FdbInfoSet&) = delete;
+
+        public:
+
+            /**
+             * @brief Assign from warm boot set.
+             *
+             * Entries are ordered by their timestamps.
+             */
+            FdbInfoSet& operator=(
+                    _In_ const std::set<FdbInfo>& fdbInfoSet);
+
+            /**
+             * @brief Insert new entry, or update timestamp if exists.
+             */
+            void insert(
+                    _In_ const FdbInfo& fi);
+
+            /**
+             * @brief Update timestamp of existing entry.
+             *
+             * @return True if entry was found, false otherwise.
+             */
+            bool refresh(
+                    _In_ const FdbInfo& fi,
+                    _In_ uint32_t timestamp);
+
+            /**
+             * @return True if entry was found and removed.
+             */
+            bool erase(
+                    _In_ const FdbInfo& fi);
+
+            bool contains(
+                    _In_ const FdbInfo& fi) const;
+
+            /**
+             * @brief Remove and return entries not seen for aging time.
+             */
+            std::vector<FdbInfo> extractAged(
+                    _In_ uint32_t current,
+                    _In_ uint32_t agingTime);
+
+            size_t size() const;
+
+            bool empty() const;
+
+            void clear();
+
+            const_iterator begin() const;
+
+            const_iterator end() const;
+
+        private:
+
+            /**
+             * @brief Entries ordered by timestamp, oldest first.
+             */
+            std::list<FdbInfo> m_list;
+
+            std::map<FdbInfo, std::list<FdbInfo>::iterator> m_index;
+    };
+}
@@ -0,0 +1,180 @@
+#include "HostInterfaceEventLoop.h"
+
+#include "swss/logger.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cstring>
+
+using namespace saivs;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+#define HOSTIF_EVENT_LOOP_MAX_EVENTS 64
+
+HostInterfaceEventLoop::HostInterfaceEventLoop():
+    m_epollFd(-1),
+    m_stopEventFd(-1),
+    m_run(true)
+{
+    SWSS_LOG_ENTER();
+
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (m_epollFd < 0)
+    {
+        SWSS_LOG_THROW("epoll_create1 failed: %s", strerror(errno));
+    }
+
+    m_stopEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (m_stopEventFd < 0)
+    {
+        SWSS_LOG_THROW("eventfd failed: %s", strerror(errno));
+    }
+
+    epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.fd = m_stopEventFd;
+
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_stopEventFd, &ev) != 0)
+    {
+        SWSS_LOG_THROW("epoll_ctl failed: %s", strerror(errno));
+    }
+
+    m_thread = std::make_shared<std::thread>(&HostInterfaceEventLoop::run, this);
+}
+
+HostInterfaceEventLoop::~HostInterfaceEventLoop()
+{
+    SWSS_LOG_ENTER();
+
+    m_run = false;
+
+    uint64_t value = 1;
+
+    if (write(m_stopEventFd, &value, sizeof(value)) != sizeof(value))
+    {
+        SWSS_LOG_ERROR("failed to notify event loop thread: %s", strerror(errno));
+    }
+
+    m_thread->join();
+
+    close(m_stopEventFd);
+    close(m_epollFd);
+}
+
+HostInterfaceEventLoop& HostInterfaceEventLoop::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    static HostInterfaceEventLoop instance;
+
+    return instance;
+}
+
+void HostInterfaceEventLoop::addFd(
+        _In_ int fd,
+        _In_ Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX;
+
+    epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &ev) != 0)
+    {
+        SWSS_LOG_ERROR("failed to add fd %d to event loop: %s", fd, strerror(errno));
+
+        return;
+    }
+
+    m_callbacks[fd] = callback;
+}
+
+void HostInterfaceEventLoop::removeFd(
+        _In_ int fd)
+{
+    SWSS_LOG_ENTER();
+
+    // callbacks are executed under mutex, so after this point callback
+    // can't be running
+
+    MUTEX;
+
+    if (m_callbacks.erase(fd) == 0)
+    {
+        return;
+    }
+
+    // closed descriptor is already removed from epoll automatically
+
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr) != 0 && errno != EBADF && errno != ENOENT)
+    {
+        SWSS_LOG_ERROR("failed to remove fd %d from event loop: %s", fd, strerror(errno));
+    }
+}
+
+void HostInterfaceEventLoop::run()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("host interface event loop started");
+
+    epoll_event events[HOSTIF_EVENT_LOOP_MAX_EVENTS];
+
+    while (m_run)
+    {
+        int count = epoll_wait(m_epollFd, events, HOSTIF_EVENT_LOOP_MAX_EVENTS, -1);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            SWSS_LOG_ERROR("epoll_wait failed: %s, ending event loop", strerror(errno));
+
+            break;
+        }
+
+        MUTEX;
+
+        for (int i = 0; i < count; i++)
+        {
+            int fd = events[i].data.fd;
+
+            // descriptor could be removed after epoll_wait returned
+
+            auto it = m_callbacks.find(fd);
+
+            if (it == m_callbacks.end())
+            {
+                continue;
+            }
+
+            if (!it->second())
+            {
+                SWSS_LOG_NOTICE("removing fd %d from event loop", fd);
+
+                epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+                m_callbacks.erase(it);
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("host interface event loop ended");
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace saivs
+{
+    /**
+     * @brief Event loop shared by all host interfaces.
+     *
+     * Single thread waits on epoll for all registered packet sockets and tap
+     * devices, instead of each host interface running its own pair of
+     * threads. Callbacks should not block, since they delay all other
+     * interfaces.
+     */
+    class HostInterfaceEventLoop
+    {
+        private:
+
+            HostInterfaceEventLoop();
+
+            HostInterfaceEventLoop(const HostInterfaceEventLoop&) = delete;
+
+            virtual ~HostInterfaceEventLoop();
+
+        public:
+
+            /**
+             * @brief Callback executed when descriptor is readable.
+             *
+             * @return False if descriptor should not be watched anymore.
+             */
+            typedef std::function<bool()> Callback;
+
+        public:
+
+            static HostInterfaceEventLoop& getInstance();
+
+            void addFd(
+                    _In_ int fd,
+                    _In_ Callback callback);
+
+            /**
+             * @brief Stop watching descriptor.
+             *
+             * When this function returns, callback is not running and it will
+             * not be executed again. Must not be called from callback.
+             */
+            void removeFd(
+                    _In_ int fd);
+
+        private:
+
+            void run();
+
+        private:
+
+            int m_epollFd;
+
+            int m_stopEventFd;
+
+            std::atomic<bool> m_run;
+
+            std::mutex m_mutex;
+
+            std::unordered_map<int, Callback> m_callbacks;
+
+            std::shared_ptr<std::thread> m_thread;
+    };
+}
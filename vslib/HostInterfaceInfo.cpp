@@ -1,10 +1,9 @@
 #include "HostInterfaceInfo.h"
+#include "HostInterfaceEventLoop.h"
 #include "SwitchStateBase.h"
-#include "SelectableFd.h"
 #include "EventPayloadPacket.h"
 
 #include "swss/logger.h"
-#include "swss/select.h"
 
 #include "meta/sai_serialize.h"
 
@@ -22,6 +21,8 @@
 #include <linux/if_packet.h>
 #include <linux/if_ether.h>
 
+#include <vector>
+
 using namespace saivs;
 
 HostInterfaceInfo::HostInterfaceInfo(
@@ -40,30 +41,30 @@ HostInterfaceInfo::HostInterfaceInfo(
 {
     SWSS_LOG_ENTER();
 
-    m_run_thread = true;
+    // tap device is drained until EAGAIN, frames written to it are dropped on EAGAIN in sendTo
+
+    int flags = fcntl(m_tapfd, F_GETFL, 0);
+
+    if (flags < 0 || fcntl(m_tapfd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+        SWSS_LOG_ERROR("failed to set non blocking mode on tap fd %d, errno(%d): %s",
+                m_tapfd, errno, strerror(errno));
+    }
+
+    auto& loop = HostInterfaceEventLoop::getInstance();
 
-    m_e2t = std::make_shared<std::thread>(&HostInterfaceInfo::veth2tap_fun, this);
-    m_t2e = std::make_shared<std::thread>(&HostInterfaceInfo::tap2veth_fun, this);
+    loop.addFd(m_packet_socket, [this]() { return veth2tap_fun(); });
+    loop.addFd(m_tapfd, [this]() { return tap2veth_fun(); });
 }
 
 HostInterfaceInfo::~HostInterfaceInfo()
 {
     SWSS_LOG_ENTER();
 
-    m_run_thread = false;
+    auto& loop = HostInterfaceEventLoop::getInstance();
 
-    m_e2tEvent.notify();
-    m_t2eEvent.notify();
-
-    if (m_t2e)
-    {
-        m_t2e->join();
-    }
-
-    if (m_e2t)
-    {
-        m_e2t->join();
-    }
+    loop.removeFd(m_tapfd);
+    loop.removeFd(m_packet_socket);
 
     // remove tap device
 
@@ -74,7 +75,7 @@ HostInterfaceInfo::~HostInterfaceInfo()
         SWSS_LOG_ERROR("failed to remove tap device: %s, err: %d", m_name.c_str(), err);
     }
 
-    SWSS_LOG_NOTICE("joined threads for hostif: %s", m_name.c_str());
+    SWSS_LOG_NOTICE("removed hostif %s from event loop", m_name.c_str());
 }
 
 void HostInterfaceInfo::async_process_packet_for_fdb_event(
@@ -124,148 +125,192 @@ bool HostInterfaceInfo::uninstallTap2EthFilter(
     return m_t2eFilters.uninstallFilter(filter);
 }
 
-void HostInterfaceInfo::veth2tap_fun()
+bool HostInterfaceInfo::process_veth2tap_packet(
+        _Inout_ unsigned char *buffer,
+        _In_ size_t length,
+        _Inout_ struct msghdr &msg)
 {
     SWSS_LOG_ENTER();
 
-    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
-
-    swss::Select s;
-    SelectableFd fd(m_packet_socket);
+    if (length < sizeof(ethhdr))
+    {
+        SWSS_LOG_ERROR("invalid ethernet frame length: %zu", length);
+        return true;
+    }
 
-    s.addSelectable(&m_e2tEvent);
-    s.addSelectable(&fd);
+    // Buffer include the ingress packets
+    // MACsec scenario: EAPOL packets and encrypted packets
+    auto ret = m_e2tFilters.execute(buffer, length);
 
-    while (m_run_thread)
+    if (ret == TrafficFilter::TERMINATE)
     {
-        struct msghdr  msg;
-        memset(&msg, 0, sizeof(struct msghdr));
+        return true;
+    }
+    else if (ret == TrafficFilter::ERROR)
+    {
+        // Error log should be recorded in filter
+        return false;
+    }
 
-        struct sockaddr_storage src_addr;
+    addVlanTag(buffer, length, msg);
 
-        struct iovec iov[1];
+    async_process_packet_for_fdb_event(buffer, length);
 
-        iov[0].iov_base = buffer;       // buffer for message
-        iov[0].iov_len = sizeof(buffer);
+    return sendTo(m_tapfd, buffer, length);
+}
+
+bool HostInterfaceInfo::veth2tap_fun()
+{
+    SWSS_LOG_ENTER();
 
-        char control[CONTROL_MESSAGE_BUFFER_SIZE];   // buffer for control messages
+    /*
+     * Receive all frames that are already queued on packet socket by single
+     * recvmmsg call, instead of one recvmsg per frame. Callbacks are executed
+     * only by event loop thread, so buffers are shared by all interfaces.
+     */
 
-        msg.msg_name = &src_addr;
-        msg.msg_namelen = sizeof(src_addr);
-        msg.msg_iov = iov;
-        msg.msg_iovlen = 1;
-        msg.msg_control = control;
-        msg.msg_controllen = sizeof(control);
+    static thread_local std::vector<unsigned char> buffers(PACKET_BATCH_SIZE * ETH_FRAME_BUFFER_SIZE);
+    static thread_local std::vector<char> controls(PACKET_BATCH_SIZE * CONTROL_MESSAGE_BUFFER_SIZE);
 
-        swss::Selectable *sel = NULL;
+    struct mmsghdr msgs[PACKET_BATCH_SIZE];
+    struct iovec iovs[PACKET_BATCH_SIZE];
+    struct sockaddr_storage src_addrs[PACKET_BATCH_SIZE];
 
-        int result = s.select(&sel);
+    memset(msgs, 0, sizeof(msgs));
 
-        if (result != swss::Select::OBJECT)
+    for (unsigned int i = 0; i < PACKET_BATCH_SIZE; i++)
+    {
+        iovs[i].iov_base = &buffers[i * ETH_FRAME_BUFFER_SIZE];  // buffer for message
+        iovs[i].iov_len = ETH_FRAME_BUFFER_SIZE;
+
+        msgs[i].msg_hdr.msg_name = &src_addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(src_addrs[i]);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_control = &controls[i * CONTROL_MESSAGE_BUFFER_SIZE]; // buffer for control messages
+        msgs[i].msg_hdr.msg_controllen = CONTROL_MESSAGE_BUFFER_SIZE;
+    }
+
+    int count = recvmmsg(m_packet_socket, msgs, PACKET_BATCH_SIZE, MSG_DONTWAIT, NULL);
+
+    if (count < 0)
+    {
+        int err = errno;
+
+        if (err != ENETDOWN && err != EAGAIN && err != EWOULDBLOCK)
         {
-            SWSS_LOG_ERROR("selectable failed: %d, ending thread for %s", result, m_name.c_str());
-            return;
+            SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
+                    m_packet_socket, err, strerror(err));
         }
 
-        if (sel == &m_e2tEvent) // thread end event
-            break;
+        return err != EBADF;
+    }
 
-        ssize_t size = recvmsg(m_packet_socket, &msg, 0);
+    for (int i = 0; i < count; i++)
+    {
+        if (!process_veth2tap_packet(
+                    &buffers[i * ETH_FRAME_BUFFER_SIZE],
+                    static_cast<size_t>(msgs[i].msg_len),
+                    msgs[i].msg_hdr))
+        {
+            SWSS_LOG_NOTICE("ending veth2tap forward for %s", m_name.c_str());
+            return false;
+        }
+    }
 
-        if (size < 0)
+    return true;
+}
+
+void HostInterfaceInfo::send_to_veth(
+        _In_ struct mmsghdr *msgs,
+        _In_ unsigned int count)
+{
+    SWSS_LOG_ENTER();
+
+    unsigned int sent = 0;
+
+    while (sent < count)
+    {
+        // don't block shared event loop when socket send buffer is full
+
+        int res = sendmmsg(m_packet_socket, msgs + sent, count - sent, MSG_DONTWAIT);
+
+        if (res < 0)
         {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                SWSS_LOG_DEBUG("socket fd %d send buffer is full, dropping %u frames",
+                        m_packet_socket, count - sent);
+
+                return;
+            }
+
             if (errno != ENETDOWN)
             {
-                SWSS_LOG_ERROR("failed to read from socket fd %d, errno(%d): %s",
+                SWSS_LOG_ERROR("failed to write to socket fd %d, errno(%d): %s",
                         m_packet_socket, errno, strerror(errno));
             }
 
-            continue;
-        }
-
-        if (size < (ssize_t)sizeof(ethhdr))
-        {
-            SWSS_LOG_ERROR("invalid ethernet frame length: %zu", msg.msg_controllen);
-            continue;
-        }
+            // drop frame which failed and continue with next ones
 
-        // Buffer include the ingress packets
-        // MACsec scenario: EAPOL packets and encrypted packets
-        size_t length = static_cast<size_t>(size);
-        auto ret = m_e2tFilters.execute(buffer, length);
+            sent++;
 
-        if (ret == TrafficFilter::TERMINATE)
-        {
             continue;
         }
-        else if (ret == TrafficFilter::ERROR)
-        {
-            // Error log should be recorded in filter
-            return;
-        }
-
-        addVlanTag(buffer, length, msg);
-
-        async_process_packet_for_fdb_event(buffer, length);
 
-        if (!sendTo(m_tapfd, buffer, length))
-        {
-            break;
-        }
+        sent += static_cast<unsigned int>(res);
     }
-
-    SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
 }
 
-void HostInterfaceInfo::tap2veth_fun()
+bool HostInterfaceInfo::tap2veth_fun()
 {
     SWSS_LOG_ENTER();
 
-    unsigned char buffer[ETH_FRAME_BUFFER_SIZE];
-
-    swss::Select s;
-    SelectableFd fd(m_tapfd);
+    /*
+     * Up to batch size frames are read from tap device on each wake up, and
+     * all of them are sent to packet socket by single sendmmsg call, frames
+     * left are processed on next wake up, so other interfaces don't starve.
+     */
 
-    s.addSelectable(&m_t2eEvent);
-    s.addSelectable(&fd);
+    static thread_local std::vector<unsigned char> buffers(PACKET_BATCH_SIZE * ETH_FRAME_BUFFER_SIZE);
 
-    while (m_run_thread)
-    {
-        swss::Selectable *sel = NULL;
-
-        int result = s.select(&sel);
+    struct mmsghdr msgs[PACKET_BATCH_SIZE];
+    struct iovec iovs[PACKET_BATCH_SIZE];
 
-        if (result != swss::Select::OBJECT)
-        {
-            SWSS_LOG_ERROR("selectable failed: %d, ending thread for %s", result, m_name.c_str());
-            return;
-        }
+    unsigned int count = 0;
 
-        if (sel == &m_t2eEvent) // thread end event
-            break;
+    for (unsigned int i = 0; i < PACKET_BATCH_SIZE; i++)
+    {
+        unsigned char* buffer = &buffers[count * ETH_FRAME_BUFFER_SIZE];
 
-        ssize_t size = read(m_tapfd, buffer, sizeof(buffer));
+        ssize_t size = read(m_tapfd, buffer, ETH_FRAME_BUFFER_SIZE);
 
         if (size < 0)
         {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                // all queued frames were read
+                break;
+            }
+
             SWSS_LOG_ERROR("failed to read from tapfd fd %d, errno(%d): %s",
                     m_tapfd, errno, strerror(errno));
 
             if (errno == EBADF)
             {
-                // bad file descriptor, just close the thread
-                SWSS_LOG_NOTICE("ending thread for tap fd %d", m_tapfd);
-                return;
+                // bad file descriptor, just stop forwarding
+                SWSS_LOG_NOTICE("ending tap2veth forward for tap fd %d", m_tapfd);
+                send_to_veth(msgs, count);
+                return false;
             }
 
-            continue;
+            break;
         }
 
         // Buffer include the egress packets
         // MACsec scenario: EAPOL packets and plaintext packets
         size_t length = static_cast<size_t>(size);
         auto ret = m_t2eFilters.execute(buffer, length);
-        size = static_cast<ssize_t>(length);
 
         if (ret == TrafficFilter::TERMINATE)
         {
@@ -274,20 +319,22 @@ void HostInterfaceInfo::tap2veth_fun()
         else if (ret == TrafficFilter::ERROR)
         {
             // Error log should be recorded in filter
-            return;
+            send_to_veth(msgs, count);
+            return false;
         }
 
-        if (write(m_packet_socket, buffer, (int)size) < 0)
-        {
-            if (errno != ENETDOWN)
-            {
-                SWSS_LOG_ERROR("failed to write to socket fd %d, errno(%d): %s",
-                        m_packet_socket, errno, strerror(errno));
-            }
+        memset(&msgs[count], 0, sizeof(msgs[count]));
 
-            continue;
-        }
+        iovs[count].iov_base = buffer;
+        iovs[count].iov_len = length;
+
+        msgs[count].msg_hdr.msg_iov = &iovs[count];
+        msgs[count].msg_hdr.msg_iovlen = 1;
+
+        count++;
     }
 
-    SWSS_LOG_NOTICE("ending thread proc for %s", m_name.c_str());
+    send_to_veth(msgs, count);
+
+    return true;
 }
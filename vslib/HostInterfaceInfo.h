@@ -8,14 +8,16 @@ extern "C" {
 #include "TrafficFilterPipes.h"
 #include "TrafficForwarder.h"
 
-#include "swss/selectableevent.h"
-
 #include <memory>
-#include <thread>
 #include <string.h>
 
 namespace saivs
 {
+    /**
+     * @brief Maximum number of frames received or sent by single system call.
+     */
+    static constexpr unsigned int PACKET_BATCH_SIZE = 32;
+
     class HostInterfaceInfo:
         public TrafficForwarder
     {
@@ -57,9 +59,32 @@ namespace saivs
 
         private:
 
-            void veth2tap_fun();
-
-            void tap2veth_fun();
+            /**
+             * @brief Process frames received on packet socket.
+             *
+             * Executed by event loop when packet socket is readable.
+             *
+             * @return False if socket should not be watched anymore.
+             */
+            bool veth2tap_fun();
+
+            /**
+             * @brief Process frames read from tap device.
+             *
+             * Executed by event loop when tap device is readable.
+             *
+             * @return False if tap device should not be watched anymore.
+             */
+            bool tap2veth_fun();
+
+            bool process_veth2tap_packet(
+                    _Inout_ unsigned char *buffer,
+                    _In_ size_t length,
+                    _Inout_ struct msghdr &msg);
+
+            void send_to_veth(
+                    _In_ struct mmsghdr *msgs,
+                    _In_ unsigned int count);
 
         public: // TODO to private
 
@@ -71,21 +96,13 @@ namespace saivs
 
             sai_object_id_t m_portId;
 
-            bool m_run_thread;
-
             std::shared_ptr<EventQueue> m_eventQueue;
 
             int m_tapfd;
 
         private:
 
-            std::shared_ptr<std::thread> m_e2t;
-            std::shared_ptr<std::thread> m_t2e;
-
             TrafficFilterPipes m_e2tFilters;
             TrafficFilterPipes m_t2eFilters;
-
-            swss::SelectableEvent m_e2tEvent;
-            swss::SelectableEvent m_t2eEvent;
     };
 }
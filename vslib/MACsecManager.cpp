@@ -298,6 +298,17 @@ bool MACsecManager::update_macsec_sa_pn(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.updateSaPn(
+                attr.m_macsecName,
+                attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS,
+                attr.m_sci,
+                static_cast<std::uint8_t>(attr.m_an),
+                attr.is_xpn(),
+                pn);
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec set "
@@ -332,6 +343,16 @@ bool MACsecManager::get_macsec_sa_pn(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.getSaPn(
+                attr.m_macsecName,
+                attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS,
+                attr.m_sci,
+                static_cast<std::uint8_t>(attr.m_an),
+                pn);
+    }
+
     pn = 1;
     std::string macsecSaInfo;
 
@@ -420,6 +441,11 @@ bool MACsecManager::create_macsec_ingress_sc(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.addRxSc(attr.m_macsecName, attr.m_sci);
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec add "
@@ -441,6 +467,27 @@ bool MACsecManager::create_macsec_egress_sa(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        auto an = static_cast<std::uint8_t>(attr.m_an);
+
+        if (!m_netlink.addSa(attr.m_macsecName, get_netlink_sa_config(attr)))
+        {
+            return false;
+        }
+
+        if (m_netlink.setEncodingSa(attr.m_macsecName, an))
+        {
+            return true;
+        }
+
+        // remove SA, so create can be retried from clean state
+
+        m_netlink.delSa(attr.m_macsecName, true, attr.m_sci, an);
+
+        return false;
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec add "
@@ -476,6 +523,11 @@ bool MACsecManager::create_macsec_ingress_sa(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.addSa(attr.m_macsecName, get_netlink_sa_config(attr));
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec add "
@@ -533,6 +585,11 @@ bool MACsecManager::delete_macsec_ingress_sc(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.delRxSc(attr.m_macsecName, attr.m_sci);
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec set "
@@ -558,6 +615,11 @@ bool MACsecManager::delete_macsec_egress_sa(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.delSa(attr.m_macsecName, true, attr.m_sci, static_cast<std::uint8_t>(attr.m_an));
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec set "
@@ -584,6 +646,11 @@ bool MACsecManager::delete_macsec_ingress_sa(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        return m_netlink.delSa(attr.m_macsecName, false, attr.m_sci, static_cast<std::uint8_t>(attr.m_an));
+    }
+
     std::ostringstream ostream;
     ostream
         << "/sbin/ip macsec set "
@@ -605,6 +672,26 @@ bool MACsecManager::delete_macsec_ingress_sa(
     return exec(ostream.str());
 }
 
+MACsecNetlink::SaConfig MACsecManager::get_netlink_sa_config(
+        _In_ const MACsecAttr &attr) const
+{
+    SWSS_LOG_ENTER();
+
+    MACsecNetlink::SaConfig config;
+
+    config.m_egress = attr.m_direction == SAI_MACSEC_DIRECTION_EGRESS;
+    config.m_sci = attr.m_sci;
+    config.m_an = static_cast<std::uint8_t>(attr.m_an);
+    config.m_pn = attr.m_pn;
+    config.m_xpn = attr.is_xpn();
+    config.m_ssci = attr.m_ssci;
+    config.m_salt = attr.m_salt;
+    config.m_keyId = attr.m_authKey;
+    config.m_key = attr.m_sak;
+
+    return config;
+}
+
 bool MACsecManager::add_macsec_forwarder(
         _In_ const std::string &macsecInterface)
 {
@@ -729,6 +816,13 @@ bool MACsecManager::is_macsec_device_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        MACsecNetlink::DeviceState state;
+
+        return m_netlink.getDeviceState(macsecDevice, state);
+    }
+
     std::string macsec_info;
 
     return get_macsec_device_info(macsecDevice, macsec_info);
@@ -790,6 +884,14 @@ bool MACsecManager::is_macsec_sc_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        MACsecNetlink::DeviceState state;
+
+        return m_netlink.getDeviceState(macsecDevice, state)
+            && state.findSc(direction == SAI_MACSEC_DIRECTION_EGRESS, sci) != nullptr;
+    }
+
     std::string macsec_sc_info;
 
     return get_macsec_sc_info(macsecDevice, direction, sci, macsec_sc_info);
@@ -846,6 +948,20 @@ bool MACsecManager::is_macsec_sa_existing(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        MACsecNetlink::DeviceState state;
+
+        if (!m_netlink.getDeviceState(macsecDevice, state))
+        {
+            return false;
+        }
+
+        auto sc = state.findSc(direction == SAI_MACSEC_DIRECTION_EGRESS, sci);
+
+        return sc && sc->findSa(static_cast<std::uint8_t>(an));
+    }
+
     std::string macsecSaInfo;
 
     return get_macsec_sa_info( macsecDevice, direction, sci, an, macsecSaInfo);
@@ -858,6 +974,22 @@ size_t MACsecManager::get_macsec_sa_count(
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isAvailable())
+    {
+        // single dump instead of query per AN
+
+        MACsecNetlink::DeviceState state;
+
+        if (!m_netlink.getDeviceState(macsecDevice, state))
+        {
+            return 0;
+        }
+
+        auto sc = state.findSc(direction == SAI_MACSEC_DIRECTION_EGRESS, sci);
+
+        return sc ? sc->m_sas.size() : 0;
+    }
+
     size_t sa_count = 0;
 
     for (macsec_an_t an = 0; an <= MAX_MACSEC_SA_NUMBER; an++) // lgtm [cpp/constant-comparison]
@@ -3,6 +3,7 @@
 #include "MACsecAttr.h"
 #include "MACsecFilter.h"
 #include "MACsecForwarder.h"
+#include "MACsecNetlink.h"
 
 namespace saivs
 {
@@ -48,6 +49,9 @@ namespace saivs
 
         protected:
 
+            MACsecNetlink::SaConfig get_netlink_sa_config(
+                    _In_ const MACsecAttr &attr) const;
+
             bool create_macsec_egress_sc(
                     _In_ const MACsecAttr &attr);
 
@@ -143,5 +147,11 @@ namespace saivs
             };
 
             std::map<std::string, MACsecTrafficManager> m_macsecTrafficManagers;
+
+            /**
+             * @brief Netlink backend, used when available, otherwise
+             * operations fall back to /sbin/ip commands.
+             */
+            mutable MACsecNetlink m_netlink;
     };
 }
@@ -0,0 +1,918 @@
+#include "MACsecNetlink.h"
+
+#include "swss/logger.h"
+
+#include <netlink/netlink.h>
+#include <netlink/attr.h>
+#include <netlink/msg.h>
+#include <netlink/genl/genl.h>
+#include <netlink/genl/ctrl.h>
+#include <netlink/route/link.h>
+#include <netlink/route/link/macsec.h>
+
+#include <linux/if_macsec.h>
+
+#include <net/if.h>
+#include <endian.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace saivs;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+#define MACSEC_SCI_HEX_LENGTH (16)
+
+namespace
+{
+    struct DeviceQuery
+    {
+        std::uint32_t m_ifindex;
+
+        MACsecNetlink::DeviceState *m_state;
+
+        bool m_found;
+    };
+
+    void parseSaList(
+            _In_ struct nlattr *saList,
+            _Out_ std::vector<MACsecNetlink::SaState> &sas)
+    {
+        SWSS_LOG_ENTER();
+
+        sas.clear();
+
+        if (saList == nullptr)
+        {
+            return;
+        }
+
+        struct nlattr *sa;
+        int rem;
+
+        nla_for_each_nested(sa, saList, rem)
+        {
+            struct nlattr *saAttrs[MACSEC_SA_ATTR_MAX + 1];
+
+            if (nla_parse_nested(saAttrs, MACSEC_SA_ATTR_MAX, sa, nullptr) < 0)
+            {
+                continue;
+            }
+
+            if (saAttrs[MACSEC_SA_ATTR_AN] == nullptr || saAttrs[MACSEC_SA_ATTR_PN] == nullptr)
+            {
+                continue;
+            }
+
+            MACsecNetlink::SaState state;
+
+            state.m_an = nla_get_u8(saAttrs[MACSEC_SA_ATTR_AN]);
+
+            // PN is u64 for XPN cipher suites and u32 otherwise
+
+            state.m_pn = (nla_len(saAttrs[MACSEC_SA_ATTR_PN]) == sizeof(std::uint64_t))
+                ? nla_get_u64(saAttrs[MACSEC_SA_ATTR_PN])
+                : nla_get_u32(saAttrs[MACSEC_SA_ATTR_PN]);
+
+            sas.push_back(state);
+        }
+    }
+
+    int onDeviceDump(
+            _In_ struct nl_msg *msg,
+            _In_ void *arg)
+    {
+        SWSS_LOG_ENTER();
+
+        auto &query = *static_cast<DeviceQuery*>(arg);
+
+        struct nlattr *attrs[MACSEC_ATTR_MAX + 1];
+
+        if (genlmsg_parse(nlmsg_hdr(msg), 0, attrs, MACSEC_ATTR_MAX, nullptr) < 0)
+        {
+            return NL_SKIP;
+        }
+
+        if (attrs[MACSEC_ATTR_IFINDEX] == nullptr || nla_get_u32(attrs[MACSEC_ATTR_IFINDEX]) != query.m_ifindex)
+        {
+            // dump contains all MACsec devices
+            return NL_SKIP;
+        }
+
+        auto &state = *query.m_state;
+
+        query.m_found = true;
+
+        if (attrs[MACSEC_ATTR_SECY])
+        {
+            struct nlattr *secyAttrs[MACSEC_SECY_ATTR_MAX + 1];
+
+            if (nla_parse_nested(secyAttrs, MACSEC_SECY_ATTR_MAX, attrs[MACSEC_ATTR_SECY], nullptr) >= 0 &&
+                    secyAttrs[MACSEC_SECY_ATTR_SCI])
+            {
+                state.m_txSc.m_sci = nla_get_u64(secyAttrs[MACSEC_SECY_ATTR_SCI]);
+            }
+        }
+
+        parseSaList(attrs[MACSEC_ATTR_TXSA_LIST], state.m_txSc.m_sas);
+
+        if (attrs[MACSEC_ATTR_RXSC_LIST] == nullptr)
+        {
+            return NL_OK;
+        }
+
+        struct nlattr *rxsc;
+        int rem;
+
+        nla_for_each_nested(rxsc, attrs[MACSEC_ATTR_RXSC_LIST], rem)
+        {
+            struct nlattr *rxscAttrs[MACSEC_RXSC_ATTR_MAX + 1];
+
+            if (nla_parse_nested(rxscAttrs, MACSEC_RXSC_ATTR_MAX, rxsc, nullptr) < 0)
+            {
+                continue;
+            }
+
+            if (rxscAttrs[MACSEC_RXSC_ATTR_SCI] == nullptr)
+            {
+                continue;
+            }
+
+            MACsecNetlink::ScState sc;
+
+            sc.m_sci = nla_get_u64(rxscAttrs[MACSEC_RXSC_ATTR_SCI]);
+
+            parseSaList(rxscAttrs[MACSEC_RXSC_ATTR_SA_LIST], sc.m_sas);
+
+            state.m_rxScs.push_back(sc);
+        }
+
+        return NL_OK;
+    }
+}
+
+const MACsecNetlink::SaState* MACsecNetlink::ScState::findSa(
+        _In_ std::uint8_t an) const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto &sa: m_sas)
+    {
+        if (sa.m_an == an)
+        {
+            return &sa;
+        }
+    }
+
+    return nullptr;
+}
+
+const MACsecNetlink::ScState* MACsecNetlink::DeviceState::findSc(
+        _In_ bool egress,
+        _In_ const std::string &sci) const
+{
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue;
+
+    if (!parseSci(sci, sciValue))
+    {
+        return nullptr;
+    }
+
+    if (egress)
+    {
+        return (m_txSc.m_sci == sciValue) ? &m_txSc : nullptr;
+    }
+
+    for (auto &sc: m_rxScs)
+    {
+        if (sc.m_sci == sciValue)
+        {
+            return &sc;
+        }
+    }
+
+    return nullptr;
+}
+
+MACsecNetlink::MACsecNetlink():
+    m_genlSocket(nullptr),
+    m_routeSocket(nullptr),
+    m_family(-1)
+{
+    SWSS_LOG_ENTER();
+
+    // sockets are connected on first use
+}
+
+MACsecNetlink::~MACsecNetlink()
+{
+    SWSS_LOG_ENTER();
+
+    disconnect();
+}
+
+bool MACsecNetlink::connect()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_genlSocket && m_routeSocket && m_family >= 0)
+    {
+        return true;
+    }
+
+    disconnect();
+
+    m_genlSocket = nl_socket_alloc();
+    m_routeSocket = nl_socket_alloc();
+
+    if (m_genlSocket == nullptr || m_routeSocket == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink sockets");
+
+        disconnect();
+
+        return false;
+    }
+
+    int err = genl_connect(m_genlSocket);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to connect generic netlink socket: %s", nl_geterror(err));
+
+        disconnect();
+
+        return false;
+    }
+
+    err = nl_connect(m_routeSocket, NETLINK_ROUTE);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to connect route netlink socket: %s", nl_geterror(err));
+
+        disconnect();
+
+        return false;
+    }
+
+    m_family = genl_ctrl_resolve(m_genlSocket, MACSEC_GENL_NAME);
+
+    if (m_family < 0)
+    {
+        SWSS_LOG_NOTICE("generic netlink family %s not found: %s", MACSEC_GENL_NAME, nl_geterror(m_family));
+
+        disconnect();
+
+        return false;
+    }
+
+    return true;
+}
+
+void MACsecNetlink::disconnect()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_genlSocket)
+    {
+        nl_socket_free(m_genlSocket);
+
+        m_genlSocket = nullptr;
+    }
+
+    if (m_routeSocket)
+    {
+        nl_socket_free(m_routeSocket);
+
+        m_routeSocket = nullptr;
+    }
+
+    m_family = -1;
+}
+
+bool MACsecNetlink::isAvailable()
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    return connect();
+}
+
+bool MACsecNetlink::parseSci(
+        _In_ const std::string &sci,
+        _Out_ std::uint64_t &value)
+{
+    SWSS_LOG_ENTER();
+
+    std::uint8_t buffer[sizeof(std::uint64_t)];
+
+    if (sci.length() != MACSEC_SCI_HEX_LENGTH || !parseHex(sci, sizeof(buffer), buffer))
+    {
+        return false;
+    }
+
+    // SCI string is in network order, same as netlink attribute
+
+    memcpy(&value, buffer, sizeof(value));
+
+    return true;
+}
+
+bool MACsecNetlink::parseHex(
+        _In_ const std::string &hex,
+        _In_ size_t length,
+        _Out_ std::uint8_t *buffer)
+{
+    SWSS_LOG_ENTER();
+
+    if (hex.length() % 2 || hex.length() / 2 > length)
+    {
+        return false;
+    }
+
+    // shorter values are left padded with zeros, same as iproute2 does
+
+    size_t offset = length - hex.length() / 2;
+
+    memset(buffer, 0, offset);
+
+    for (size_t i = 0; i < hex.length(); i += 2)
+    {
+        char byte[3] = { hex[i], hex[i + 1], 0 };
+        char *end = nullptr;
+
+        unsigned long value = strtoul(byte, &end, 16);
+
+        if (end != byte + 2)
+        {
+            return false;
+        }
+
+        buffer[offset + i / 2] = static_cast<std::uint8_t>(value);
+    }
+
+    return true;
+}
+
+#define MACSEC_NL_PUT(x)                                        \
+    if ((x) < 0) {                                              \
+        SWSS_LOG_ERROR("failed to build netlink message: %s", #x); \
+        nlmsg_free(msg);                                        \
+        return false; }
+
+bool MACsecNetlink::addRxSc(
+        _In_ const std::string &macsecName,
+        _In_ const std::string &sci)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || !parseSci(sci, sciValue) || !connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, MACSEC_CMD_ADD_RXSC, MACSEC_GENL_VERSION) ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+    struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+    MACSEC_NL_PUT(rxsc ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_RXSC_ATTR_ACTIVE, 1));
+
+    nla_nest_end(msg, rxsc);
+
+    int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to add rx sc %s on %s: %s", sci.c_str(), macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::delRxSc(
+        _In_ const std::string &macsecName,
+        _In_ const std::string &sci)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || !parseSci(sci, sciValue) || !connect())
+    {
+        return false;
+    }
+
+    // same as "ip macsec set rx sci off" followed by "ip macsec del"
+
+    for (auto cmd: { MACSEC_CMD_UPD_RXSC, MACSEC_CMD_DEL_RXSC })
+    {
+        struct nl_msg *msg = nlmsg_alloc();
+
+        if (msg == nullptr)
+        {
+            return false;
+        }
+
+        MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, cmd, MACSEC_GENL_VERSION) ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+        struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        MACSEC_NL_PUT(rxsc ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+
+        if (cmd == MACSEC_CMD_UPD_RXSC)
+        {
+            MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_RXSC_ATTR_ACTIVE, 0));
+        }
+
+        nla_nest_end(msg, rxsc);
+
+        int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+        if (err < 0)
+        {
+            SWSS_LOG_ERROR("failed to delete rx sc %s on %s: %s", sci.c_str(), macsecName.c_str(), nl_geterror(err));
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::addSa(
+        _In_ const std::string &macsecName,
+        _In_ const SaConfig &sa)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue = 0;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || (!sa.m_egress && !parseSci(sa.m_sci, sciValue)))
+    {
+        return false;
+    }
+
+    std::uint8_t keyId[MACSEC_KEYID_LEN];
+    std::vector<std::uint8_t> key(sa.m_key.length() / 2);
+
+    if (!parseHex(sa.m_keyId, sizeof(keyId), keyId) || key.empty() || !parseHex(sa.m_key, key.size(), key.data()))
+    {
+        SWSS_LOG_ERROR("invalid key of SA %s:%u on %s", sa.m_sci.c_str(), sa.m_an, macsecName.c_str());
+
+        return false;
+    }
+
+    std::uint8_t salt[MACSEC_SALT_LEN];
+    std::uint32_t ssci = 0;
+
+    if (sa.m_xpn)
+    {
+        if (!parseHex(sa.m_salt, sizeof(salt), salt))
+        {
+            SWSS_LOG_ERROR("invalid salt of SA %s:%u on %s", sa.m_sci.c_str(), sa.m_an, macsecName.c_str());
+
+            return false;
+        }
+
+        // SSCI is hex string, and kernel expects it in network order
+
+        ssci = htobe32(static_cast<std::uint32_t>(strtoul(sa.m_ssci.c_str(), nullptr, 16)));
+    }
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    auto cmd = static_cast<std::uint8_t>(sa.m_egress ? MACSEC_CMD_ADD_TXSA : MACSEC_CMD_ADD_RXSA);
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, cmd, MACSEC_GENL_VERSION) ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+    if (!sa.m_egress)
+    {
+        struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        MACSEC_NL_PUT(rxsc ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+
+        nla_nest_end(msg, rxsc);
+    }
+
+    struct nlattr *saConfig = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+    MACSEC_NL_PUT(saConfig ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_AN, sa.m_an));
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_ACTIVE, 1));
+
+    if (sa.m_xpn)
+    {
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_SA_ATTR_PN, sa.m_pn));
+        MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_SA_ATTR_SSCI, ssci));
+        MACSEC_NL_PUT(nla_put(msg, MACSEC_SA_ATTR_SALT, sizeof(salt), salt));
+    }
+    else
+    {
+        MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_SA_ATTR_PN, static_cast<std::uint32_t>(sa.m_pn)));
+    }
+
+    MACSEC_NL_PUT(nla_put(msg, MACSEC_SA_ATTR_KEYID, sizeof(keyId), keyId));
+    MACSEC_NL_PUT(nla_put(msg, MACSEC_SA_ATTR_KEY, static_cast<int>(key.size()), key.data()));
+
+    nla_nest_end(msg, saConfig);
+
+    int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to add SA %s:%u on %s: %s", sa.m_sci.c_str(), sa.m_an, macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::setSaActive(
+        _In_ const std::string &macsecName,
+        _In_ bool egress,
+        _In_ const std::string &sci,
+        _In_ std::uint8_t an,
+        _In_ bool active)
+{
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue = 0;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || (!egress && !parseSci(sci, sciValue)) || !connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    auto cmd = static_cast<std::uint8_t>(egress ? MACSEC_CMD_UPD_TXSA : MACSEC_CMD_UPD_RXSA);
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, cmd, MACSEC_GENL_VERSION) ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+    if (!egress)
+    {
+        struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        MACSEC_NL_PUT(rxsc ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+
+        nla_nest_end(msg, rxsc);
+    }
+
+    struct nlattr *saConfig = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+    MACSEC_NL_PUT(saConfig ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_AN, an));
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_ACTIVE, active ? 1 : 0));
+
+    nla_nest_end(msg, saConfig);
+
+    int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to set SA %s:%u active %d on %s: %s", sci.c_str(), an, active, macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::delSa(
+        _In_ const std::string &macsecName,
+        _In_ bool egress,
+        _In_ const std::string &sci,
+        _In_ std::uint8_t an)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    // same as "ip macsec set sa off" followed by "ip macsec del sa", since
+    // kernel refuses to delete active SA
+
+    if (!setSaActive(macsecName, egress, sci, an, false))
+    {
+        return false;
+    }
+
+    std::uint64_t sciValue = 0;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || (!egress && !parseSci(sci, sciValue)))
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    auto cmd = static_cast<std::uint8_t>(egress ? MACSEC_CMD_DEL_TXSA : MACSEC_CMD_DEL_RXSA);
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, cmd, MACSEC_GENL_VERSION) ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+    if (!egress)
+    {
+        struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        MACSEC_NL_PUT(rxsc ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+
+        nla_nest_end(msg, rxsc);
+    }
+
+    struct nlattr *saConfig = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+    MACSEC_NL_PUT(saConfig ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_AN, an));
+
+    nla_nest_end(msg, saConfig);
+
+    int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to delete SA %s:%u on %s: %s", sci.c_str(), an, macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::updateSaPn(
+        _In_ const std::string &macsecName,
+        _In_ bool egress,
+        _In_ const std::string &sci,
+        _In_ std::uint8_t an,
+        _In_ bool xpn,
+        _In_ std::uint64_t pn)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    std::uint64_t sciValue = 0;
+    std::uint32_t ifindex = if_nametoindex(macsecName.c_str());
+
+    if (ifindex == 0 || (!egress && !parseSci(sci, sciValue)) || !connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    auto cmd = static_cast<std::uint8_t>(egress ? MACSEC_CMD_UPD_TXSA : MACSEC_CMD_UPD_RXSA);
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, 0, cmd, MACSEC_GENL_VERSION) ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_ATTR_IFINDEX, ifindex));
+
+    if (!egress)
+    {
+        struct nlattr *rxsc = nla_nest_start(msg, MACSEC_ATTR_RXSC_CONFIG);
+
+        MACSEC_NL_PUT(rxsc ? 0 : -1);
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_RXSC_ATTR_SCI, sciValue));
+
+        nla_nest_end(msg, rxsc);
+    }
+
+    struct nlattr *saConfig = nla_nest_start(msg, MACSEC_ATTR_SA_CONFIG);
+
+    MACSEC_NL_PUT(saConfig ? 0 : -1);
+    MACSEC_NL_PUT(nla_put_u8(msg, MACSEC_SA_ATTR_AN, an));
+
+    if (xpn)
+    {
+        MACSEC_NL_PUT(nla_put_u64(msg, MACSEC_SA_ATTR_PN, pn));
+    }
+    else
+    {
+        MACSEC_NL_PUT(nla_put_u32(msg, MACSEC_SA_ATTR_PN, static_cast<std::uint32_t>(pn)));
+    }
+
+    nla_nest_end(msg, saConfig);
+
+    int err = nl_send_sync(m_genlSocket, msg); // frees message
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to update SA %s:%u PN on %s: %s", sci.c_str(), an, macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
+
+bool MACsecNetlink::getSaPn(
+        _In_ const std::string &macsecName,
+        _In_ bool egress,
+        _In_ const std::string &sci,
+        _In_ std::uint8_t an,
+        _Out_ std::uint64_t &pn)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    DeviceState state;
+
+    if (!dumpDevice(macsecName, state))
+    {
+        return false;
+    }
+
+    // egress SC is identified by device, so SCI is not compared
+
+    auto sc = egress ? &state.m_txSc : state.findSc(false, sci);
+
+    auto sa = sc ? sc->findSa(an) : nullptr;
+
+    if (sa == nullptr)
+    {
+        return false;
+    }
+
+    pn = sa->m_pn;
+
+    return true;
+}
+
+bool MACsecNetlink::getDeviceState(
+        _In_ const std::string &macsecName,
+        _Out_ DeviceState &state)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    return dumpDevice(macsecName, state);
+}
+
+bool MACsecNetlink::dumpDevice(
+        _In_ const std::string &macsecName,
+        _Out_ DeviceState &state)
+{
+    SWSS_LOG_ENTER();
+
+    // this api must be executed under mutex
+
+    state = {};
+
+    DeviceQuery query = {};
+
+    query.m_ifindex = if_nametoindex(macsecName.c_str());
+    query.m_state = &state;
+
+    if (query.m_ifindex == 0 || !connect())
+    {
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+
+    if (msg == nullptr)
+    {
+        return false;
+    }
+
+    MACSEC_NL_PUT(genlmsg_put(msg, NL_AUTO_PORT, NL_AUTO_SEQ, m_family, 0, NLM_F_DUMP, MACSEC_CMD_GET_TXSC, MACSEC_GENL_VERSION) ? 0 : -1);
+
+    struct nl_cb *cb = nl_cb_alloc(NL_CB_DEFAULT);
+
+    if (cb == nullptr)
+    {
+        nlmsg_free(msg);
+
+        return false;
+    }
+
+    nl_cb_set(cb, NL_CB_VALID, NL_CB_CUSTOM, onDeviceDump, &query);
+
+    int err = nl_send_auto(m_genlSocket, msg);
+
+    nlmsg_free(msg);
+
+    if (err >= 0)
+    {
+        err = nl_recvmsgs(m_genlSocket, cb);
+    }
+
+    nl_cb_put(cb);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to dump MACsec devices: %s", nl_geterror(err));
+
+        // socket may have unread dump messages, reconnect on next use
+
+        disconnect();
+
+        return false;
+    }
+
+    return query.m_found;
+}
+
+bool MACsecNetlink::setEncodingSa(
+        _In_ const std::string &macsecName,
+        _In_ std::uint8_t an)
+{
+    MUTEX;
+    SWSS_LOG_ENTER();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    struct rtnl_link *orig = nullptr;
+
+    int err = rtnl_link_get_kernel(m_routeSocket, 0, macsecName.c_str(), &orig);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to get link %s: %s", macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    struct rtnl_link *change = rtnl_link_macsec_alloc();
+
+    if (change == nullptr)
+    {
+        rtnl_link_put(orig);
+
+        return false;
+    }
+
+    rtnl_link_macsec_set_encoding_sa(change, an);
+
+    err = rtnl_link_change(m_routeSocket, orig, change, 0);
+
+    rtnl_link_put(change);
+    rtnl_link_put(orig);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to set encoding SA %u on %s: %s", an, macsecName.c_str(), nl_geterror(err));
+
+        return false;
+    }
+
+    return true;
+}
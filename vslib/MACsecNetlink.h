@@ -0,0 +1,187 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+struct nl_sock;
+
+namespace saivs
+{
+    /**
+     * @brief Generic netlink MACsec backend.
+     *
+     * Programs Linux MACsec SC and SA directly over generic netlink (and
+     * encoding SA over route netlink), using persistent sockets, so each
+     * operation doesn't require fork/exec of /sbin/ip and parsing its
+     * output.
+     */
+    class MACsecNetlink
+    {
+        public:
+
+            struct SaConfig
+            {
+                bool m_egress;
+
+                std::string m_sci;
+
+                std::uint8_t m_an;
+
+                std::uint64_t m_pn;
+
+                bool m_xpn;
+
+                std::string m_ssci;
+
+                std::string m_salt;
+
+                std::string m_keyId;
+
+                std::string m_key;
+            };
+
+            struct SaState
+            {
+                std::uint8_t m_an;
+
+                std::uint64_t m_pn;
+            };
+
+            struct ScState
+            {
+                /**
+                 * @brief SCI in network order, same as parseSci output.
+                 */
+                std::uint64_t m_sci;
+
+                std::vector<SaState> m_sas;
+
+                const SaState* findSa(
+                        _In_ std::uint8_t an) const;
+            };
+
+            /**
+             * @brief MACsec device state obtained from single netlink dump.
+             */
+            struct DeviceState
+            {
+                ScState m_txSc;
+
+                std::vector<ScState> m_rxScs;
+
+                const ScState* findSc(
+                        _In_ bool egress,
+                        _In_ const std::string &sci) const;
+            };
+
+        public:
+
+            MACsecNetlink();
+
+            virtual ~MACsecNetlink();
+
+        private:
+
+            MACsecNetlink(const MACsecNetlink&) = delete;
+            MACsecNetlink& operator=(const MACsecNetlink&) = delete;
+
+        public:
+
+            /**
+             * @brief Check whether MACsec generic netlink family is present.
+             */
+            bool isAvailable();
+
+            bool addRxSc(
+                    _In_ const std::string &macsecName,
+                    _In_ const std::string &sci);
+
+            bool delRxSc(
+                    _In_ const std::string &macsecName,
+                    _In_ const std::string &sci);
+
+            bool addSa(
+                    _In_ const std::string &macsecName,
+                    _In_ const SaConfig &sa);
+
+            bool delSa(
+                    _In_ const std::string &macsecName,
+                    _In_ bool egress,
+                    _In_ const std::string &sci,
+                    _In_ std::uint8_t an);
+
+            bool updateSaPn(
+                    _In_ const std::string &macsecName,
+                    _In_ bool egress,
+                    _In_ const std::string &sci,
+                    _In_ std::uint8_t an,
+                    _In_ bool xpn,
+                    _In_ std::uint64_t pn);
+
+            bool getSaPn(
+                    _In_ const std::string &macsecName,
+                    _In_ bool egress,
+                    _In_ const std::string &sci,
+                    _In_ std::uint8_t an,
+                    _Out_ std::uint64_t &pn);
+
+            bool setEncodingSa(
+                    _In_ const std::string &macsecName,
+                    _In_ std::uint8_t an);
+
+            /**
+             * @brief Get MACsec device SC and SA state.
+             *
+             * Replaces "ip macsec show" output parsing, state is obtained
+             * from single generic netlink dump.
+             *
+             * @return True if device was found, false if device doesn't
+             * exist or dump failed.
+             */
+            bool getDeviceState(
+                    _In_ const std::string &macsecName,
+                    _Out_ DeviceState &state);
+
+        public:
+
+            static bool parseSci(
+                    _In_ const std::string &sci,
+                    _Out_ std::uint64_t &value);
+
+            static bool parseHex(
+                    _In_ const std::string &hex,
+                    _In_ size_t length,
+                    _Out_ std::uint8_t *buffer);
+
+        private:
+
+            bool connect();
+
+            void disconnect();
+
+            bool dumpDevice(
+                    _In_ const std::string &macsecName,
+                    _Out_ DeviceState &state);
+
+            bool setSaActive(
+                    _In_ const std::string &macsecName,
+                    _In_ bool egress,
+                    _In_ const std::string &sci,
+                    _In_ std::uint8_t an,
+                    _In_ bool active);
+
+        private:
+
+            std::mutex m_mutex;
+
+            struct nl_sock* m_genlSocket;
+
+            struct nl_sock* m_routeSocket;
+
+            int m_family;
+    };
+}
@@ -0,0 +1,172 @@
+#include "NetLinkStatsSnapshot.h"
+
+#include "swss/logger.h"
+
+#include <netlink/netlink.h>
+#include <netlink/cache.h>
+#include <netlink/route/link.h>
+
+using namespace saivs;
+
+NetLinkStatsSnapshot::NetLinkStatsSnapshot(
+        _In_ const std::map<sai_stat_id_t, std::string>& statIdMap):
+    m_socket(nullptr)
+{
+    SWSS_LOG_ENTER();
+
+    // counter names are the same as netlink link stat names
+
+    for (auto& kvp: statIdMap)
+    {
+        int id = rtnl_link_str2stat(kvp.second.c_str());
+
+        if (id < 0)
+        {
+            SWSS_LOG_WARN("counter %s is not supported by netlink", kvp.second.c_str());
+
+            continue;
+        }
+
+        m_statIdMap[kvp.first] = id;
+    }
+}
+
+NetLinkStatsSnapshot::~NetLinkStatsSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_socket)
+    {
+        nl_socket_free(m_socket);
+    }
+}
+
+bool NetLinkStatsSnapshot::connect()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_socket)
+    {
+        return true;
+    }
+
+    m_socket = nl_socket_alloc();
+
+    if (m_socket == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to allocate netlink socket");
+        return false;
+    }
+
+    int err = nl_connect(m_socket, NETLINK_ROUTE);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to connect netlink socket: %s", nl_geterror(err));
+
+        nl_socket_free(m_socket);
+
+        m_socket = nullptr;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool NetLinkStatsSnapshot::refresh()
+{
+    SWSS_LOG_ENTER();
+
+    m_stats.clear();
+
+    if (!connect())
+    {
+        return false;
+    }
+
+    struct nl_cache* cache = nullptr;
+
+    int err = rtnl_link_alloc_cache(m_socket, AF_UNSPEC, &cache);
+
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("failed to dump links: %s", nl_geterror(err));
+
+        // socket may be in inconsistent state, reconnect on next refresh
+
+        nl_socket_free(m_socket);
+
+        m_socket = nullptr;
+
+        return false;
+    }
+
+    for (auto* obj = nl_cache_get_first(cache); obj; obj = nl_cache_get_next(obj))
+    {
+        auto* link = (struct rtnl_link*)obj;
+
+        const char* name = rtnl_link_get_name(link);
+
+        if (name == nullptr)
+        {
+            continue;
+        }
+
+        auto& stats = m_stats[name];
+
+        for (auto& kvp: m_statIdMap)
+        {
+            stats[kvp.first] = rtnl_link_get_stat(link, (rtnl_link_stat_id_t)kvp.second);
+        }
+    }
+
+    nl_cache_free(cache);
+
+    SWSS_LOG_DEBUG("obtained stats for %zu links", m_stats.size());
+
+    return true;
+}
+
+bool NetLinkStatsSnapshot::getStat(
+        _In_ const std::string& ifName,
+        _In_ sai_stat_id_t counterId,
+        _Out_ uint64_t& counter) const
+{
+    SWSS_LOG_ENTER();
+
+    counter = 0;
+
+    auto it = m_stats.find(ifName);
+
+    if (it == m_stats.end())
+    {
+        return false;
+    }
+
+    auto sit = it->second.find(counterId);
+
+    if (sit == it->second.end())
+    {
+        return false;
+    }
+
+    counter = sit->second;
+
+    return true;
+}
+
+size_t NetLinkStatsSnapshot::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_stats.size();
+}
+
+bool NetLinkStatsSnapshot::isStatSupported(
+        _In_ sai_stat_id_t counterId) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_statIdMap.find(counterId) != m_statIdMap.end();
+}
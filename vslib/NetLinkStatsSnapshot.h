@@ -0,0 +1,83 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include "swss/sal.h"
+
+#include <string>
+#include <map>
+#include <unordered_map>
+
+struct nl_sock;
+
+namespace saivs
+{
+    /**
+     * @brief Snapshot of all host interfaces statistics.
+     *
+     * All interfaces statistics are obtained by single RTM_GETLINK netlink
+     * dump (IFLA_STATS64), instead of reading each counter from separate
+     * /sys/class/net/<if>/statistics/<name> file.
+     */
+    class NetLinkStatsSnapshot
+    {
+        public:
+
+            /**
+             * @brief Create snapshot for given counters.
+             *
+             * @param statIdMap Map of counter id to statistic name, names are
+             * the same as in /sys/class/net/<if>/statistics.
+             */
+            NetLinkStatsSnapshot(
+                    _In_ const std::map<sai_stat_id_t, std::string>& statIdMap);
+
+            virtual ~NetLinkStatsSnapshot();
+
+        private:
+
+            NetLinkStatsSnapshot(const NetLinkStatsSnapshot&) = delete;
+            NetLinkStatsSnapshot& operator=(const NetLinkStatsSnapshot&) = delete;
+
+        public:
+
+            /**
+             * @brief Refresh snapshot by dumping all links.
+             *
+             * @return True on success, false otherwise.
+             */
+            bool refresh();
+
+            /**
+             * @brief Get counter for specific interface from current snapshot.
+             *
+             * @return True if counter is supported and interface was found.
+             */
+            bool getStat(
+                    _In_ const std::string& ifName,
+                    _In_ sai_stat_id_t counterId,
+                    _Out_ uint64_t& counter) const;
+
+            size_t size() const;
+
+            bool isStatSupported(
+                    _In_ sai_stat_id_t counterId) const;
+
+        private:
+
+            bool connect();
+
+        private:
+
+            struct nl_sock* m_socket;
+
+            /**
+             * @brief Map of counter id to netlink link stat id.
+             */
+            std::map<sai_stat_id_t, int> m_statIdMap;
+
+            std::unordered_map<std::string, std::map<sai_stat_id_t, uint64_t>> m_stats;
+    };
+}
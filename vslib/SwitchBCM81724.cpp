@@ -3,6 +3,8 @@
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
 
+#include <algorithm>
+
 using namespace saivs;
 
 SwitchBCM81724::SwitchBCM81724(
@@ -167,6 +169,11 @@ sai_status_t SwitchBCM81724::refresh_port_list(
         m_port_list.push_back(port_id);
     }
 
+    // objects are kept in hash map, sort to have deterministic order, the
+    // same as SwitchStateBase::refresh_port_list
+
+    std::sort(m_port_list.begin(), m_port_list.end());
+
     uint32_t port_count = (uint32_t)m_port_list.size();
 
     attr.id = SAI_SWITCH_ATTR_PORT_LIST;
@@ -13,6 +13,8 @@
 #include <netlink/route/addr.h>
 #include <linux/if.h>
 
+#include <algorithm>
+
 using namespace saivs;
 
 #define VS_COUNTERS_COUNT_MSB (0x80000000)
@@ -34,6 +36,7 @@ SwitchState::SwitchState(
         _In_ std::shared_ptr<SwitchConfig> config):
     m_switch_id(switch_id),
     m_linkCallbackIndex(-1),
+    m_netLinkStatsSnapshot(m_statIdMap),
     m_switchConfig(config)
 {
     SWSS_LOG_ENTER();
@@ -103,6 +106,29 @@ void SwitchState::setMeta(
     m_meta = meta;
 }
 
+std::vector<const SwitchState::SerializedObjectIdHash::value_type*> SwitchState::getSortedObjects(
+        _In_ const SerializedObjectIdHash& objectHash)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const SerializedObjectIdHash::value_type*> objects;
+
+    objects.reserve(objectHash.size());
+
+    for (auto& kvp: objectHash)
+    {
+        objects.push_back(&kvp);
+    }
+
+    std::sort(objects.begin(), objects.end(),
+            [](const SerializedObjectIdHash::value_type* a, const SerializedObjectIdHash::value_type* b)
+            {
+                return a->first < b->first;
+            });
+
+    return objects;
+}
+
 sai_object_id_t SwitchState::getSwitchId() const
 {
     SWSS_LOG_ENTER();
@@ -243,7 +269,8 @@ sai_status_t SwitchState::getNetStat(
 sai_status_t SwitchState::getPortStat(
         _In_ sai_object_id_t portId,
         _In_ const sai_stat_id_t counterId,
-        _Out_ uint64_t& counter)
+        _Out_ uint64_t& counter,
+        _In_ const NetLinkStatsSnapshot* snapshot)
 {
     SWSS_LOG_ENTER();
 
@@ -263,6 +290,17 @@ sai_status_t SwitchState::getPortStat(
         return SAI_STATUS_SUCCESS;
     }
 
+    if (snapshot && snapshot->isStatSupported(counterId))
+    {
+        if (!snapshot->getStat(ifName, counterId, counter))
+        {
+            SWSS_LOG_ERROR("Port stat not found in netlink snapshot %s", ifName.c_str());
+            return SAI_STATUS_FAILURE;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
     if (getNetStat(counterId, ifName, counter) != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Port stat get failed %s", ifName.c_str());
@@ -282,6 +320,159 @@ sai_status_t SwitchState::getStatsExt(
 {
     SWSS_LOG_ENTER();
 
+    return getStatsExtInternal(
+            object_type,
+            object_id,
+            number_of_counters,
+            counter_ids,
+            mode,
+            counters,
+            nullptr);
+}
+
+sai_status_t SwitchState::bulkGetStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0 || object_key == nullptr || object_statuses == nullptr ||
+            number_of_counters == 0 || counter_ids == nullptr || counters == nullptr)
+    {
+        SWSS_LOG_ERROR("invalid bulk get stats parameters");
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_stats_mode_t singleMode;
+
+    switch (mode)
+    {
+        case SAI_STATS_MODE_BULK_READ:
+            singleMode = SAI_STATS_MODE_READ;
+            break;
+
+        case SAI_STATS_MODE_BULK_READ_AND_CLEAR:
+            singleMode = SAI_STATS_MODE_READ_AND_CLEAR;
+            break;
+
+        default:
+
+            SWSS_LOG_ERROR("mode %s is not supported for bulk get stats",
+                    sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t).c_str());
+
+            return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    auto meta = m_meta.lock();
+
+    bool enabled = meta && meta->meta_unittests_enabled();
+
+    const NetLinkStatsSnapshot* snapshot = nullptr;
+
+    if (!enabled && object_type == SAI_OBJECT_TYPE_PORT)
+    {
+        /*
+         * Obtain stats of all host interfaces by single netlink dump, and
+         * serve all port counters from that snapshot.
+         */
+
+        if (m_netLinkStatsSnapshot.refresh())
+        {
+            snapshot = &m_netLinkStatsSnapshot;
+        }
+        else
+        {
+            SWSS_LOG_WARN("failed to obtain netlink stats snapshot, falling back to sysfs");
+        }
+    }
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = getStatsExtInternal(
+                object_type,
+                object_key[idx].key.object_id,
+                number_of_counters,
+                counter_ids,
+                singleMode,
+                &counters[idx * number_of_counters],
+                snapshot);
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+sai_status_t SwitchState::bulkClearStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count == 0 || object_key == nullptr || object_statuses == nullptr ||
+            number_of_counters == 0 || counter_ids == nullptr)
+    {
+        SWSS_LOG_ERROR("invalid bulk clear stats parameters");
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (mode != SAI_STATS_MODE_BULK_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %s is not supported for bulk clear stats",
+                sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t).c_str());
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    /*
+     * Clear is local only, so there is no need to obtain host interface
+     * counters, just zero out local values.
+     */
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        auto& localcounters = m_countersMap[object_key[idx].key.object_id];
+
+        for (uint32_t i = 0; i < number_of_counters; ++i)
+        {
+            localcounters[counter_ids[i]] = 0;
+        }
+
+        object_statuses[idx] = SAI_STATUS_SUCCESS;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t SwitchState::getStatsExtInternal(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_id_t object_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t* counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Out_ uint64_t *counters,
+        _In_ const NetLinkStatsSnapshot* snapshot)
+{
+    SWSS_LOG_ENTER();
+
     bool perform_set = false;
 
     auto info = sai_metadata_get_object_type_info(object_type);
@@ -310,14 +501,7 @@ sai_status_t SwitchState::getStatsExt(
         perform_set = true;
     }
 
-    auto str_object_id = sai_serialize_object_id(object_id);
-
-    auto mapit = m_countersMap.find(str_object_id);
-
-    if (mapit == m_countersMap.end())
-        m_countersMap[str_object_id] = { };
-
-    auto& localcounters = m_countersMap[str_object_id];
+    auto& localcounters = m_countersMap[object_id]; // will create if not exist
 
     for (uint32_t i = 0; i < number_of_counters; ++i)
     {
@@ -345,7 +529,7 @@ sai_status_t SwitchState::getStatsExt(
             /* In non unit test mode, fetch port counters from host interface */
             if (!enabled && (object_type == SAI_OBJECT_TYPE_PORT))
             {
-                if (getPortStat(object_id, id, counter) != SAI_STATUS_SUCCESS)
+                if (getPortStat(object_id, id, counter, snapshot) != SAI_STATUS_SUCCESS)
                 {
                     return SAI_STATUS_FAILURE;
                 }
@@ -6,15 +6,18 @@ extern "C" {
 
 #include "SaiAttrWrap.h"
 #include "SwitchConfig.h"
+#include "NetLinkStatsSnapshot.h"
 
 #include "meta/Meta.h"
 
 #include "swss/selectableevent.h"
 
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <thread>
 #include <string>
+#include <vector>
 #include <mutex>
 
 namespace saivs
@@ -28,10 +31,25 @@ namespace saivs
              */
             typedef std::map<std::string, std::shared_ptr<SaiAttrWrap>> AttrHash;
 
+            /**
+             * @brief SerializedObjectIdHash is hash map indexed by serialized
+             * object id or serialized entry (route, neighbor, fdb, etc).
+             *
+             * Hash map is used since single object type (for example routes)
+             * can have millions of entries, and lookup on each API call must
+             * not depend on number of already created objects.
+             */
+            typedef std::unordered_map<std::string, AttrHash> SerializedObjectIdHash;
+
             /**
              * @brief ObjectHash is map indexed by object type and then serialized object id.
              */
-            typedef std::map<sai_object_type_t, std::map<std::string, AttrHash>> ObjectHash;
+            typedef std::map<sai_object_type_t, SerializedObjectIdHash> ObjectHash;
+
+            /**
+             * @brief CountersHash is hash map indexed by object id and then counter id.
+             */
+            typedef std::unordered_map<sai_object_id_t, std::map<int, uint64_t>> CountersHash;
 
         public:
 
@@ -56,11 +74,43 @@ namespace saivs
                     _In_ sai_stats_mode_t mode,
                     _Out_ uint64_t *counters);
 
+            sai_status_t bulkGetStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
+            sai_status_t bulkClearStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses);
+
             sai_status_t queryStatsCapability(
                     _In_ sai_object_id_t switchId,
                     _In_ sai_object_type_t objectType,
                     _Inout_ sai_stat_capability_list_t *stats_capability);
 
+        public:
+
+            /**
+             * @brief Get objects of single type sorted by serialized object id.
+             *
+             * Objects are kept in hash map, so every path where order is
+             * observable (warm boot file, tap recreation, first match
+             * lookups) must iterate objects in this order, which is the same
+             * as order of previously used ordered map.
+             */
+            static std::vector<const SerializedObjectIdHash::value_type*> getSortedObjects(
+                    _In_ const SerializedObjectIdHash& objectHash);
+
         public:
 
             sai_object_id_t getSwitchId() const;
@@ -88,10 +138,20 @@ namespace saivs
 
         private:
 
+            sai_status_t getStatsExtInternal(
+                    _In_ sai_object_type_t obejct_type,
+                    _In_ sai_object_id_t object_id,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t* counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Out_ uint64_t *counters,
+                    _In_ const NetLinkStatsSnapshot* snapshot);
+
             sai_status_t getPortStat(
                     _In_ sai_object_id_t portId,
                     _In_ const sai_stat_id_t counterId,
-                    _Out_ uint64_t& counter);
+                    _Out_ uint64_t& counter,
+                    _In_ const NetLinkStatsSnapshot* snapshot);
 
            sai_status_t getNetStat(
                    _In_ sai_stat_id_t counterId,
@@ -116,7 +176,7 @@ namespace saivs
 
         protected:
 
-            std::map<std::string, std::map<int, uint64_t>> m_countersMap;
+            CountersHash m_countersMap;
 
             sai_object_id_t m_switch_id;
 
@@ -132,6 +192,8 @@ namespace saivs
 
         private : // port counter mapping
 
+            NetLinkStatsSnapshot m_netLinkStatsSnapshot;
+
             static const std::map<sai_stat_id_t, std::string> m_statIdMap;
 
         protected:
@@ -233,21 +233,18 @@ sai_status_t SwitchStateBase::create_internal(
         }
     }
 
-    if (objectHash.find(serializedObjectId) == objectHash.end())
-    {
-        /*
-         * Number of attributes may be zero, so see if actual entry was created
-         * with empty hash.
-         */
+    /*
+     * Number of attributes may be zero, so entry is created with empty hash if
+     * it don't exist yet (switch object is already created by init).
+     */
 
-        objectHash[serializedObjectId] = {};
-    }
+    auto& attrHash = (it == objectHash.end()) ? objectHash[serializedObjectId] : it->second;
 
     for (uint32_t i = 0; i < attr_count; ++i)
     {
         auto a = std::make_shared<SaiAttrWrap>(object_type, &attr_list[i]);
 
-        objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
+        attrHash[a->getAttrMetadata()->attridname] = a;
     }
 
     return SAI_STATUS_SUCCESS;
@@ -2150,7 +2147,7 @@ sai_status_t SwitchStateBase::refresh_vlan_member_list(
 
     auto me = m_objectHash.at(SAI_OBJECT_TYPE_VLAN).at(sai_serialize_object_id(vlan_id));
 
-    for (auto vm: all_vlan_members)
+    for (auto& vm: all_vlan_members)
     {
         if (vm.second.at(md_vlan_id->attridname)->getAttr()->value.oid != vlan_id)
         {
@@ -2172,6 +2169,12 @@ sai_status_t SwitchStateBase::refresh_vlan_member_list(
         }
     }
 
+    /*
+     * Objects are kept in hash map, so sort to have deterministic order.
+     */
+
+    std::sort(vlan_member_list.begin(), vlan_member_list.end());
+
     uint32_t vlan_member_list_count = (uint32_t)vlan_member_list.size();
 
     SWSS_LOG_NOTICE("recalculated %s: %u", m_member_list->attridname, vlan_member_list_count);
@@ -2645,6 +2648,13 @@ void SwitchStateBase::processFdbEntriesForAging()
 
     SWSS_LOG_DEBUG("fdb infos to process: %zu", m_fdb_info_set.size());
 
+    if (m_fdb_info_set.empty())
+    {
+        // nothing learned, no need to query aging time
+
+        return;
+    }
+
     uint32_t current = (uint32_t)time(NULL);
 
     sai_attribute_t attr;
@@ -2669,22 +2679,11 @@ void SwitchStateBase::processFdbEntriesForAging()
         return;
     }
 
-    // find aged fdb entries
+    // entries are ordered by timestamp, so only aged ones are visited
 
-    for (auto it = m_fdb_info_set.begin(); it != m_fdb_info_set.end();)
+    for (auto& fi: m_fdb_info_set.extractAged(current, aging_time))
     {
-        if ((current - it->getTimestamp()) >= aging_time)
-        {
-            FdbInfo fi = *it;
-
-            processFdbInfo(fi, SAI_FDB_EVENT_AGED);
-
-            it = m_fdb_info_set.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        processFdbInfo(fi, SAI_FDB_EVENT_AGED);
     }
 }
 
@@ -3151,25 +3150,27 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
 
     size_t count = 0;
 
-    for (auto kvp: objectHash)
+    for (auto& kvp: objectHash)
     {
-        auto singleTypeObjectMap = kvp.second;
+        auto& singleTypeObjectMap = kvp.second;
 
         count += singleTypeObjectMap.size();
 
-        for (auto o: singleTypeObjectMap)
+        // objects are kept in hash map, sort to have deterministic file
+
+        for (auto* o: getSortedObjects(singleTypeObjectMap))
         {
             // if object don't have attributes, size can be zero
-            if (o.second.size() == 0)
+            if (o->second.size() == 0)
             {
-                ss << sai_serialize_object_type(kvp.first) << " " << o.first << " NULL NULL" << std::endl;
+                ss << sai_serialize_object_type(kvp.first) << " " << o->first << " NULL NULL" << std::endl;
                 continue;
             }
 
-            for (auto a: o.second)
+            for (auto& a: o->second)
             {
                 ss << sai_serialize_object_type(kvp.first) << " ";
-                ss << o.first.c_str();
+                ss << o->first.c_str();
                 ss << " ";
                 ss << a.first.c_str();
                 ss << " ";
@@ -3186,7 +3187,7 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
          * data and restore it on warm start.
          */
 
-        for (auto fi: m_fdb_info_set)
+        for (auto& fi: m_fdb_info_set)
         {
             ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
         }
@@ -3225,11 +3226,11 @@ void SwitchStateBase::debugSetStats(
 {
     SWSS_LOG_ENTER();
 
-    auto key = sai_serialize_object_id(oid);
+    auto& counters = m_countersMap[oid];
 
     for (auto& kvp: stats)
     {
-        m_countersMap[key][kvp.first] = kvp.second;
+        counters[kvp.first] = kvp.second;
     }
 }
 
@@ -3778,6 +3779,10 @@ void SwitchStateBase::findObjects(
             objects.push_back(object_id);
         }
     }
+
+    // objects are kept in hash map, sort to have deterministic order
+
+    std::sort(objects.begin(), objects.end());
 }
 
 bool SwitchStateBase::dumpObject(
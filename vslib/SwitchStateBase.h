@@ -1,7 +1,7 @@
 #pragma once
 
 #include "SwitchState.h"
-#include "FdbInfo.h"
+#include "FdbInfoSet.h"
 #include "HostInterfaceInfo.h"
 #include "WarmBootState.h"
 #include "SwitchConfig.h"
@@ -725,7 +725,7 @@ namespace saivs
 
         public: // TODO private
 
-            std::set<FdbInfo> m_fdb_info_set;
+            FdbInfoSet m_fdb_info_set;
 
             std::map<std::string, std::shared_ptr<HostInterfaceInfo>> m_hostif_info_map;
 
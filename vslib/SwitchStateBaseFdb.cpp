@@ -136,7 +136,7 @@ void SwitchStateBase::findBridgeVlanForPortVlan(
 
     bool bv_id_set = false;
 
-    for (auto it = objectHash.begin(); it != objectHash.end(); ++it)
+    for (auto* it: getSortedObjects(objectHash))
     {
         sai_object_id_t bpid;
 
@@ -231,7 +231,7 @@ void SwitchStateBase::findBridgeVlanForPortVlan(
 
             // iterate via all vlans to find match on vlan id
 
-            for (auto it2 = objectHash2.begin(); it2 != objectHash2.end(); ++it2)
+            for (auto* it2: getSortedObjects(objectHash2))
             {
                 sai_object_id_t vlan_oid;
 
@@ -280,7 +280,7 @@ bool SwitchStateBase::getLagFromPort(
 
     // iterate via all lag members to find match on port id
 
-    for (auto it = objectHash.begin(); it != objectHash.end(); ++it)
+    for (auto* it: getSortedObjects(objectHash))
     {
         sai_object_id_t lag_member_id;
 
@@ -335,7 +335,7 @@ bool SwitchStateBase::isLagOrPortRifBased(
 
     // iterate via all lag members to find match on port id
 
-    for (auto it = objectHash.begin(); it != objectHash.end(); ++it)
+    for (auto* it: getSortedObjects(objectHash))
     {
         sai_object_id_t rif_id;
 
@@ -514,18 +514,9 @@ void SwitchStateBase::process_packet_for_fdb_event(
 
     memcpy(fi.m_fdbEntry.mac_address, eh->h_source, sizeof(sai_mac_t));
 
-    std::set<FdbInfo>::iterator it = m_fdb_info_set.find(fi);
-
-    if (it != m_fdb_info_set.end())
+    if (m_fdb_info_set.refresh(fi, frametime))
     {
-        // this key was found, update timestamp
-        // and since iterator is const we need to reinsert
-
-        fi = *it;
-
-        fi.setTimestamp(frametime);
-
-        m_fdb_info_set.insert(fi);
+        // this key was found, timestamp updated
 
         return;
     }
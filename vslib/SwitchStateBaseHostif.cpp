@@ -706,11 +706,13 @@ sai_status_t SwitchStateBase::vs_recreate_hostif_tap_interfaces()
 
     SWSS_LOG_NOTICE("attempt to recreate %zu tap devices for host interfaces", objectHash.size());
 
-    for (auto okvp: objectHash)
+    // recreate in deterministic order, objects are kept in hash map
+
+    for (auto* okvp: getSortedObjects(objectHash))
     {
         std::vector<sai_attribute_t> attrs;
 
-        for (auto akvp: okvp.second)
+        for (auto& akvp: okvp->second)
         {
             attrs.push_back(*akvp.second->getAttr());
         }
@@ -6,6 +6,14 @@ using namespace saivs;
 
 #define MUTEX std::unique_lock<std::mutex> guard(m_mutex)
 
+TrafficFilterPipes::TrafficFilterPipes():
+    m_snapshot(std::make_shared<const FilterPriorityQueue>())
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 bool TrafficFilterPipes::installFilter(
         _In_ int priority,
         _In_ std::shared_ptr<TrafficFilter> filter)
@@ -13,7 +21,27 @@ bool TrafficFilterPipes::installFilter(
     MUTEX;
     SWSS_LOG_ENTER();
 
-    return m_filters.emplace(priority, filter).second;
+    auto it = m_filters.find(priority);
+
+    if (it != m_filters.end())
+    {
+        if (it->second)
+        {
+            return false;
+        }
+
+        // empty filter on that priority is not executed, it can be replaced
+
+        it->second = filter;
+    }
+    else
+    {
+        m_filters.emplace(priority, filter);
+    }
+
+    publishSnapshot();
+
+    return true;
 }
 
 bool TrafficFilterPipes::uninstallFilter(
@@ -26,10 +54,12 @@ bool TrafficFilterPipes::uninstallFilter(
             itr != m_filters.end();
             itr ++)
     {
-        if (itr->second == filter)
+        if (itr->second && itr->second == filter)
         {
             m_filters.erase(itr);
 
+            publishSnapshot();
+
             return true;
         }
     }
@@ -37,35 +67,40 @@ bool TrafficFilterPipes::uninstallFilter(
     return false;
 }
 
+void TrafficFilterPipes::publishSnapshot()
+{
+    SWSS_LOG_ENTER();
+
+    auto snapshot = std::make_shared<FilterPriorityQueue>();
+
+    for (auto& kvp: m_filters)
+    {
+        if (kvp.second)
+        {
+            snapshot->emplace(kvp.first, kvp.second);
+        }
+    }
+
+    std::atomic_store(&m_snapshot, std::shared_ptr<const FilterPriorityQueue>(snapshot));
+}
+
 TrafficFilter::FilterStatus TrafficFilterPipes::execute(
         _Inout_ void *buffer,
         _Inout_ size_t &length)
 {
-    MUTEX;
     SWSS_LOG_ENTER();
 
+    auto snapshot = std::atomic_load(&m_snapshot);
+
     TrafficFilter::FilterStatus ret = TrafficFilter::CONTINUE;
 
-    for (auto itr = m_filters.begin(); itr != m_filters.end();)
+    for (auto& kvp: *snapshot)
     {
-        auto filter = itr->second;
+        ret = kvp.second->execute(buffer, length);
 
-        if (filter)
-        {
-            ret = filter->execute(buffer, length);
-
-            if (ret == TrafficFilter::CONTINUE)
-            {
-                itr ++;
-            }
-            else
-            {
-                break;
-            }
-        }
-        else
+        if (ret != TrafficFilter::CONTINUE)
         {
-            itr = m_filters.erase(itr);
+            break;
         }
     }
 
@@ -12,7 +12,7 @@ namespace saivs
     {
         public:
 
-            TrafficFilterPipes() = default;
+            TrafficFilterPipes();
 
             virtual ~TrafficFilterPipes() = default;
 
@@ -25,6 +25,12 @@ namespace saivs
             bool uninstallFilter(
                     _In_ std::shared_ptr<TrafficFilter> filter);
 
+            /**
+             * @brief Execute all installed filters in priority order.
+             *
+             * This is called for every packet, so it does not take filters
+             * mutex, it works on current snapshot of installed filters.
+             */
             TrafficFilter::FilterStatus execute(
                     _Inout_ void *buffer,
                     _Inout_ size_t &length);
@@ -33,8 +39,18 @@ namespace saivs
 
             typedef std::map<int, std::shared_ptr<TrafficFilter> > FilterPriorityQueue;
 
+            void publishSnapshot();
+
             std::mutex m_mutex;
 
             FilterPriorityQueue m_filters;
+
+            /**
+             * @brief Read only copy of installed filters used by execute.
+             *
+             * Replaced atomically on each install/uninstall, so filter
+             * changes don't block packet processing.
+             */
+            std::shared_ptr<const FilterPriorityQueue> m_snapshot;
     };
 }
@@ -79,7 +79,23 @@ bool TrafficForwarder::sendTo(
 {
     SWSS_LOG_ENTER();
 
-    if (write(fd, buffer, static_cast<int>(length)) < 0)
+    ssize_t res = write(fd, buffer, static_cast<int>(length));
+
+    if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        /*
+         * Descriptor is in non blocking mode (tap device is drained by shared
+         * event loop), and this can be executed by event loop thread, so
+         * never wait for device to become writable, drop frame like real
+         * device does when its queue is full.
+         */
+
+        SWSS_LOG_DEBUG("device fd %d queue is full, dropping frame", fd);
+
+        return true;
+    }
+
+    if (res < 0)
     {
         /*
          * We filter out EIO because of this patch:
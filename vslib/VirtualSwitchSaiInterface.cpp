@@ -199,7 +199,7 @@ void VirtualSwitchSaiInterface::update_local_metadata(
 
         mk.objecttype = ot;
 
-        for (auto obj: kvp.second)
+        for (auto& obj: kvp.second)
         {
             sai_deserialize_object_id(obj.first, mk.objectkey.key.object_id);
 
@@ -227,7 +227,7 @@ void VirtualSwitchSaiInterface::update_local_metadata(
         if (info->isobjectid)
             continue;
 
-        for (auto obj: kvp.second)
+        for (auto& obj: kvp.second)
         {
             std::string key = std::string(info->objecttypename) + ":" + obj.first;
 
@@ -254,13 +254,13 @@ void VirtualSwitchSaiInterface::update_local_metadata(
         if (info == NULL)
             SWSS_LOG_THROW("failed to get object type info for object type %d", ot);
 
-        for (auto obj: kvp.second)
+        for (auto& obj: kvp.second)
         {
             std::string key = std::string(info->objecttypename) + ":" + obj.first;
 
             sai_deserialize_object_meta_key(key, mk);
 
-            for (auto a: obj.second)
+            for (auto& a: obj.second)
             {
                 auto meta = a.second->getAttrMetadata();
 
@@ -1206,7 +1206,22 @@ sai_status_t VirtualSwitchSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto ss = getBulkStatsSwitchState(switchId, object_count, object_key);
+
+    if (ss == nullptr)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    return ss->bulkGetStats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
@@ -1221,7 +1236,50 @@ sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto ss = getBulkStatsSwitchState(switchId, object_count, object_key);
+
+    if (ss == nullptr)
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
+    return ss->bulkClearStats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
+}
+
+std::shared_ptr<SwitchStateBase> VirtualSwitchSaiInterface::getBulkStatsSwitchState(
+        _In_ sai_object_id_t switchId,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Bulk stats callers (like FlexCounter) can pass NULL switch id, then
+     * switch is deduced from first object.
+     */
+
+    if (switchId == SAI_NULL_OBJECT_ID && object_count && object_key)
+    {
+        switchId = switchIdQuery(object_key[0].key.object_id);
+    }
+
+    auto it = m_switchStateMap.find(switchId);
+
+    if (it == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return nullptr;
+    }
+
+    return it->second;
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkRemove(
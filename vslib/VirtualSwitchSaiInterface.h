@@ -299,6 +299,11 @@ namespace saivs
             void removeSwitch(
                     _In_ sai_object_id_t switchId);
 
+            std::shared_ptr<SwitchStateBase> getBulkStatsSwitchState(
+                    _In_ sai_object_id_t switchId,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key);
+
         public:
 
             void setMeta(
@@ -191,17 +191,11 @@ sai_status_t VirtualSwitchSaiInterface::flushFdbEntries(
                 fi.setVlanId(attr.value.u16);
             }
 
-            auto fit = ss->m_fdb_info_set.find(fi);
-
-            if (fit == ss->m_fdb_info_set.end())
+            if (!ss->m_fdb_info_set.erase(fi))
             {
                 // this may happen if vlan is invalid
                 SWSS_LOG_ERROR("failed to find fdb entry in info set: %s, learn for this MAC will be disabled", it->first.c_str());
             }
-            else
-            {
-                ss->m_fdb_info_set.erase(fit);
-            }
 
             /*
              * Since we are using &on fdbs then this will also clear local